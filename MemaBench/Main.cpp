@@ -0,0 +1,91 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#include <JuceHeader.h>
+
+#include "MemaBenchRunner.h"
+#include "MemaNetworkBenchRunner.h"
+
+#include <iostream>
+
+ //==============================================================================
+class MainApplication : public juce::JUCEApplication
+{
+public:
+    //==============================================================================
+    MainApplication() {}
+
+    const String getApplicationName() override { return ProjectInfo::projectName; }
+    const String getApplicationVersion() override { return ProjectInfo::versionString; }
+    bool moreThanOneInstanceAllowed() override { return true; }
+
+    //==============================================================================
+    void initialise(const String& commandLine) override
+    {
+        ignoreUnused(commandLine);
+
+        auto options = MemaBenchOptions::fromCommandLine(getCommandLineParameterArray());
+        if (options.helpRequested)
+        {
+            std::cout << MemaBenchOptions::getUsageText() << std::flush;
+            quit();
+            return;
+        }
+
+        auto onFinished = [=](int exitCode) {
+            setApplicationReturnValue(exitCode);
+            quit();
+        };
+        if (options.networkSuite)
+        {
+            m_networkBenchRunner = std::make_unique<MemaNetworkBenchRunner>(options, onFinished);
+            m_networkBenchRunner->start();
+        }
+        else
+        {
+            m_benchRunner = std::make_unique<MemaBenchRunner>(options, onFinished);
+            m_benchRunner->start();
+        }
+    }
+
+    void shutdown() override
+    {
+        m_benchRunner.reset();
+        m_networkBenchRunner.reset();
+    }
+
+    //==============================================================================
+    void systemRequestedQuit() override
+    {
+        quit();
+    }
+
+    void anotherInstanceStarted(const juce::String& commandLine) override
+    {
+        ignoreUnused(commandLine);
+    }
+
+private:
+    std::unique_ptr<MemaBenchRunner>            m_benchRunner;
+    std::unique_ptr<MemaNetworkBenchRunner>     m_networkBenchRunner;
+};
+
+//==============================================================================
+// This macro generates the main() routine that launches the app.
+START_JUCE_APPLICATION(MainApplication)
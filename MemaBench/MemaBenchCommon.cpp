@@ -0,0 +1,179 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#include "MemaBenchCommon.h"
+
+#include "MemaProcessor/MemaProcessor.h"
+
+#include <iostream>
+#include <numeric>
+
+
+//==============================================================================
+MemaBenchOptions MemaBenchOptions::fromCommandLine(const juce::StringArray& arguments)
+{
+    auto options = MemaBenchOptions();
+
+    // list and value arguments only replace the default if they hold at least one value in range
+    auto parseIntList = [](const juce::String& argument, int minValue, int maxValue, std::vector<int>& values) {
+        auto parsedValues = std::vector<int>();
+        for (auto const& token : juce::StringArray::fromTokens(argument.fromFirstOccurrenceOf("=", false, false), ",", ""))
+        {
+            auto value = token.trim().getIntValue();
+            if (value >= minValue && value <= maxValue)
+                parsedValues.push_back(value);
+        }
+        if (!parsedValues.empty())
+            values = parsedValues;
+    };
+    auto parseInt = [](const juce::String& argument, int minValue, int maxValue, int& value) {
+        auto parsedValue = argument.fromFirstOccurrenceOf("=", false, false).getIntValue();
+        if (parsedValue >= minValue && parsedValue <= maxValue)
+            value = parsedValue;
+    };
+
+    for (auto const& argument : arguments)
+    {
+        if (argument == "--network")
+            options.networkSuite = true;
+        else if (argument.startsWith("--channels="))
+            parseIntList(argument, 1, Mema::MemaProcessor::s_maxChannelCount, options.channelCounts);
+        else if (argument.startsWith("--blocksizes="))
+            parseIntList(argument, 1, Mema::MemaProcessor::s_maxNumSamples, options.blockSizes);
+        else if (argument.startsWith("--samples="))
+            parseInt(argument, 1, std::numeric_limits<int>::max(), options.samplesPerCase);
+        else if (argument.startsWith("--clients="))
+            parseIntList(argument, 1, 256, options.clientCounts);
+        else if (argument.startsWith("--netchannels="))
+            parseIntList(argument, 2, Mema::MemaProcessor::s_maxChannelCount, options.networkChannelCounts);
+        else if (argument.startsWith("--netblocksize="))
+            parseInt(argument, 16, Mema::MemaProcessor::s_maxNumSamples, options.networkBlockSize);
+        else if (argument.startsWith("--seconds="))
+            parseInt(argument, 1, 3600, options.secondsPerNetworkCase);
+        else if (argument.startsWith("--controlrate="))
+            parseInt(argument, 0, 1000, options.controlRate);
+        else if (argument.startsWith("--subscription="))
+        {
+            auto subscriptionName = argument.fromFirstOccurrenceOf("=", false, false);
+            for (auto const subscription : { Subscription::Monitor, Subscription::Remote, Subscription::Mixed, Subscription::All })
+                if (subscriptionName == getSubscriptionName(subscription))
+                    options.subscription = subscription;
+        }
+        else if (argument == "--csv")
+            options.csvOutput = true;
+        else if (argument == "--help" || argument == "-h")
+            options.helpRequested = true;
+    }
+
+    return options;
+}
+
+juce::String MemaBenchOptions::getUsageText()
+{
+    auto defaults = MemaBenchOptions();
+    auto joinInts = [](const std::vector<int>& values) {
+        auto strings = juce::StringArray();
+        for (auto const& value : values)
+            strings.add(juce::String(value));
+        return strings.joinIntoString(",");
+    };
+
+    return juce::String()
+        << "Usage: MemaBench [options]\n"
+        << "Processing suite (default):\n"
+        << "  --channels=LIST       input/output channel counts to run, default " << joinInts(defaults.channelCounts) << "\n"
+        << "  --blocksizes=LIST     block sizes in samples to run, default " << joinInts(defaults.blockSizes) << "\n"
+        << "  --samples=N           sample frames timed per case, default " << defaults.samplesPerCase << "\n"
+        << "Network suite:\n"
+        << "  --network             run the loopback network suite instead of the processing suite\n"
+        << "  --clients=LIST        simulated client counts to run, default " << joinInts(defaults.clientCounts) << "\n"
+        << "  --netchannels=LIST    input/output channel counts to run, default " << joinInts(defaults.networkChannelCounts) << "\n"
+        << "  --netblocksize=N      block size in samples, default " << defaults.networkBlockSize << "\n"
+        << "  --seconds=N           duration of each case, default " << defaults.secondsPerNetworkCase << "\n"
+        << "  --subscription=NAME   traffic the clients subscribe to, mo, re, mixed or all, default " << getSubscriptionName(defaults.subscription) << "\n"
+        << "  --controlrate=N       routing changes per second, 0 disables them, default " << defaults.controlRate << "\n"
+        << "General:\n"
+        << "  --csv                 print the results as comma separated values\n"
+        << "  --help                print this text\n";
+}
+
+juce::String MemaBenchOptions::getSubscriptionName(Subscription subscription)
+{
+    switch (subscription)
+    {
+    case Subscription::Monitor:
+        return "mo";
+    case Subscription::Remote:
+        return "re";
+    case Subscription::Mixed:
+        return "mixed";
+    case Subscription::All:
+    default:
+        return "all";
+    }
+}
+
+
+//==============================================================================
+MemaBenchStatistics MemaBenchStatistics::fromSamples(std::vector<double>& samples)
+{
+    auto statistics = MemaBenchStatistics();
+    statistics.count = int(samples.size());
+    if (samples.empty())
+        return statistics;
+
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&samples](double p) {
+        auto idx = size_t(std::ceil(p * double(samples.size()))) - 1;
+        return samples[std::min(idx, samples.size() - 1)];
+    };
+
+    statistics.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / double(samples.size());
+    statistics.p50 = percentile(0.5);
+    statistics.p90 = percentile(0.9);
+    statistics.p99 = percentile(0.99);
+    statistics.max = samples.back();
+
+    return statistics;
+}
+
+
+//==============================================================================
+void MemaBenchOutput::printLine(const juce::String& line)
+{
+    std::cout << line << "\n" << std::flush;
+}
+
+juce::String MemaBenchOutput::formatTableRow(const juce::StringArray& cells, const std::vector<int>& columnWidths, int leftAlignedColumns)
+{
+    auto row = juce::String();
+    for (auto i = 0; i < cells.size() && i < int(columnWidths.size()); i++)
+        row += (i < leftAlignedColumns) ? cells[i].paddedRight(' ', columnWidths[size_t(i)]) : cells[i].paddedLeft(' ', columnWidths[size_t(i)]);
+    return row;
+}
+
+void MemaBenchOutput::printSystemInfo()
+{
+    printLine(juce::JUCEApplication::getInstance()->getApplicationName() + " " + juce::JUCEApplication::getInstance()->getApplicationVersion()
+        + " | " + juce::SystemStats::getCpuModel() + " | " + juce::String(juce::SystemStats::getNumCpus()) + " cores"
+        + " | " + juce::SystemStats::getOperatingSystemName());
+#if JUCE_DEBUG
+    printLine("Warning: debug build, timings are not representative");
+#endif
+}
@@ -0,0 +1,98 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * @struct MemaBenchOptions
+ * @brief Configuration of the Mema.Bench suites, parsed from the command line.
+ *
+ * The processing suite runs every combination of `channelCounts` and `blockSizes`.  The network
+ * suite (`--network`) runs every combination of `clientCounts` and `networkChannelCounts` at a
+ * fixed `networkBlockSize`, each for `secondsPerNetworkCase` seconds in real time.
+ */
+struct MemaBenchOptions
+{
+    /** @brief Traffic type selection the simulated network clients send after connecting. */
+    enum class Subscription
+    {
+        Monitor,    ///< The set Mema.Mo subscribes to, audio buffers and their parameters.
+        Remote,     ///< The set Mema.Re subscribes to, control and plug-in parameters.
+        Mixed,      ///< Alternating Monitor and Remote clients.
+        All         ///< No selection, i.e. every message the server relays.
+    };
+
+    bool                networkSuite = false;
+    std::vector<int>    channelCounts = { 2, 8, 16, 32, 64 };
+    std::vector<int>    blockSizes = { 32, 64, 128, 256, 512, 1024 };
+    int                 samplesPerCase = 262144;    ///< Number of sample frames timed per processing case.
+    std::vector<int>    clientCounts = { 1, 4, 16 };
+    std::vector<int>    networkChannelCounts = { 2, 16, 64 };
+    int                 networkBlockSize = 512;
+    int                 secondsPerNetworkCase = 5;
+    Subscription        subscription = Subscription::Mixed;
+    int                 controlRate = 50;           ///< Routing changes per second sent during a network case, 0 disables them.
+    double              sampleRate = 48000.0;
+    bool                csvOutput = false;
+    bool                helpRequested = false;
+
+    /** @brief Parses the arguments listed in getUsageText. Unknown arguments are ignored, invalid values keep the defaults. */
+    static MemaBenchOptions fromCommandLine(const juce::StringArray& arguments);
+    /** @brief Returns the usage text printed for `--help`. */
+    static juce::String getUsageText();
+    /** @brief Returns the command line name of @p subscription. */
+    static juce::String getSubscriptionName(Subscription subscription);
+};
+
+/**
+ * @struct MemaBenchStatistics
+ * @brief Mean and percentiles of a set of timing samples.
+ */
+struct MemaBenchStatistics
+{
+    int     count = 0;
+    double  mean = 0.0;
+    double  p50 = 0.0;
+    double  p90 = 0.0;
+    double  p99 = 0.0;
+    double  max = 0.0;
+
+    /** @brief Calculates the statistics of @p samples, which is sorted in place. */
+    static MemaBenchStatistics fromSamples(std::vector<double>& samples);
+};
+
+/**
+ * @class MemaBenchOutput
+ * @brief Result table formatting shared by the Mema.Bench suites.
+ */
+class MemaBenchOutput
+{
+public:
+    /** @brief Writes @p line to stdout and flushes, so progress is visible while a suite is running. */
+    static void printLine(const juce::String& line);
+    /**
+     * @brief Pads @p cells to @p columnWidths.
+     * @param leftAlignedColumns    Number of leading (text) columns that are left aligned, the remaining ones are right aligned.
+     */
+    static juce::String formatTableRow(const juce::StringArray& cells, const std::vector<int>& columnWidths, int leftAlignedColumns);
+    /** @brief Prints the application name and version, the system the suite runs on and a warning for debug builds. */
+    static void printSystemInfo();
+};
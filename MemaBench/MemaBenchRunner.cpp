@@ -0,0 +1,208 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#include "MemaBenchRunner.h"
+
+#include "MemaAppConfiguration.h"
+#include "MemaProcessor/MemaProcessor.h"
+#include "MemaProcessor/ProcessorDataAnalyzer.h"
+
+
+//==============================================================================
+MemaBenchRunner::MemaBenchRunner(const MemaBenchOptions& options, std::function<void(int)> onFinished)
+    : m_options(options), m_onFinished(std::move(onFinished))
+{
+    for (auto const stage : { Stage::ProcessBlock, Stage::AnalyzeData })
+        for (auto const channelCount : m_options.channelCounts)
+            for (auto const blockSize : m_options.blockSizes)
+                for (auto const variant : { false, true })
+                    m_cases.push_back({ stage, variant, channelCount, blockSize });
+
+    // uniform noise at -6dBFS, identical on every run to keep results comparable
+    auto random = juce::Random(0x4d656d61);
+    m_sourceSignal.setSize(Mema::MemaProcessor::s_maxChannelCount, s_sourceSignalLength, false, true, false);
+    for (auto channel = 0; channel < m_sourceSignal.getNumChannels(); channel++)
+    {
+        auto* samples = m_sourceSignal.getWritePointer(channel);
+        for (auto i = 0; i < m_sourceSignal.getNumSamples(); i++)
+            samples[i] = random.nextFloat() - 0.5f;
+    }
+}
+
+MemaBenchRunner::~MemaBenchRunner()
+{
+    stopTimer();
+}
+
+void MemaBenchRunner::start()
+{
+    MemaBenchOutput::printSystemInfo();
+
+    if (m_options.csvOutput)
+        MemaBenchOutput::printLine("stage,variant,channels,blocksize,blocks,mean_ns,p50_ns,p90_ns,p99_ns,max_ns");
+    else
+        MemaBenchOutput::printLine(MemaBenchOutput::formatTableRow({ "stage", "variant", "ch", "block", "blocks", "mean", "p50", "p90", "p99", "max" }, s_columnWidths, 2) + "  [ns/sample]");
+
+    // the processor is fed by this runner instead of an audio device, the minimal config keeps the device section unset
+    auto stateXml = juce::XmlElement(Mema::MemaAppConfiguration::getTagName(Mema::MemaAppConfiguration::TagID::PROCESSORCONFIG));
+    stateXml.createNewChildElement(Mema::MemaAppConfiguration::getTagName(Mema::MemaAppConfiguration::TagID::INPUTMUTES))->addTextElement("1,0");
+    stateXml.createNewChildElement(Mema::MemaAppConfiguration::getTagName(Mema::MemaAppConfiguration::TagID::OUTPUTMUTES))->addTextElement("1,0");
+    stateXml.createNewChildElement(Mema::MemaAppConfiguration::getTagName(Mema::MemaAppConfiguration::TagID::CROSSPOINTGAINS))->addTextElement("1,1,1,1");
+    m_processor = std::make_unique<Mema::MemaProcessor>(&stateXml);
+
+    m_currentCaseIdx = 0;
+    m_casePrepared = false;
+    startTimer(1);
+}
+
+//==============================================================================
+void MemaBenchRunner::timerCallback()
+{
+    if (m_currentCaseIdx >= m_cases.size())
+    {
+        stopTimer();
+        m_analyzer.reset();
+        m_processor.reset();
+        if (m_onFinished)
+            m_onFinished(0);
+        return;
+    }
+
+    // preparation and measurement run in separate ticks, so messages posted while preparing are handled before timing starts
+    if (!m_casePrepared)
+    {
+        prepareCase(m_cases[m_currentCaseIdx]);
+        m_casePrepared = true;
+        return;
+    }
+
+    runBatch();
+    if (m_blocksDone >= s_warmupBlocks + m_blocksPerCase)
+    {
+        finishCase();
+        m_currentCaseIdx++;
+        m_casePrepared = false;
+    }
+}
+
+//==============================================================================
+void MemaBenchRunner::prepareCase(const Case& benchCase)
+{
+    m_blocksDone = 0;
+    m_blocksPerCase = std::max(s_minBlocksPerCase, m_options.samplesPerCase / benchCase.blockSize);
+    m_nsPerSample.clear();
+    m_nsPerSample.reserve(size_t(m_blocksPerCase));
+    m_blockBuffer.setSize(benchCase.channelCount, benchCase.blockSize, false, true, false);
+    m_sourceReadPos = 0;
+
+    if (Stage::ProcessBlock == benchCase.stage)
+    {
+        m_analyzer.reset();
+
+        m_processor->setChannelCounts(std::uint16_t(benchCase.channelCount), std::uint16_t(benchCase.channelCount));
+        m_processor->prepareToPlay(m_options.sampleRate, benchCase.blockSize);
+
+        // sparse is the 1:1 default routing, dense enables every node with a gain that keeps the output level in range
+        m_processor->initializeCtrlValuesToUnity();
+        if (benchCase.variant)
+        {
+            auto gain = 1.0f / float(benchCase.channelCount);
+            for (auto in = std::uint16_t(1); in <= benchCase.channelCount; in++)
+            {
+                for (auto out = std::uint16_t(1); out <= benchCase.channelCount; out++)
+                {
+                    m_processor->setMatrixCrosspointEnabledValue(in, out, true);
+                    m_processor->setMatrixCrosspointFactorValue(in, out, gain);
+                }
+            }
+        }
+    }
+    else
+    {
+        m_analyzer = std::make_unique<Mema::ProcessorDataAnalyzer>();
+        m_analyzer->setUseProcessingTypes(true, false, benchCase.variant);
+        m_analyzer->initializeParameters(m_options.sampleRate, benchCase.blockSize);
+    }
+}
+
+void MemaBenchRunner::runBatch()
+{
+    auto const& benchCase = m_cases[m_currentCaseIdx];
+    auto batchBlocks = std::max(1, s_samplesPerBatch / benchCase.blockSize);
+    auto ticksToNs = 1.0e9 / double(juce::Time::getHighResolutionTicksPerSecond());
+
+    for (auto i = 0; i < batchBlocks && m_blocksDone < s_warmupBlocks + m_blocksPerCase; i++, m_blocksDone++)
+    {
+        refillBlockBuffer();
+
+        auto startTicks = juce::Time::getHighResolutionTicks();
+        if (Stage::ProcessBlock == benchCase.stage)
+            m_processor->processBlock(m_blockBuffer, m_midiBuffer);
+        else
+            m_analyzer->analyzeData(m_blockBuffer);
+        auto elapsedTicks = juce::Time::getHighResolutionTicks() - startTicks;
+
+        if (m_blocksDone >= s_warmupBlocks)
+            m_nsPerSample.push_back(double(elapsedTicks) * ticksToNs / double(benchCase.blockSize));
+    }
+}
+
+void MemaBenchRunner::finishCase()
+{
+    auto const& benchCase = m_cases[m_currentCaseIdx];
+
+    auto result = Result();
+    result.stage = (Stage::ProcessBlock == benchCase.stage) ? "processBlock" : "analyzeData";
+    if (Stage::ProcessBlock == benchCase.stage)
+        result.variant = benchCase.variant ? "dense" : "sparse";
+    else
+        result.variant = benchCase.variant ? "spectrum" : "level";
+    result.channelCount = benchCase.channelCount;
+    result.blockSize = benchCase.blockSize;
+    result.nsPerSample = MemaBenchStatistics::fromSamples(m_nsPerSample);
+
+    printResult(result);
+    m_results.push_back(result);
+}
+
+void MemaBenchRunner::refillBlockBuffer()
+{
+    auto blockSize = m_blockBuffer.getNumSamples();
+    if (m_sourceReadPos + blockSize > m_sourceSignal.getNumSamples())
+        m_sourceReadPos = 0;
+
+    for (auto channel = 0; channel < m_blockBuffer.getNumChannels(); channel++)
+        m_blockBuffer.copyFrom(channel, 0, m_sourceSignal, channel, m_sourceReadPos, blockSize);
+
+    m_sourceReadPos += blockSize;
+}
+
+//==============================================================================
+void MemaBenchRunner::printResult(const Result& result)
+{
+    auto const& stats = result.nsPerSample;
+    auto cells = juce::StringArray({ result.stage, result.variant, juce::String(result.channelCount), juce::String(result.blockSize), juce::String(stats.count) });
+    for (auto const value : { stats.mean, stats.p50, stats.p90, stats.p99, stats.max })
+        cells.add(juce::String(value, m_options.csvOutput ? 3 : 2));
+
+    if (m_options.csvOutput)
+        MemaBenchOutput::printLine(cells.joinIntoString(","));
+    else
+        MemaBenchOutput::printLine(MemaBenchOutput::formatTableRow(cells, s_columnWidths, 2));
+}
@@ -0,0 +1,136 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#include "MemaBenchCommon.h"
+
+namespace Mema
+{
+    class MemaProcessor;
+    class ProcessorDataAnalyzer;
+}
+
+/**
+ * @class MemaBenchRunner
+ * @brief Micro-benchmark suite for the audio processing core of Mema.
+ *
+ * MemaBenchRunner drives the hot paths of the **Mema tool suite** with synthetic audio,
+ * without any audio device, and reports the time spent per sample:
+ * - **processBlock** — `Mema::MemaProcessor::processBlock` (input mutes, matrix, output mutes)
+ *   with sparse (1:1 diagonal) and dense (every crosspoint enabled) routing.
+ * - **analyzeData** — `Mema::ProcessorDataAnalyzer::analyzeData` with level metering only
+ *   and with additional spectrum analysis.
+ *
+ * Every combination of the configured channel counts (square matrix, inputs == outputs) and
+ * block sizes is one case.  A case runs a number of warmup blocks and then times every single
+ * block, the result table lists mean and p50/p90/p99/max in nanoseconds per sample frame.
+ *
+ * The suite runs on the message thread, split into batches driven by a timer.  The buffer
+ * messages the processor posts for its analyzers and network clients are handled between two
+ * batches, so they neither pile up nor add to the measured times.  The processor instance is a
+ * full one, i.e. its TCP server and service announcement are active while the suite is running.
+ */
+class MemaBenchRunner : private juce::Timer
+{
+public:
+    /** @brief Timing statistics of a single case, in nanoseconds per sample frame. */
+    struct Result
+    {
+        juce::String        stage;
+        juce::String        variant;
+        int                 channelCount = 0;
+        int                 blockSize = 0;
+        MemaBenchStatistics nsPerSample;
+    };
+
+public:
+    /** @param onFinished   Called on the message thread once all cases are done, with the suggested process exit code. */
+    MemaBenchRunner(const MemaBenchOptions& options, std::function<void(int)> onFinished);
+    ~MemaBenchRunner() override;
+
+    //==============================================================================
+    /** @brief Prints the system information and table header and starts the first case. */
+    void start();
+
+    //==============================================================================
+    const std::vector<Result>& getResults() const { return m_results; };
+
+private:
+    //==============================================================================
+    /** @brief Stage a case belongs to, the variant selects routing (processBlock) or spectrum analysis (analyzeData). */
+    enum class Stage
+    {
+        ProcessBlock,
+        AnalyzeData
+    };
+
+    /** @brief One channel count / block size / variant combination. */
+    struct Case
+    {
+        Stage   stage = Stage::ProcessBlock;
+        bool    variant = false;    ///< Dense routing for processBlock, spectrum analysis for analyzeData.
+        int     channelCount = 0;
+        int     blockSize = 0;
+    };
+
+    //==============================================================================
+    void timerCallback() override;
+
+    //==============================================================================
+    void prepareCase(const Case& benchCase);
+    void runBatch();
+    void finishCase();
+    /** @brief Refills the block buffer from the pseudo random source signal, at a new offset for every block. */
+    void refillBlockBuffer();
+
+    //==============================================================================
+    void printResult(const Result& result);
+
+    //==============================================================================
+    static constexpr int s_warmupBlocks = 16;           ///< Untimed blocks at the start of each case.
+    static constexpr int s_minBlocksPerCase = 64;       ///< Lower limit of timed blocks, for meaningful percentiles with large blocks.
+    static constexpr int s_samplesPerBatch = 8192;      ///< Sample frames processed per timer tick before the message loop gets to run again.
+    static constexpr int s_sourceSignalLength = 65536;  ///< Length of the synthetic source signal the blocks are cut from.
+    inline static const std::vector<int> s_columnWidths = { 14, 9, 5, 7, 8, 9, 9, 9, 9, 9 };
+
+    MemaBenchOptions                                m_options;
+    std::function<void(int)>                        m_onFinished;
+
+    std::unique_ptr<Mema::MemaProcessor>            m_processor;
+    std::unique_ptr<Mema::ProcessorDataAnalyzer>    m_analyzer;
+
+    std::vector<Case>                               m_cases;
+    size_t                                          m_currentCaseIdx = 0;
+    bool                                            m_casePrepared = false;
+    int                                             m_blocksDone = 0;
+    int                                             m_blocksPerCase = 0;
+    std::vector<double>                             m_nsPerSample;
+
+    juce::AudioBuffer<float>                        m_sourceSignal;
+    juce::AudioBuffer<float>                        m_blockBuffer;
+    juce::MidiBuffer                                m_midiBuffer;
+    int                                             m_sourceReadPos = 0;
+
+    std::vector<Result>                             m_results;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MemaBenchRunner)
+};
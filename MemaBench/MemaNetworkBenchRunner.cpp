@@ -0,0 +1,528 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#include "MemaNetworkBenchRunner.h"
+
+#include "MemaAppConfiguration.h"
+#include "MemaProcessor/MemaMessages.h"
+#include "MemaProcessor/MemaProcessor.h"
+#include "MemaProcessor/MemaServiceData.h"
+
+#if JUCE_WINDOWS
+ #ifndef NOMINMAX
+  #define NOMINMAX
+ #endif
+ #include <windows.h>
+#else
+ #include <time.h>
+#endif
+
+
+//==============================================================================
+/**
+ * Client connection as Mema.Mo / Mema.Re would open it, but with its callbacks on the connection
+ * thread, to neither wait for nor load the message thread the server core relays on.
+ */
+class MemaNetworkBenchRunner::SimulatedClient : public juce::InterprocessConnection
+{
+public:
+    SimulatedClient(MemaNetworkBenchRunner& owner, const std::vector<Mema::SerializableMessage::SerializableMessageType>& trafficTypes)
+        : juce::InterprocessConnection(false), m_owner(owner), m_trafficTypes(trafficTypes)
+    {
+    }
+    ~SimulatedClient() override
+    {
+        disconnect();
+    }
+
+    //==============================================================================
+    void connectionMade() override
+    {
+        // without a selection the server relays everything, which is what the 'all' subscription is about
+        if (!m_trafficTypes.empty())
+            sendMessage(std::make_unique<Mema::DataTrafficTypeSelectionMessage>(m_trafficTypes)->getSerializedMessage());
+    }
+
+    void connectionLost() override
+    {
+    }
+
+    void messageReceived(const juce::MemoryBlock& message) override
+    {
+        auto receivedTicks = juce::Time::getHighResolutionTicks();
+        auto threadCpuSeconds = getCurrentThreadCpuSeconds();
+
+        auto knownMessage = Mema::SerializableMessage::initFromMemoryBlock(message);
+
+        auto trafficClass = TrafficClassCount;
+        auto stream = 0;
+        auto sequenceNumber = 0;
+        if (auto const abm = dynamic_cast<const Mema::AudioBufferMessage*>(knownMessage))
+        {
+            trafficClass = Audio;
+            stream = (Mema::AudioBufferMessage::FlowDirection::Input == abm->getFlowDirection()) ? 0 : 1;
+            auto const& buffer = abm->getAudioBuffer();
+            if (buffer.getNumChannels() > 0 && buffer.getNumSamples() > 0)
+                sequenceNumber = juce::roundToInt(buffer.getSample(0, 0));
+        }
+        else if (auto const cpm = dynamic_cast<const Mema::ControlParametersMessage*>(knownMessage))
+        {
+            trafficClass = Control;
+            auto const& crosspointValues = cpm->getCrosspointValues();
+            auto inputIter = crosspointValues.find(std::uint16_t(s_controlInput));
+            if (crosspointValues.end() != inputIter)
+            {
+                auto outputIter = inputIter->second.find(std::uint16_t(s_controlOutput));
+                if (inputIter->second.end() != outputIter)
+                    sequenceNumber = factorToSequenceNumber(outputIter->second);
+            }
+        }
+        Mema::SerializableMessage::freeMessageData(knownMessage);
+
+        const juce::ScopedLock sl(m_statisticsLock);
+        if (!m_collecting || TrafficClassCount == trafficClass)
+            return;
+
+        if (m_firstThreadCpuSeconds < 0.0)
+            m_firstThreadCpuSeconds = threadCpuSeconds;
+
+        auto& statistics = m_statistics[trafficClass];
+        statistics.messageCount++;
+        statistics.byteCount += message.getSize();
+
+        auto sendTicks = m_owner.getSendTicks(trafficClass, sequenceNumber);
+        if (0 != sendTicks)
+        {
+            // messages of a stream arrive in order, a gap is what the server discarded when the send queue clipped
+            auto& lastSequenceNumber = m_lastSequenceNumbers[size_t(trafficClass)][size_t(stream)];
+            if (sequenceNumber > lastSequenceNumber + 1)
+                statistics.droppedCount += std::uint64_t(sequenceNumber - lastSequenceNumber - 1);
+            lastSequenceNumber = std::max(lastSequenceNumber, sequenceNumber);
+
+            statistics.latenciesUs.push_back(double(receivedTicks - sendTicks) * 1.0e6 / double(juce::Time::getHighResolutionTicksPerSecond()));
+        }
+
+        m_lastThreadCpuSeconds = getCurrentThreadCpuSeconds();
+    }
+
+    //==============================================================================
+    /** @brief Discards what was received so far and starts collecting statistics. */
+    void startCollecting(size_t expectedLatencyCount)
+    {
+        const juce::ScopedLock sl(m_statisticsLock);
+        for (auto& statistics : m_statistics)
+        {
+            statistics = TrafficStatistics();
+            statistics.latenciesUs.reserve(expectedLatencyCount);
+        }
+        for (auto& lastSequenceNumbers : m_lastSequenceNumbers)
+            lastSequenceNumbers.fill(0);
+        m_firstThreadCpuSeconds = -1.0;
+        m_lastThreadCpuSeconds = -1.0;
+        m_collecting = true;
+    }
+
+    /** @brief Stops collecting, the statistics are available through getStatistics afterwards. */
+    void stopCollecting()
+    {
+        const juce::ScopedLock sl(m_statisticsLock);
+        m_collecting = false;
+    }
+
+    /** @brief Returns the statistics of @p trafficClass, only valid after stopCollecting. */
+    TrafficStatistics& getStatistics(TrafficClass trafficClass) { return m_statistics[trafficClass]; };
+
+    /** @brief Returns the CPU time the connection thread consumed between the first and the last collected message. */
+    double getCollectedThreadCpuSeconds() const { return (m_firstThreadCpuSeconds < 0.0) ? 0.0 : (m_lastThreadCpuSeconds - m_firstThreadCpuSeconds); };
+
+private:
+    MemaNetworkBenchRunner&                                             m_owner;
+    std::vector<Mema::SerializableMessage::SerializableMessageType>    m_trafficTypes;
+
+    juce::CriticalSection                                               m_statisticsLock;
+    bool                                                                m_collecting = false;
+    std::array<TrafficStatistics, TrafficClassCount>                    m_statistics;
+    std::array<std::array<int, 2>, TrafficClassCount>                   m_lastSequenceNumbers{};   ///< Per traffic class and stream (input/output buffers).
+    double                                                              m_firstThreadCpuSeconds = -1.0;
+    double                                                              m_lastThreadCpuSeconds = -1.0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SimulatedClient)
+};
+
+
+//==============================================================================
+/**
+ * Stands in for the audio device, calls the processor's device callback in real time with noise
+ * that carries the block sequence number in its first sample.
+ */
+class MemaNetworkBenchRunner::AudioCallbackThread : public juce::Thread
+{
+public:
+    AudioCallbackThread(MemaNetworkBenchRunner& owner, Mema::MemaProcessor& processor, int channelCount, int blockSize, double sampleRate)
+        : juce::Thread("Mema.Bench audio callback"), m_owner(owner), m_processor(processor), m_blockDurationMs(1000.0 * double(blockSize) / sampleRate)
+    {
+        auto random = juce::Random(0x4d656d61);
+        m_inputBuffer.setSize(channelCount, blockSize, false, true, false);
+        for (auto channel = 0; channel < channelCount; channel++)
+            for (auto i = 0; i < blockSize; i++)
+                m_inputBuffer.setSample(channel, i, random.nextFloat() - 0.5f);
+        m_outputBuffer.setSize(channelCount, blockSize, false, true, false);
+    }
+    ~AudioCallbackThread() override
+    {
+        stopThread(1000);
+    }
+
+    void run() override
+    {
+        auto nextBlockMs = juce::Time::getMillisecondCounterHiRes();
+        auto sequenceNumber = 0;
+        while (!threadShouldExit() && ++sequenceNumber < m_owner.m_sequenceCapacity)
+        {
+            m_inputBuffer.setSample(0, 0, float(sequenceNumber));
+            m_owner.m_sendTicks[Audio][size_t(sequenceNumber)].store(juce::Time::getHighResolutionTicks());
+            m_processor.audioDeviceIOCallbackWithContext(m_inputBuffer.getArrayOfReadPointers(), m_inputBuffer.getNumChannels(),
+                m_outputBuffer.getArrayOfWritePointers(), m_outputBuffer.getNumChannels(), m_inputBuffer.getNumSamples(), {});
+
+            nextBlockMs += m_blockDurationMs;
+            auto waitMs = nextBlockMs - juce::Time::getMillisecondCounterHiRes();
+            if (waitMs >= 1.0)
+                wait(int(waitMs));
+            else if (waitMs < -100.0)
+                nextBlockMs = juce::Time::getMillisecondCounterHiRes(); // a stall (e.g. swapping) is no reason to burst afterwards
+        }
+    }
+
+private:
+    MemaNetworkBenchRunner&     m_owner;
+    Mema::MemaProcessor&        m_processor;
+    double                      m_blockDurationMs = 0.0;
+    juce::AudioBuffer<float>    m_inputBuffer;
+    juce::AudioBuffer<float>    m_outputBuffer;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioCallbackThread)
+};
+
+
+//==============================================================================
+MemaNetworkBenchRunner::MemaNetworkBenchRunner(const MemaBenchOptions& options, std::function<void(int)> onFinished)
+    : m_options(options), m_onFinished(std::move(onFinished))
+{
+    for (auto const clientCount : m_options.clientCounts)
+        for (auto const channelCount : m_options.networkChannelCounts)
+            m_cases.push_back({ clientCount, channelCount });
+}
+
+MemaNetworkBenchRunner::~MemaNetworkBenchRunner()
+{
+    stopTimer();
+    m_audioCallbackThread.reset();
+    m_clients.clear();
+}
+
+void MemaNetworkBenchRunner::start()
+{
+    MemaBenchOutput::printSystemInfo();
+
+    // the clients connect to whatever listens on the port, that must not be another Mema instance
+    {
+        juce::StreamingSocket portProbe;
+        if (!portProbe.createListener(Mema::ServiceData::getConnectionPort()))
+        {
+            MemaBenchOutput::printLine("Port " + juce::String(Mema::ServiceData::getConnectionPort()) + " is in use, quit running Mema instances first");
+            if (m_onFinished)
+                m_onFinished(1);
+            return;
+        }
+    }
+
+    if (m_options.csvOutput)
+        MemaBenchOutput::printLine("subscription,traffic,clients,channels,blocksize,msgs_per_s,mb_per_s,mean_us,p50_us,p90_us,p99_us,max_us,dropped,client_cpu_pct,process_cpu_pct");
+    else
+        MemaBenchOutput::printLine(MemaBenchOutput::formatTableRow({ "subscr", "traffic", "clients", "ch", "block", "msgs/s", "MB/s", "mean", "p50", "p90", "p99", "max", "dropped", "cli cpu%", "cpu%" }, s_columnWidths, 2) + "  [latency us]");
+
+    // the processor is fed by the simulated audio callback instead of an audio device, the minimal config keeps the device section unset
+    auto stateXml = juce::XmlElement(Mema::MemaAppConfiguration::getTagName(Mema::MemaAppConfiguration::TagID::PROCESSORCONFIG));
+    stateXml.createNewChildElement(Mema::MemaAppConfiguration::getTagName(Mema::MemaAppConfiguration::TagID::INPUTMUTES))->addTextElement("1,0");
+    stateXml.createNewChildElement(Mema::MemaAppConfiguration::getTagName(Mema::MemaAppConfiguration::TagID::OUTPUTMUTES))->addTextElement("1,0");
+    stateXml.createNewChildElement(Mema::MemaAppConfiguration::getTagName(Mema::MemaAppConfiguration::TagID::CROSSPOINTGAINS))->addTextElement("1,1,1,1");
+    m_processor = std::make_unique<Mema::MemaProcessor>(&stateXml);
+
+    m_currentCaseIdx = 0;
+    m_phase = Phase::Idle;
+    startTimer(5);
+}
+
+//==============================================================================
+void MemaNetworkBenchRunner::timerCallback()
+{
+    auto nowMs = juce::Time::getMillisecondCounterHiRes();
+    auto phaseMs = nowMs - m_phaseStartMs;
+
+    switch (m_phase)
+    {
+    case Phase::Idle:
+        if (m_currentCaseIdx >= m_cases.size())
+        {
+            stopTimer();
+            m_processor.reset();
+            if (m_onFinished)
+                m_onFinished(0);
+            return;
+        }
+        if (!prepareCase(m_cases[m_currentCaseIdx]))
+        {
+            stopTimer();
+            m_clients.clear();
+            m_processor.reset();
+            if (m_onFinished)
+                m_onFinished(1);
+            return;
+        }
+        m_phase = Phase::Connecting;
+        m_phaseStartMs = nowMs;
+        break;
+    case Phase::Connecting:
+        if (phaseMs >= s_settleTimeMs)
+            startRunning();
+        break;
+    case Phase::Running:
+        while (m_options.controlRate > 0 && nowMs >= m_nextControlChangeMs)
+        {
+            sendControlChange();
+            m_nextControlChangeMs += 1000.0 / double(m_options.controlRate);
+        }
+        if (nowMs - m_runStartMs >= 1000.0 * double(m_options.secondsPerNetworkCase))
+        {
+            m_audioCallbackThread.reset();
+            m_runEndMs = juce::Time::getMillisecondCounterHiRes();
+            m_runEndProcessCpuSeconds = getProcessCpuSeconds();
+            m_phase = Phase::Draining;
+            m_phaseStartMs = m_runEndMs;
+        }
+        break;
+    case Phase::Draining:
+        if (phaseMs >= s_drainTimeMs)
+        {
+            finishCase();
+            m_phase = Phase::Disconnecting;
+            m_phaseStartMs = nowMs;
+        }
+        break;
+    case Phase::Disconnecting:
+        // gives the server the time to clean up the closed connections before the next case connects
+        if (phaseMs >= s_settleTimeMs)
+        {
+            m_currentCaseIdx++;
+            m_phase = Phase::Idle;
+        }
+        break;
+    }
+}
+
+//==============================================================================
+bool MemaNetworkBenchRunner::prepareCase(const Case& benchCase)
+{
+    m_processor->setChannelCounts(std::uint16_t(benchCase.channelCount), std::uint16_t(benchCase.channelCount));
+    m_processor->prepareToPlay(m_options.sampleRate, m_options.networkBlockSize);
+    m_processor->initializeCtrlValuesToUnity();
+
+    // one slot per block and control change of the run, plus headroom for timing jitter
+    m_sequenceCapacity = int(double(m_options.secondsPerNetworkCase) * (m_options.sampleRate / double(m_options.networkBlockSize) + double(m_options.controlRate))) + 256;
+    for (auto& sendTicks : m_sendTicks)
+    {
+        sendTicks = std::make_unique<std::atomic<juce::int64>[]>(size_t(m_sequenceCapacity));
+        for (auto i = 0; i < m_sequenceCapacity; i++)
+            sendTicks[size_t(i)].store(0);
+    }
+
+    auto monitorTrafficTypes = std::vector<Mema::SerializableMessage::SerializableMessageType>({
+        Mema::SerializableMessage::EnvironmentParameters,
+        Mema::SerializableMessage::ReinitIOCount,
+        Mema::SerializableMessage::AnalyzerParameters,
+        Mema::SerializableMessage::AudioInputBuffer,
+        Mema::SerializableMessage::AudioOutputBuffer });
+    auto remoteTrafficTypes = std::vector<Mema::SerializableMessage::SerializableMessageType>({
+        Mema::SerializableMessage::EnvironmentParameters,
+        Mema::SerializableMessage::ReinitIOCount,
+        Mema::SerializableMessage::ControlParameters,
+        Mema::SerializableMessage::PluginParameterInfos,
+        Mema::SerializableMessage::PluginParameterValue,
+        Mema::SerializableMessage::PluginParameterValues,
+        Mema::SerializableMessage::PluginProcessingState });
+
+    for (auto i = 0; i < benchCase.clientCount; i++)
+    {
+        auto trafficTypes = std::vector<Mema::SerializableMessage::SerializableMessageType>();
+        switch (m_options.subscription)
+        {
+        case MemaBenchOptions::Subscription::Monitor:
+            trafficTypes = monitorTrafficTypes;
+            break;
+        case MemaBenchOptions::Subscription::Remote:
+            trafficTypes = remoteTrafficTypes;
+            break;
+        case MemaBenchOptions::Subscription::Mixed:
+            trafficTypes = (0 == i % 2) ? monitorTrafficTypes : remoteTrafficTypes;
+            break;
+        case MemaBenchOptions::Subscription::All:
+        default:
+            break;
+        }
+
+        auto client = std::make_unique<SimulatedClient>(*this, trafficTypes);
+        if (!client->connectToSocket("127.0.0.1", Mema::ServiceData::getConnectionPort(), s_connectTimeoutMs))
+        {
+            MemaBenchOutput::printLine("Client " + juce::String(i + 1) + " of " + juce::String(benchCase.clientCount) + " failed to connect");
+            return false;
+        }
+        m_clients.push_back(std::move(client));
+    }
+
+    return true;
+}
+
+void MemaNetworkBenchRunner::startRunning()
+{
+    auto expectedLatencyCount = size_t(m_sequenceCapacity) * 2;
+    for (auto const& client : m_clients)
+        client->startCollecting(expectedLatencyCount);
+
+    m_controlSequenceNumber = 0;
+    m_runStartMs = juce::Time::getMillisecondCounterHiRes();
+    m_nextControlChangeMs = m_runStartMs;
+    m_runStartProcessCpuSeconds = getProcessCpuSeconds();
+
+    auto const& benchCase = m_cases[m_currentCaseIdx];
+    m_audioCallbackThread = std::make_unique<AudioCallbackThread>(*this, *m_processor, benchCase.channelCount, m_options.networkBlockSize, m_options.sampleRate);
+    m_audioCallbackThread->startThread(juce::Thread::Priority::highest);
+
+    m_phase = Phase::Running;
+    m_phaseStartMs = m_runStartMs;
+}
+
+void MemaNetworkBenchRunner::sendControlChange()
+{
+    if (m_controlSequenceNumber + 1 >= m_sequenceCapacity)
+        return;
+
+    m_controlSequenceNumber++;
+    m_sendTicks[Control][size_t(m_controlSequenceNumber)].store(juce::Time::getHighResolutionTicks());
+    m_processor->setMatrixCrosspointFactorValue(std::uint16_t(s_controlInput), std::uint16_t(s_controlOutput), sequenceNumberToFactor(m_controlSequenceNumber));
+}
+
+void MemaNetworkBenchRunner::finishCase()
+{
+    auto const& benchCase = m_cases[m_currentCaseIdx];
+    auto runSeconds = std::max(0.001, (m_runEndMs - m_runStartMs) / 1000.0);
+
+    auto clientCpuSeconds = 0.0;
+    for (auto const& client : m_clients)
+    {
+        client->stopCollecting();
+        clientCpuSeconds += client->getCollectedThreadCpuSeconds();
+    }
+    auto clientCpuPercent = m_clients.empty() ? 0.0 : 100.0 * clientCpuSeconds / double(m_clients.size()) / runSeconds;
+    auto processCpuPercent = 100.0 * (m_runEndProcessCpuSeconds - m_runStartProcessCpuSeconds) / runSeconds;
+
+    for (auto const trafficClass : { Audio, Control })
+    {
+        auto messageCount = std::uint64_t(0);
+        auto byteCount = std::uint64_t(0);
+        auto droppedCount = std::uint64_t(0);
+        auto latenciesUs = std::vector<double>();
+        for (auto const& client : m_clients)
+        {
+            auto& statistics = client->getStatistics(trafficClass);
+            messageCount += statistics.messageCount;
+            byteCount += statistics.byteCount;
+            droppedCount += statistics.droppedCount;
+            latenciesUs.insert(latenciesUs.end(), statistics.latenciesUs.begin(), statistics.latenciesUs.end());
+        }
+        auto latencyStatistics = MemaBenchStatistics::fromSamples(latenciesUs);
+
+        auto cells = juce::StringArray({ MemaBenchOptions::getSubscriptionName(m_options.subscription), juce::String(Audio == trafficClass ? "audio" : "control"),
+            juce::String(benchCase.clientCount), juce::String(benchCase.channelCount), juce::String(m_options.networkBlockSize),
+            juce::String(double(messageCount) / runSeconds, 1), juce::String(double(byteCount) / runSeconds / (1024.0 * 1024.0), 2) });
+        for (auto const value : { latencyStatistics.mean, latencyStatistics.p50, latencyStatistics.p90, latencyStatistics.p99, latencyStatistics.max })
+            cells.add(juce::String(value, 1));
+        cells.add(juce::String(juce::int64(droppedCount)));
+        cells.add(juce::String(clientCpuPercent, 1));
+        cells.add(juce::String(processCpuPercent, 1));
+
+        if (m_options.csvOutput)
+            MemaBenchOutput::printLine(cells.joinIntoString(","));
+        else
+            MemaBenchOutput::printLine(MemaBenchOutput::formatTableRow(cells, s_columnWidths, 2));
+    }
+
+    m_clients.clear();
+}
+
+//==============================================================================
+juce::int64 MemaNetworkBenchRunner::getSendTicks(TrafficClass trafficClass, int sequenceNumber) const
+{
+    if (trafficClass >= TrafficClassCount || sequenceNumber <= 0 || sequenceNumber >= m_sequenceCapacity || !m_sendTicks[trafficClass])
+        return 0;
+    return m_sendTicks[trafficClass][size_t(sequenceNumber)].load();
+}
+
+float MemaNetworkBenchRunner::sequenceNumberToFactor(int sequenceNumber)
+{
+    // below 2^20 the quotient is exact in a float and stays in the valid gain range
+    return float(sequenceNumber) / float(1 << 20);
+}
+
+int MemaNetworkBenchRunner::factorToSequenceNumber(float factor)
+{
+    return juce::roundToInt(factor * float(1 << 20));
+}
+
+//==============================================================================
+double MemaNetworkBenchRunner::getCurrentThreadCpuSeconds()
+{
+#if JUCE_WINDOWS
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+        return 0.0;
+    auto toSeconds = [](const FILETIME& fileTime) { return double((juce::uint64(fileTime.dwHighDateTime) << 32) | fileTime.dwLowDateTime) * 1.0e-7; };
+    return toSeconds(kernelTime) + toSeconds(userTime);
+#else
+    timespec cpuTime;
+    if (0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime))
+        return 0.0;
+    return double(cpuTime.tv_sec) + double(cpuTime.tv_nsec) * 1.0e-9;
+#endif
+}
+
+double MemaNetworkBenchRunner::getProcessCpuSeconds()
+{
+#if JUCE_WINDOWS
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+        return 0.0;
+    auto toSeconds = [](const FILETIME& fileTime) { return double((juce::uint64(fileTime.dwHighDateTime) << 32) | fileTime.dwLowDateTime) * 1.0e-7; };
+    return toSeconds(kernelTime) + toSeconds(userTime);
+#else
+    timespec cpuTime;
+    if (0 != clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpuTime))
+        return 0.0;
+    return double(cpuTime.tv_sec) + double(cpuTime.tv_nsec) * 1.0e-9;
+#endif
+}
@@ -0,0 +1,157 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#include "MemaBenchCommon.h"
+
+namespace Mema
+{
+    class MemaProcessor;
+}
+
+/**
+ * @class MemaNetworkBenchRunner
+ * @brief Loopback throughput and latency benchmark of the Mema network server.
+ *
+ * MemaNetworkBenchRunner runs a full `Mema::MemaProcessor` as server core and connects a number of
+ * simulated Mema.Mo / Mema.Re clients to it over the loopback interface.  Each client sends the
+ * `DataTrafficTypeSelectionMessage` of the configured subscription and decodes every message it
+ * receives with the regular `SerializableMessage` codec, on its own connection thread.
+ *
+ * While a case is running, a simulated audio callback thread feeds `processBlock` in real time and
+ * the message thread changes a disabled crosspoint at the configured control rate.  Both carry a
+ * sequence number (the first sample of channel 1, respectively the crosspoint factor), which lets
+ * every client determine the end-to-end latency of each message and count the ones it never got.
+ * The latter are the messages the server discarded when a connection's send queue clipped.
+ *
+ * Reported per case and traffic class (audio buffers, control parameters):
+ * - messages and MB per second summed over all clients,
+ * - latency mean and p50/p90/p99/max in microseconds,
+ * - dropped messages summed over all clients,
+ * - CPU load of an average client connection thread and of the whole process, in percent of one core.
+ *
+ * The server binds the regular Mema port, the suite refuses to run while it is in use by another
+ * Mema instance.
+ */
+class MemaNetworkBenchRunner : private juce::Timer
+{
+public:
+    /** @param onFinished   Called on the message thread once all cases are done, with the suggested process exit code. */
+    MemaNetworkBenchRunner(const MemaBenchOptions& options, std::function<void(int)> onFinished);
+    ~MemaNetworkBenchRunner() override;
+
+    //==============================================================================
+    /** @brief Prints the system information and table header and starts the first case. */
+    void start();
+
+private:
+    //==============================================================================
+    /** @brief Traffic classes the clients track sequence numbers for. */
+    enum TrafficClass
+    {
+        Audio = 0,
+        Control,
+        TrafficClassCount
+    };
+
+    /** @brief Reception statistics of one client and traffic class. */
+    struct TrafficStatistics
+    {
+        std::uint64_t       messageCount = 0;
+        std::uint64_t       byteCount = 0;
+        std::uint64_t       droppedCount = 0;
+        std::vector<double> latenciesUs;
+    };
+
+    class SimulatedClient;
+    class AudioCallbackThread;
+
+    /** @brief Phases of a single case, advanced by the timer. */
+    enum class Phase
+    {
+        Idle,
+        Connecting,
+        Running,
+        Draining,
+        Disconnecting
+    };
+
+    /** @brief One client count / channel count combination. */
+    struct Case
+    {
+        int clientCount = 0;
+        int channelCount = 0;
+    };
+
+    //==============================================================================
+    void timerCallback() override;
+
+    //==============================================================================
+    bool prepareCase(const Case& benchCase);
+    void startRunning();
+    void sendControlChange();
+    void finishCase();
+
+    //==============================================================================
+    /** @brief Returns the send time of @p sequenceNumber of @p trafficClass in high resolution ticks, or 0 if it is unknown. */
+    juce::int64 getSendTicks(TrafficClass trafficClass, int sequenceNumber) const;
+    /** @brief Returns the crosspoint factor value that encodes @p sequenceNumber, exactly representable as float. */
+    static float sequenceNumberToFactor(int sequenceNumber);
+    static int factorToSequenceNumber(float factor);
+
+    //==============================================================================
+    /** @brief Returns the CPU time the calling thread has consumed so far in seconds. */
+    static double getCurrentThreadCpuSeconds();
+    /** @brief Returns the CPU time the whole process has consumed so far in seconds. */
+    static double getProcessCpuSeconds();
+
+    //==============================================================================
+    static constexpr int s_connectTimeoutMs = 1000;
+    static constexpr int s_settleTimeMs = 500;      ///< Wait after connecting, until the initial state messages of the server are through.
+    static constexpr int s_drainTimeMs = 500;       ///< Wait after the last sent message, until the clients received what is still in flight.
+    static constexpr int s_controlInput = 1;        ///< Crosspoint carrying the control sequence numbers, disabled and thus inaudible.
+    static constexpr int s_controlOutput = 2;
+    inline static const std::vector<int> s_columnWidths = { 8, 9, 8, 5, 7, 10, 9, 9, 9, 9, 9, 10, 9, 10, 8 };
+
+    MemaBenchOptions                                    m_options;
+    std::function<void(int)>                            m_onFinished;
+
+    std::unique_ptr<Mema::MemaProcessor>                m_processor;
+    std::unique_ptr<AudioCallbackThread>                m_audioCallbackThread;
+    std::vector<std::unique_ptr<SimulatedClient>>       m_clients;
+
+    std::vector<Case>                                   m_cases;
+    size_t                                              m_currentCaseIdx = 0;
+    Phase                                               m_phase = Phase::Idle;
+    double                                              m_phaseStartMs = 0.0;
+    double                                              m_runStartMs = 0.0;
+    double                                              m_runEndMs = 0.0;
+    double                                              m_runStartProcessCpuSeconds = 0.0;
+    double                                              m_runEndProcessCpuSeconds = 0.0;
+
+    int                                                 m_sequenceCapacity = 0;
+    std::array<std::unique_ptr<std::atomic<juce::int64>[]>, TrafficClassCount>  m_sendTicks;
+    int                                                 m_controlSequenceNumber = 0;
+    double                                              m_nextControlChangeMs = 0.0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MemaNetworkBenchRunner)
+};
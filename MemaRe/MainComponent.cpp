@@ -56,6 +56,7 @@ MainComponent::MainComponent()
             Mema::SerializableMessage::ControlParameters,
             Mema::SerializableMessage::PluginParameterInfos,
             Mema::SerializableMessage::PluginParameterValue,
+            Mema::SerializableMessage::PluginParameterValues,
             Mema::SerializableMessage::PluginProcessingState };
         m_networkConnection->sendMessage(std::make_unique<Mema::DataTrafficTypeSelectionMessage>(desiredTrafficTypes)->getSerializedMessage());
 
@@ -65,7 +66,11 @@ MainComponent::MainComponent()
         DBG(__FUNCTION__);
 
         if (m_remoteComponent)
+        {
             m_remoteComponent->resetCtrl();
+            m_remoteComponent->setServerSidePanningSupported(false);
+        }
+        m_sceneList.clear();
         
         connectToMema();
 
@@ -75,6 +80,10 @@ MainComponent::MainComponent()
         auto knownMessage = Mema::SerializableMessage::initFromMemoryBlock(message);
         if (auto const epm = dynamic_cast<const Mema::EnvironmentParametersMessage*>(knownMessage))
         {
+            // an older Mema does not pan object positions, the panned crosspoints are sent to it instead
+            if (m_remoteComponent)
+                m_remoteComponent->setServerSidePanningSupported(epm->hasCapability(Mema::EnvironmentParametersMessage::ServerSidePanning));
+
             m_settingsHostLookAndFeelId = epm->getPaletteStyle();
             jassert(m_settingsHostLookAndFeelId >= JUCEAppBasics::CustomLookAndFeel::PS_Dark && m_settingsHostLookAndFeelId <= JUCEAppBasics::CustomLookAndFeel::PS_Light);
 
@@ -84,6 +93,10 @@ MainComponent::MainComponent()
                 onPaletteStyleChange(m_settingsHostLookAndFeelId, false/*do not follow local style any more if a message was received via net once*/);
             }
         }
+        else if (auto const slm = dynamic_cast<const Mema::SceneListMessage*>(knownMessage))
+        {
+            m_sceneList = slm->getSceneList();
+        }
         else if (m_remoteComponent && nullptr != knownMessage && Status::Monitoring == m_currentStatus)
         {
             m_remoteComponent->handleMessage(*knownMessage);
@@ -193,6 +206,20 @@ MainComponent::MainComponent()
         settingsMenu.addSubMenu("Control colour", controlColourSubMenu);
         settingsMenu.addSubMenu("Controls size", constrolsSizeSubMenu);
         settingsMenu.addSeparator();
+        auto connected = m_networkConnection && m_networkConnection->isConnected();
+        juce::PopupMenu sceneCrossfadeSubMenu;
+        for (auto const& scene : m_sceneList)
+            sceneCrossfadeSubMenu.addItem(s_sceneCrossfadeMenuIdOffset + scene.first, scene.second, connected);
+        juce::PopupMenu scenesSubMenu;
+        for (auto const& scene : m_sceneList)
+            scenesSubMenu.addItem(s_sceneRecallMenuIdOffset + scene.first, scene.second, connected);
+        if (!m_sceneList.empty())
+        {
+            scenesSubMenu.addSubMenu("Crossfade to (" + juce::String(s_sceneCrossfadeMs / 1000.0, 1) + " s)", sceneCrossfadeSubMenu, connected);
+            scenesSubMenu.addSeparator();
+        }
+        scenesSubMenu.addItem(MemaReSettingsOption::StoreScene, "Store current state as new scene", connected);
+        settingsMenu.addSubMenu("Scenes", scenesSubMenu);
         settingsMenu.addItem(MemaReSettingsOption::ExternalControl, "External control...", true);
 #if JUCE_WINDOWS || JUCE_MAC
         settingsMenu.addSeparator();
@@ -366,6 +393,8 @@ void MainComponent::handleSettingsMenuResult(int selectedId)
         showExternalControlSettings();
     else if (MemaReSettingsOption::FullscreenWindowMode == selectedId)
         handleSettingsFullscreenModeToggleResult();
+    else if (MemaReSettingsOption::StoreScene == selectedId || s_sceneRecallMenuIdOffset <= selectedId)
+        handleSettingsSceneMenuResult(selectedId);
     else
         jassertfalse; // unhandled menu entry!?
 }
@@ -570,6 +599,19 @@ void MainComponent::toggleFullscreenMode()
         onSetFullscreenWindow(!enabled);
 }
 
+void MainComponent::handleSettingsSceneMenuResult(int selectedId)
+{
+    if (!m_networkConnection || !m_networkConnection->isConnected())
+        return;
+
+    if (MemaReSettingsOption::StoreScene == selectedId)
+        m_networkConnection->sendMessage(std::make_unique<Mema::SceneStoreMessage>(-1, juce::String())->getSerializedMessage());
+    else if (s_sceneCrossfadeMenuIdOffset <= selectedId)
+        m_networkConnection->sendMessage(std::make_unique<Mema::SceneRecallMessage>(std::uint16_t(selectedId - s_sceneCrossfadeMenuIdOffset), s_sceneCrossfadeMs)->getSerializedMessage());
+    else if (s_sceneRecallMenuIdOffset <= selectedId)
+        m_networkConnection->sendMessage(std::make_unique<Mema::SceneRecallMessage>(std::uint16_t(selectedId - s_sceneRecallMenuIdOffset), 0)->getSerializedMessage());
+}
+
 void MainComponent::showExternalControlSettings()
 {
     m_messageBox = std::make_unique<juce::AlertWindow>(
@@ -585,6 +627,7 @@ void MainComponent::showExternalControlSettings()
         m_messageBox->addTextEditor("ADM local port", juce::String(std::get<0>(admOscSettings)), "ADM-OSC port");
         m_messageBox->addTextEditor("ADM remote IP", std::get<1>(admOscSettings).toString(), "Target IP");
         m_messageBox->addTextEditor("ADM remote port", juce::String(std::get<2>(admOscSettings)), "Target port");
+        m_messageBox->addTextEditor("ADM max rate", juce::String(std::get<3>(admOscSettings)), "Max. bundles/s");
     }
 
     //m_messageBox->addTextBlock("\nOCP.1 connection parameters:");
@@ -601,9 +644,12 @@ void MainComponent::showExternalControlSettings()
             auto ADMOSCport = m_messageBox->getTextEditorContents("ADM local port").getIntValue();
             auto ADMOSCremoteIP = juce::IPAddress(m_messageBox->getTextEditorContents("ADM remote IP"));
             auto ADMOSCremotePort = m_messageBox->getTextEditorContents("ADM remote port").getIntValue();
+            auto ADMOSCmaxOutputRate = m_messageBox->getTextEditorContents("ADM max rate").getIntValue();
+            if (ADMOSCmaxOutputRate <= 0)
+                ADMOSCmaxOutputRate = Mema::ADMOSController::s_defaultMaxOutputRate;
             if (m_remoteComponent)
             {
-                m_remoteComponent->setExternalAdmOscSettings(ADMOSCport, ADMOSCremoteIP, ADMOSCremotePort);
+                m_remoteComponent->setExternalAdmOscSettings(ADMOSCport, ADMOSCremoteIP, ADMOSCremotePort, ADMOSCmaxOutputRate);
 
                 if (m_config)
                     m_config->triggerConfigurationDump();
@@ -776,6 +822,7 @@ void MainComponent::performConfigurationDump()
         {
             admOscClientXmlElmement->setAttribute(MemaReAppConfiguration::getAttributeName(MemaReAppConfiguration::AttributeID::IP), std::get<1>(m_remoteComponent->getExternalAdmOscSettings()).toString());
             admOscClientXmlElmement->setAttribute(MemaReAppConfiguration::getAttributeName(MemaReAppConfiguration::AttributeID::PORT), std::get<2>(m_remoteComponent->getExternalAdmOscSettings()));
+            admOscClientXmlElmement->setAttribute(MemaReAppConfiguration::getAttributeName(MemaReAppConfiguration::AttributeID::MAXRATE), std::get<3>(m_remoteComponent->getExternalAdmOscSettings()));
         }
         extCtrlConfigXmlElement->addChildElement(admOscClientXmlElmement.release());
 
@@ -843,6 +890,7 @@ void MainComponent::onConfigUpdated()
         int ADMOSCport = 0;
         juce::IPAddress ADMOSCremoteIP = juce::IPAddress::local();
         int ADMOSCremotePort = 0;
+        int ADMOSCmaxOutputRate = Mema::ADMOSController::s_defaultMaxOutputRate;
 
         auto admOscHostXmlElmement = externalControlConfigState->getChildByName(MemaReAppConfiguration::getTagName(MemaReAppConfiguration::TagID::ADMOSCHOST));
         if (admOscHostXmlElmement)
@@ -853,10 +901,11 @@ void MainComponent::onConfigUpdated()
         {
             ADMOSCremoteIP = juce::IPAddress(admOscClientXmlElmement->getStringAttribute(MemaReAppConfiguration::getAttributeName(MemaReAppConfiguration::AttributeID::IP)));
             ADMOSCremotePort = admOscClientXmlElmement->getIntAttribute(MemaReAppConfiguration::getAttributeName(MemaReAppConfiguration::AttributeID::PORT));
+            ADMOSCmaxOutputRate = admOscClientXmlElmement->getIntAttribute(MemaReAppConfiguration::getAttributeName(MemaReAppConfiguration::AttributeID::MAXRATE), ADMOSCmaxOutputRate);
         }
 
         if (m_remoteComponent)
-            m_remoteComponent->setExternalAdmOscSettings(ADMOSCport, ADMOSCremoteIP, ADMOSCremotePort);
+            m_remoteComponent->setExternalAdmOscSettings(ADMOSCport, ADMOSCremoteIP, ADMOSCremotePort, ADMOSCmaxOutputRate);
     }
 }
 
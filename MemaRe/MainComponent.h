@@ -111,6 +111,7 @@ public:
         ControlsSize_Last = ControlsSize_L,
         ExternalControl,                            ///< Opens the ADM-OSC external-control settings dialog.
         FullscreenWindowMode,                       ///< Toggle between popup and fullscreen window mode.
+        StoreScene,                                 ///< Stores the current Mema state as new scene.
     };
 
 public:
@@ -204,6 +205,7 @@ private:
     void handleSettingsControlsSizeMenuResult(int selectedId);
     void handleSettingsFullscreenModeToggleResult();
     void showExternalControlSettings();
+    void handleSettingsSceneMenuResult(int selectedId);
 
     void setControlColour(const juce::Colour& meteringColour);
     void applyControlColour();
@@ -226,6 +228,10 @@ private:
     std::unique_ptr<MemaClientConnectingComponent>  m_connectingComponent;      ///< Connection-progress panel (Connecting phase).
 
     std::unique_ptr<juce::DrawableButton>           m_settingsButton;           ///< Gear icon that opens the settings popup menu.
+    std::vector<std::pair<std::uint16_t, juce::String>> m_sceneList;        ///< Id and name of the scenes stored in Mema, from the last received SceneListMessage.
+    static constexpr int s_sceneRecallMenuIdOffset = 0x10000;               ///< Settings menu id of the instant recall item of scene 0.
+    static constexpr int s_sceneCrossfadeMenuIdOffset = 0x20000;            ///< Settings menu id of the crossfaded recall item of scene 0.
+    static constexpr std::uint32_t s_sceneCrossfadeMs = 2000;               ///< Crossfade time used by the crossfaded scene recall items.
     std::map<int, std::pair<std::string, int>>      m_settingsItems;            ///< Mapping from menu item ID to {label, MemaReSettingsOption}.
     int                                             m_settingsHostLookAndFeelId = -1; ///< Menu ID assigned to the "Follow host" look-and-feel entry.
 
@@ -92,6 +92,7 @@ public:
         ENABLED,    ///< Boolean flag indicating whether a feature or connection is active.
         IP,         ///< IP address string (used for ADM-OSC remote client address).
         PORT,       ///< UDP/TCP port number.
+        MAXRATE,    ///< Upper limit of outgoing messages per second (used for ADM-OSC client bundles).
     };
     static juce::String getAttributeName(AttributeID ID)
     {
@@ -103,6 +104,8 @@ public:
             return "IP";
         case PORT:
             return "PORT";
+        case MAXRATE:
+            return "MAXRATE";
         default:
             return "-";
         }
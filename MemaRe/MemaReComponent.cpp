@@ -84,7 +84,15 @@ MemaReComponent::MemaReComponent()
         if (onMessageReadyToSend)
             onMessageReadyToSend(std::make_unique<Mema::ControlParametersMessage>(inputMuteStates, outputMuteStates, crosspointStates, crosspointValues)->getSerializedMessage());
         };
-    m_panningCtrlComponent->setExternalControlSettings(std::get<0>(m_externalAdmOscSettings), std::get<1>(m_externalAdmOscSettings), std::get<2>(m_externalAdmOscSettings));
+    m_panningCtrlComponent->onPanningLayoutChanged = [=](const std::map<int, Mema::InputPositionPanner::LayerLayout>& layerLayouts) {
+        if (onMessageReadyToSend)
+            onMessageReadyToSend(std::make_unique<Mema::PanningLayoutMessage>(layerLayouts)->getSerializedMessage());
+        };
+    m_panningCtrlComponent->onInputPositionsChanged = [=](const std::vector<Mema::InputPositionPanner::InputPosition>& inputPositions) {
+        if (onMessageReadyToSend)
+            onMessageReadyToSend(std::make_unique<Mema::ObjectPositionsMessage>(inputPositions)->getSerializedMessage());
+        };
+    m_panningCtrlComponent->setExternalControlSettings(std::get<0>(m_externalAdmOscSettings), std::get<1>(m_externalAdmOscSettings), std::get<2>(m_externalAdmOscSettings), std::get<3>(m_externalAdmOscSettings));
     addChildComponent(m_panningCtrlComponent.get());
 
     m_pluginCtrlComponent = std::make_unique<Mema::PluginControlComponent>();
@@ -261,16 +269,22 @@ const Mema::MemaClientControlComponentBase::ControlsSize MemaReComponent::getCon
         return Mema::MemaClientControlComponentBase::ControlsSize::S;
 }
 
-void MemaReComponent::setExternalAdmOscSettings(const int ADMOSCport, const juce::IPAddress& ADMOSCremoteIP, const int ADMOSCremotePort)
+void MemaReComponent::setServerSidePanningSupported(bool supported)
+{
+    m_panningCtrlComponent->setServerSidePanningSupported(supported);
+}
+
+void MemaReComponent::setExternalAdmOscSettings(const int ADMOSCport, const juce::IPAddress& ADMOSCremoteIP, const int ADMOSCremotePort, const int ADMOSCmaxOutputRate)
 {
     std::get<0>(m_externalAdmOscSettings) = ADMOSCport;
     std::get<1>(m_externalAdmOscSettings) = ADMOSCremoteIP;
     std::get<2>(m_externalAdmOscSettings) = ADMOSCremotePort;
+    std::get<3>(m_externalAdmOscSettings) = ADMOSCmaxOutputRate;
 
-    m_panningCtrlComponent->setExternalControlSettings(ADMOSCport, ADMOSCremoteIP, ADMOSCremotePort);
+    m_panningCtrlComponent->setExternalControlSettings(ADMOSCport, ADMOSCremoteIP, ADMOSCremotePort, ADMOSCmaxOutputRate);
 }
 
-std::tuple<int, juce::IPAddress, int> MemaReComponent::getExternalAdmOscSettings()
+std::tuple<int, juce::IPAddress, int, int> MemaReComponent::getExternalAdmOscSettings()
 {
     return m_externalAdmOscSettings;
 }
@@ -383,6 +397,14 @@ void MemaReComponent::handleMessage(const Message& message)
         m_pluginEnabled = ppim->isPluginEnabled();
         m_pluginPost = ppim->isPluginPost();
 
+        // only remote controllable parameters are shown, so there is no use in receiving value updates for the others
+        std::vector<std::uint16_t> subscribedParameterIndices;
+        for (auto const& parameterInfo : m_pluginParameterInfos)
+            if (parameterInfo.isRemoteControllable)
+                subscribedParameterIndices.push_back(std::uint16_t(parameterInfo.index));
+        if (onMessageReadyToSend)
+            onMessageReadyToSend(std::make_unique<Mema::PluginParameterSubscriptionMessage>(subscribedParameterIndices)->getSerializedMessage());
+
         if (m_pluginCtrlComponent && m_pluginCtrlComponent->isVisible())
         {
             m_pluginCtrlComponent->setPluginName(m_pluginName);
@@ -422,5 +444,21 @@ void MemaReComponent::handleMessage(const Message& message)
 
         resized();
     }
+    else if (auto const ppvsm = dynamic_cast<const Mema::PluginParameterValuesMessage*>(&message))
+    {
+        DBG(juce::String(__FUNCTION__) + " handling PluginParameterValuesMessage (" + juce::String(ppvsm->getParameterValues().size()) + ") ...");
+
+        for (auto const& parameterValue : ppvsm->getParameterValues())
+        {
+            auto parameterInfoIter = std::find_if(m_pluginParameterInfos.begin(), m_pluginParameterInfos.end(), [&parameterValue](const Mema::PluginParameterInfo& info) { return info.index == int(parameterValue.first); });
+            if (parameterInfoIter == m_pluginParameterInfos.end())
+                continue;
+
+            parameterInfoIter->currentValue = parameterValue.second;
+
+            if (m_pluginCtrlComponent && m_pluginCtrlComponent->isVisible())
+                m_pluginCtrlComponent->setParameterValue(parameterValue.first, parameterInfoIter->id.toStdString(), parameterValue.second);
+        }
+    }
 }
 
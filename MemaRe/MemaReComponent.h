@@ -22,6 +22,7 @@
 
 #include "MemaClientCommon/FaderbankControlComponent.h"
 #include "MemaClientCommon/PanningControlComponent.h"
+#include "MemaClientCommon/ADMOSController.h"
 #include "MemaClientCommon/PluginControlComponent.h"
 
 #include <MemaProcessor/MemaPluginParameterInfo.h>
@@ -84,10 +85,13 @@ public:
     /** @brief Returns the current control-element size setting. */
     const Mema::FaderbankControlComponent::ControlsSize getControlsSize();
 
-    /** @brief Configures the ADM-OSC listener port and the remote-controller address used by the panning component. */
-    void setExternalAdmOscSettings(const int ADMOSCport, const juce::IPAddress& ADMOSCremoteIP, const int ADMOSCremotePort);
-    /** @brief Returns the current ADM-OSC settings as {listenPort, remoteIP, remotePort}. */
-    std::tuple<int, juce::IPAddress, int> getExternalAdmOscSettings();
+    /** @brief Tells the panning control whether the connected Mema pans object positions itself, see EnvironmentParametersMessage::Capability. */
+    void setServerSidePanningSupported(bool supported);
+
+    /** @brief Configures the ADM-OSC listener port, the remote-controller address and the outgoing bundle rate limit used by the panning component. */
+    void setExternalAdmOscSettings(const int ADMOSCport, const juce::IPAddress& ADMOSCremoteIP, const int ADMOSCremotePort, const int ADMOSCmaxOutputRate);
+    /** @brief Returns the current ADM-OSC settings as {listenPort, remoteIP, remotePort, maxOutputRate}. */
+    std::tuple<int, juce::IPAddress, int, int> getExternalAdmOscSettings();
 
     //==============================================================================
     /** @brief Lays out the active control component to fill the available area. */
@@ -119,7 +123,7 @@ private:
     std::map<std::uint16_t, std::map<std::uint16_t, bool>>  m_crosspointStates = {};         ///< Crosspoint enable state mirror (input → output → enabled).
     std::map<std::uint16_t, std::map<std::uint16_t, float>> m_crosspointValues = {};         ///< Crosspoint gain value mirror (input → output → linear gain).
 
-    std::tuple<int, juce::IPAddress, int>   m_externalAdmOscSettings = { 4001, juce::IPAddress::local(), 4002 }; ///< ADM-OSC {listenPort, remoteIP, remotePort}.
+    std::tuple<int, juce::IPAddress, int, int>  m_externalAdmOscSettings = { 4001, juce::IPAddress::local(), 4002, Mema::ADMOSController::s_defaultMaxOutputRate }; ///< ADM-OSC {listenPort, remoteIP, remotePort, maxOutputRate}.
 
     std::string                                 m_pluginName;               ///< Cached plugin name from last received PluginParameterInfosMessage.
     std::vector<Mema::PluginParameterInfo>      m_pluginParameterInfos;     ///< Cached parameter infos from last received PluginParameterInfosMessage.
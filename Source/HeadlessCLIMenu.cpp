@@ -185,6 +185,20 @@ void HeadlessCLIMenu::runMainMenu()
         else
             pluginLine = "none";
 
+        // The profiler can be read from any thread, no detour via the message thread needed.
+        auto profile = m_processor.getAudioCallbackProfile();
+        juce::String profileLine = juce::String(juce::roundToInt(profile.getMeanLoad() * 100.0)) + "% load"
+            + "  " + juce::String(juce::int64(profile.deadlineMissCount)) + " misses"
+            + "  " + juce::String(juce::int64(profile.xrunCount)) + " xruns";
+
+        // The network telemetry is thread-safe as well.
+        auto networkTelemetry = m_processor.getNetworkTelemetry();
+        std::uint64_t droppedMessages = 0;
+        for (auto const& connection : networkTelemetry)
+            droppedMessages += connection.getDroppedMessages();
+        juce::String networkLine = juce::String(int(networkTelemetry.size())) + " clients"
+            + "  " + juce::String(juce::int64(droppedMessages)) + " dropped";
+
         printHeader("Configuration");
         std::cout << "  1  Input mutes     [" << numIn  << " ch, " << mutedIn  << " muted]\n";
         std::cout << "  2  Output mutes    [" << numOut << " ch, " << mutedOut << " muted]\n";
@@ -193,6 +207,9 @@ void HeadlessCLIMenu::runMainMenu()
         std::cout << "  5  Plugin          [" << pluginLine << "]\n";
         std::cout << "  6  Load config\n";
         std::cout << "  7  Save config\n";
+        std::cout << "  8  Scenes\n";
+        std::cout << "  9  Audio profile   [" << profileLine << "]\n";
+        std::cout << "  10 Network clients [" << networkLine << "]\n";
         std::cout << "  q  Quit\n";
 
         printPrompt();
@@ -206,6 +223,9 @@ void HeadlessCLIMenu::runMainMenu()
         else if (input == "5") runPluginMenu();
         else if (input == "6") doLoadConfig();
         else if (input == "7") doSaveConfig();
+        else if (input == "8") runScenesMenu();
+        else if (input == "9") runAudioProfileMenu();
+        else if (input == "10") runNetworkClientsMenu();
         else if (input == "q")
         {
             m_quit = true;
@@ -754,6 +774,211 @@ void HeadlessCLIMenu::runPluginMenu()
     }
 }
 
+//==============================================================================
+// Audio profile menu
+//==============================================================================
+
+void HeadlessCLIMenu::runAudioProfileMenu()
+{
+    while (!threadShouldExit() && !m_quit)
+    {
+        auto profile = m_processor.getAudioCallbackProfile();
+
+        printHeader("Audio Profile");
+        if (0 == profile.callbackCount)
+            std::cout << "  No audio callbacks since the last reset.\n";
+        else
+        {
+            std::cout << "  Callbacks        " << profile.callbackCount << "\n";
+            std::cout << "  Deadline         " << juce::String(profile.deadlineUs, 1) << " us\n";
+            std::cout << "  Mean / peak      " << juce::String(profile.getMeanCallbackUs(), 1) << " / " << juce::String(profile.maxCallbackUs, 1) << " us"
+                      << "  (" << juce::roundToInt(profile.getMeanLoad() * 100.0) << "% load)\n";
+            std::cout << "  Deadline misses  " << profile.deadlineMissCount << "\n";
+            std::cout << "  Xruns            " << profile.xrunCount << "\n";
+
+            std::cout << "\n  Mean per stage\n";
+            for (auto stage = 0; stage < AudioCallbackProfiler::StageCount; stage++)
+                std::cout << "  " << std::left << std::setw(14) << AudioCallbackProfiler::getStageName(AudioCallbackProfiler::Stage(stage)) << std::right
+                          << std::setw(10) << juce::String(profile.getMeanStageUs(AudioCallbackProfiler::Stage(stage)), 1) << " us\n";
+
+            // Bars are scaled to the fullest bin, so rare deadline misses stay visible by their count.
+            std::cout << "\n  Callback duration of deadline\n";
+            auto maxBinCount = *std::max_element(profile.histogram.begin(), profile.histogram.end());
+            for (auto bin = 0; bin < AudioCallbackProfiler::s_histogramBinCount; bin++)
+            {
+                auto binCount = profile.histogram[size_t(bin)];
+                auto barLength = maxBinCount > 0 ? int(binCount * 30 / maxBinCount) : 0;
+                std::cout << "  " << std::left << std::setw(10) << AudioCallbackProfiler::getHistogramBinName(bin) << std::right
+                          << std::setw(10) << binCount << "  " << std::string(size_t(barLength), '#') << "\n";
+            }
+        }
+
+        std::cout << "\n  Enter  Refresh\n";
+        std::cout << "  r      Reset\n";
+        std::cout << "\n  b  Back\n";
+
+        printPrompt();
+        auto input = readLine().toLowerCase();
+        if (m_quit || input == "b" || input == "q") break;
+
+        if (input == "r")
+        {
+            m_processor.resetAudioCallbackProfile();
+            std::cout << "  Profile reset, effective with the next audio callback.\n";
+        }
+        else if (input.isNotEmpty())
+            std::cout << "  Unknown option.\n";
+    }
+}
+
+//==============================================================================
+// Network clients menu
+//==============================================================================
+
+void HeadlessCLIMenu::runNetworkClientsMenu()
+{
+    // Previous refresh per connection id, the rates are the difference to it.
+    std::map<int, InterprocessConnectionServerImpl::ConnectionTelemetry> previousTelemetry;
+
+    while (!threadShouldExit() && !m_quit)
+    {
+        auto telemetry = m_processor.getNetworkTelemetry();
+
+        printHeader("Network Clients");
+        if (telemetry.empty())
+            std::cout << "  No clients connected.\n";
+
+        for (auto const& connection : telemetry)
+        {
+            auto previousIter = previousTelemetry.find(connection.connectionId);
+            auto hasPrevious = previousTelemetry.end() != previousIter;
+            auto intervalSeconds = hasPrevious ? connection.connectedSeconds - previousIter->second.connectedSeconds : connection.connectedSeconds;
+            auto sentMessages = connection.getSentMessages();
+            auto meanLatencyUs = sentMessages > 0 ? connection.sendLatencySumUs / double(sentMessages) : 0.0;
+
+            std::cout << "\n  Client " << connection.connectionId << "  connected " << juce::roundToInt(connection.connectedSeconds) << " s"
+                      << "  queue " << connection.queuedMessages << "\n";
+            std::cout << "  Send latency     " << juce::String(meanLatencyUs / 1000.0, 2) << " / " << juce::String(connection.sendLatencyMaxUs / 1000.0, 2) << " ms (mean / peak)\n";
+            std::cout << "  Write stalls     " << connection.writeStallCount << "  (" << juce::String(connection.writeStallSumUs / 1000.0, 1) << " ms total, peak write "
+                      << juce::String(connection.writeMaxUs / 1000.0, 2) << " ms)\n";
+            std::cout << "  Dropped / failed " << connection.getDroppedMessages() << " / " << connection.sendFailures << "\n";
+
+            std::cout << "  " << std::left << std::setw(30) << "Message type" << std::right
+                      << std::setw(10) << "msgs/s" << std::setw(10) << "kB/s" << std::setw(10) << "dropped" << "\n";
+            for (auto typeIdx = 0; typeIdx < InterprocessConnectionServerImpl::s_messageTypeSlotCount; typeIdx++)
+            {
+                auto const& typeCounters = connection.types[size_t(typeIdx)];
+                if (0 == typeCounters.sentMessages && 0 == typeCounters.droppedMessages)
+                    continue;
+
+                auto intervalMessages = typeCounters.sentMessages;
+                auto intervalBytes = typeCounters.sentBytes;
+                if (hasPrevious)
+                {
+                    intervalMessages -= std::min(intervalMessages, previousIter->second.types[size_t(typeIdx)].sentMessages);
+                    intervalBytes -= std::min(intervalBytes, previousIter->second.types[size_t(typeIdx)].sentBytes);
+                }
+                auto messagesPerSecond = intervalSeconds > 0.0 ? double(intervalMessages) / intervalSeconds : 0.0;
+                auto kBytesPerSecond = intervalSeconds > 0.0 ? double(intervalBytes) / 1024.0 / intervalSeconds : 0.0;
+                std::cout << "  " << std::left << std::setw(30) << SerializableMessage::getTypeName(SerializableMessage::SerializableMessageType(typeIdx)) << std::right
+                          << std::setw(10) << juce::String(messagesPerSecond, 1) << std::setw(10) << juce::String(kBytesPerSecond, 1)
+                          << std::setw(10) << typeCounters.droppedMessages << "\n";
+            }
+        }
+
+        previousTelemetry.clear();
+        for (auto const& connection : telemetry)
+            previousTelemetry[connection.connectionId] = connection;
+
+        std::cout << "\n  Enter  Refresh\n";
+        std::cout << "\n  b  Back\n";
+
+        printPrompt();
+        auto input = readLine().toLowerCase();
+        if (m_quit || input == "b" || input == "q") break;
+
+        if (input.isNotEmpty())
+            std::cout << "  Unknown option.\n";
+    }
+}
+
+//==============================================================================
+// Scenes menu
+//==============================================================================
+
+void HeadlessCLIMenu::runScenesMenu()
+{
+    while (!threadShouldExit() && !m_quit)
+    {
+        // The scene store is owned by the message thread, fetch a copy of the list from there.
+        auto sceneList = std::make_shared<std::vector<std::pair<std::uint16_t, juce::String>>>();
+        callOnMessageThread([this, sceneList]()
+        {
+            *sceneList = m_processor.getSceneList();
+        });
+
+        printHeader("Scenes");
+        if (sceneList->empty())
+            std::cout << "  No scenes stored.\n";
+        for (auto const& scene : *sceneList)
+            std::cout << "  " << std::setw(3) << scene.first << "  " << scene.second << "\n";
+
+        std::cout << "\n  r <id> [ms]  Recall scene, optionally crossfaded over [ms] milliseconds\n";
+        std::cout << "  s [name]     Store current state as new scene\n";
+        std::cout << "  d <id>       Delete scene\n";
+        std::cout << "\n  b  Back\n";
+
+        printPrompt();
+        auto input = readLine();
+        if (m_quit) break;
+        auto command = input.upToFirstOccurrenceOf(" ", false, false).toLowerCase();
+        auto arguments = input.fromFirstOccurrenceOf(" ", false, false).trim();
+        if (command == "b" || command == "q") break;
+
+        if (command == "r")
+        {
+            juce::StringArray tokens;
+            tokens.addTokens(arguments, " ", "");
+            tokens.removeEmptyStrings();
+            auto sceneId = tokens.isEmpty() ? 0 : tokens[0].getIntValue();
+            auto crossfadeMs = tokens.size() > 1 ? std::max(0, tokens[1].getIntValue()) : 0;
+            auto recalled = std::make_shared<bool>(false);
+            callOnMessageThread([this, sceneId, crossfadeMs, recalled]()
+            {
+                *recalled = m_processor.recallScene(sceneId, crossfadeMs);
+            });
+            if (*recalled)
+                std::cout << "  Scene " << sceneId << " recalled" << (crossfadeMs > 0 ? " (" + juce::String(crossfadeMs) + " ms crossfade).\n" : juce::String(".\n"));
+            else
+                std::cout << "  Invalid scene id.\n";
+        }
+        else if (command == "s")
+        {
+            auto storedSceneId = std::make_shared<int>(-1);
+            callOnMessageThread([this, arguments, storedSceneId]()
+            {
+                *storedSceneId = m_processor.storeScene(-1, arguments);
+            });
+            if (*storedSceneId > 0)
+                std::cout << "  Stored as scene " << *storedSceneId << ".\n";
+            else
+                std::cout << "  Scene store is full or the name is taken.\n";
+        }
+        else if (command == "d")
+        {
+            auto sceneId = arguments.getIntValue();
+            auto removed = std::make_shared<bool>(false);
+            callOnMessageThread([this, sceneId, removed]()
+            {
+                *removed = m_processor.removeScene(sceneId);
+            });
+            std::cout << (*removed ? "  Scene " + juce::String(sceneId) + " deleted.\n" : juce::String("  Invalid scene id.\n"));
+        }
+        else
+            std::cout << "  Unknown option.\n";
+    }
+}
+
 void HeadlessCLIMenu::runPluginParametersMenu()
 {
     while (!threadShouldExit() && !m_quit)
@@ -949,6 +1174,7 @@ void HeadlessCLIMenu::doLoadConfig()
     {
         auto* config = MemaAppConfiguration::getInstance();
         if (config == nullptr) return;
+        ProcessorStateSnapshot::getDefaultFile().deleteFile(); // loaded routing takes precedence over the autosaved one
         config->SetFlushAndUpdateDisabled();
         config->resetConfigState(std::move(*sharedXml));
         config->ResetFlushAndUpdateDisabled();
@@ -44,6 +44,9 @@ class MemaProcessor;
  * ├── 5  Plugin           enable/disable processing, pre/post, parameter remote control
  * ├── 6  Load config      prompt for a file path; no GUI file chooser
  * ├── 7  Save config      prompt for a file path; no GUI file chooser
+ * ├── 8  Scenes           list, recall (optionally crossfaded), store and delete scenes
+ * ├── 9  Audio profile    audio callback stage timings, deadline histogram and xruns
+ * ├── 10 Network clients  per-client send rates per message type, latency, drops and write stalls
  * └── q  Quit             requests application shutdown
  * ```
  *
@@ -226,6 +229,33 @@ private:
      */
     void runPluginParametersMenu();
 
+    /**
+     * @brief Runs the scene menu.
+     * @details Lists the stored scenes by id and name.  "r <id> [ms]" recalls a scene, with
+     *          an optional crossfade time in milliseconds, "s [name]" stores the current state
+     *          as new scene and "d <id>" deletes one.  The scene list is fetched from and all
+     *          changes are applied on the message thread.
+     */
+    void runScenesMenu();
+
+    /**
+     * @brief Runs the audio profile menu.
+     * @details Shows the audio callback timings since the last reset: mean and peak duration
+     *          against the buffer deadline, the mean per processing stage, the histogram of
+     *          callback durations relative to the deadline and the deadline miss and xrun
+     *          counts.  Enter refreshes the numbers, "r" resets them.
+     */
+    void runAudioProfileMenu();
+
+    /**
+     * @brief Runs the network clients menu.
+     * @details Lists the connected clients with their send queue length, send latency, drops
+     *          and socket write stalls, followed by messages/s and kB/s per message type.  The
+     *          rates are computed between two refreshes, the first display shows the averages
+     *          since the client connected.  Enter refreshes the numbers.
+     */
+    void runNetworkClientsMenu();
+
     ///@}
 
     // -------------------------------------------------------------------------
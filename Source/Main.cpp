@@ -218,9 +218,9 @@ public:
             jassert(memaUIComponent);
             if (memaUIComponent) memaUIComponent->handleEditorSizeChangeRequest(requestedSize);
         };
-        Mema::Mema::getInstance()->onCpuUsageUpdate = [=](int loadPercent) {
+        Mema::Mema::getInstance()->onAudioCallbackProfileUpdate = [=](const Mema::AudioCallbackProfiler::Snapshot& profile) {
             jassert(memaUIComponent);
-            if (memaUIComponent) memaUIComponent->updateCpuUsageBar(loadPercent);
+            if (memaUIComponent) memaUIComponent->updateAudioCallbackProfile(profile);
         };
         Mema::Mema::getInstance()->onNetworkUsageUpdate = [=](std::map<int, std::pair<double, bool>> netLoads) {
             jassert(memaUIComponent);
@@ -303,7 +303,7 @@ public:
         {
             Mema::Mema::getInstance()->onServiceDiscoveryTopologyUpdate = nullptr;
             Mema::Mema::getInstance()->onEditorSizeChangeRequested = nullptr;
-            Mema::Mema::getInstance()->onCpuUsageUpdate = nullptr;
+            Mema::Mema::getInstance()->onAudioCallbackProfileUpdate = nullptr;
             Mema::Mema::getInstance()->onNetworkUsageUpdate = nullptr;
         }
 
@@ -61,6 +61,17 @@ Mema::Mema() :  juce::Timer()
     // do the initial update for the whole application with config contents
     m_config->triggerWatcherUpdate();
 
+    // optional local Prometheus endpoint, e.g. --metricsport=9464
+    for (auto const& parameter : juce::JUCEApplication::getInstance()->getCommandLineParameterArray())
+    {
+        if (parameter.startsWith("--metricsport="))
+        {
+            auto metricsPort = parameter.fromFirstOccurrenceOf("=", false, false).getIntValue();
+            if (metricsPort <= 0 || metricsPort > 65535 || !m_MemaProcessor->startMetricsEndpoint(metricsPort))
+                DBG(juce::String(__FUNCTION__) << " could not start the metrics endpoint on " << parameter);
+        }
+    }
+
     startTimer(500);
 
 #if defined JUCE_IOS
@@ -94,8 +105,8 @@ void Mema::timerCallback()
 {
     if (m_MemaProcessor && m_MemaProcessor->getDeviceManager())
     {
-        if (onCpuUsageUpdate)
-            onCpuUsageUpdate(int(m_MemaProcessor->getDeviceManager()->getCpuUsage() * 100.0));
+        if (onAudioCallbackProfileUpdate)
+            onAudioCallbackProfileUpdate(m_MemaProcessor->getAudioCallbackProfile());
         if (onNetworkUsageUpdate)
             onNetworkUsageUpdate(m_MemaProcessor->getNetworkHealth());
         if (onServiceDiscoveryTopologyUpdate)
@@ -140,7 +151,7 @@ const std::unique_ptr<MemaProcessor>& Mema::getMemaProcessor() const
 void Mema::clearUICallbacks()
 {
     onEditorSizeChangeRequested = nullptr;
-    onCpuUsageUpdate = nullptr;
+    onAudioCallbackProfileUpdate = nullptr;
     onNetworkUsageUpdate = nullptr;
     onServiceDiscoveryTopologyUpdate = nullptr;
     
@@ -254,6 +265,9 @@ void Mema::triggerPromptLoadConfig()
                 return false;
             }
 
+            // the loaded routing must not be overridden by the autosaved snapshot of the previous one
+            ProcessorStateSnapshot::getDefaultFile().deleteFile();
+
             config->SetFlushAndUpdateDisabled();
             if (!config->resetConfigState(std::move(xmlConfig)))
             {
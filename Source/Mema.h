@@ -21,6 +21,7 @@
 #include <JuceHeader.h>
 
 #include "MemaAppConfiguration.h"
+#include "MemaProcessor/AudioCallbackProfiler.h"
 
 #include <ServiceTopologyManager.h>
 
@@ -68,7 +69,7 @@ public:
     const std::unique_ptr<MemaProcessor>& getMemaProcessor() const;
 
     //==========================================================================
-    std::function<void(int)> onCpuUsageUpdate;                                                          ///< Called when CPU load percentage changes.
+    std::function<void(const AudioCallbackProfiler::Snapshot&)> onAudioCallbackProfileUpdate;          ///< Called periodically with the audio callback timings since the last reset.
     std::function<void(const std::map<int, std::pair<double, bool>>&)> onNetworkUsageUpdate;            ///< Called when network traffic metrics change.
     std::function<void(const JUCEAppBasics::SessionServiceTopology&)> onServiceDiscoveryTopologyUpdate; ///< Called when the multicast service topology changes.
     std::function<void(juce::Rectangle<int>)> onEditorSizeChangeRequested;                             ///< Called when the editor requests a resize.
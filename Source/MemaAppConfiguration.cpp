@@ -18,6 +18,8 @@
 
 #include "MemaAppConfiguration.h"
 
+#include "MemaProcessor/ProcessorStateSnapshot.h"
+
 namespace Mema
 {
 
@@ -112,6 +114,9 @@ bool MemaAppConfiguration::ResetToDefault()
 		if (Mema::MemaAppConfiguration::isValid(xmlConfig))
 		{
 
+			// default routing must not be overridden by the autosaved snapshot
+			ProcessorStateSnapshot::getDefaultFile().deleteFile();
+
 			SetFlushAndUpdateDisabled();
 			if (resetConfigState(std::move(xmlConfig)))
 			{
@@ -45,6 +45,9 @@ public:
         OUTPUTMUTES,        ///< Per-channel output mute states.
         CROSSPOINTGAINS,    ///< Crosspoint matrix gain values.
         PLUGINPARAM,        ///< Individual plugin parameter entry.
+        SCENES,             ///< Stored scenes of the processor.
+        SCENE,              ///< Individual stored scene entry.
+        PLUGINPARAMVALUES,  ///< Plugin parameter values of a scene.
     };
     static juce::String getTagName(TagID ID)
     {
@@ -66,6 +69,12 @@ public:
             return "CROSSPOINTGAINS";
         case PLUGINPARAM:
             return "PLUGINPARAM";
+        case SCENES:
+            return "SCENES";
+        case SCENE:
+            return "SCENE";
+        case PLUGINPARAMVALUES:
+            return "PLUGINPARAMVALUES";
         default:
             return "INVALID";
         }
@@ -81,6 +90,8 @@ public:
         IDX,            ///< Channel or parameter index.
         CONTROLLABLE,   ///< Whether a plugin parameter is remotely controllable.
         PARAMORDER,     ///< Comma-separated list of parameter indices defining the display order.
+        ID,             ///< Numeric identifier, e.g. of a scene.
+        NAME,           ///< Display name, e.g. of a scene.
     };
     static juce::String getAttributeName(AttributeID ID)
     {
@@ -100,6 +111,10 @@ public:
             return "CONTROLLABLE";
         case PARAMORDER:
             return "PARAMORDER";
+        case ID:
+            return "ID";
+        case NAME:
+            return "NAME";
         default:
             return "-";
         }
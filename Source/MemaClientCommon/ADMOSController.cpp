@@ -23,10 +23,6 @@ namespace Mema
 {
 
 
-std::mutex  ADMOSController::ADMOSCParameterChangedMessage::m_typeMapMutex;
-std::map<int, std::vector<std::uint16_t>>   ADMOSController::ADMOSCParameterChangedMessage::m_typeMap;
-
-
 //==============================================================================
 ADMOSController::ADMOSController()
 {
@@ -35,10 +31,16 @@ ADMOSController::ADMOSController()
     m_oscReceiver->addListener(this);
 
     m_oscSender = std::make_unique<juce::OSCSender>();
+
+    m_objectStates = std::make_unique<ObjectState[]>(s_maxObjectCount);
 }
 
 ADMOSController::~ADMOSController()
 {
+    if (m_oscReceiver)
+        m_oscReceiver->removeListener(this);
+    cancelPendingUpdate();
+    stopTimer();
 }
 
 bool ADMOSController::startConnection(int receiverOscPort, juce::IPAddress targetIP, int targetPort)
@@ -71,13 +73,43 @@ bool ADMOSController::startConnection(int receiverOscPort, juce::IPAddress targe
 
 void ADMOSController::setNumObjects(int numObjects)
 {
-    m_knownObjNums.resize(numObjects);
+    jassert(numObjects <= s_maxObjectCount);
+    numObjects = juce::jlimit(0, s_maxObjectCount, numObjects);
+
     for (int i = 1; i <= numObjects; i++)
-    {
-        m_knownObjNums[i-1] = i;
         for (std::uint16_t t = ADMOSCParameterType::X; t <= ADMOSCParameterType::Mute; t++)
-            m_objCache[i][t] = ADMOSCParameter(ADMOSCParameterType(t));
+            storeParameter(i, ADMOSCParameter(ADMOSCParameterType(t)), ADMOSCParameterChangeTarget::None);
+
+    // outgoing address patterns are built once here instead of per sent message
+    m_objectAddressPatterns.clear();
+    m_objectAddressPatterns.reserve(size_t(numObjects * s_parameterTypeCount));
+    for (int i = 1; i <= numObjects; i++)
+    {
+        auto objAddrStr = s_admObjDomainStr + juce::String(i);
+        m_objectAddressPatterns.push_back(juce::OSCAddressPattern(objAddrStr));
+        m_objectAddressPatterns.push_back(juce::OSCAddressPattern(objAddrStr + s_xStr));
+        m_objectAddressPatterns.push_back(juce::OSCAddressPattern(objAddrStr + s_yStr));
+        m_objectAddressPatterns.push_back(juce::OSCAddressPattern(objAddrStr + s_zStr));
+        m_objectAddressPatterns.push_back(juce::OSCAddressPattern(objAddrStr + s_xyStr));
+        m_objectAddressPatterns.push_back(juce::OSCAddressPattern(objAddrStr + s_xyzStr));
+        m_objectAddressPatterns.push_back(juce::OSCAddressPattern(objAddrStr + s_widthStr));
+        m_objectAddressPatterns.push_back(juce::OSCAddressPattern(objAddrStr + s_muteStr));
     }
+    jassert(m_objectAddressPatterns.size() == size_t(numObjects * s_parameterTypeCount));
+
+    m_numObjects = numObjects;
+}
+
+void ADMOSController::setMaxOutputRate(int bundlesPerSecond)
+{
+    m_maxOutputRate = juce::jlimit(1, 1000, bundlesPerSecond);
+    if (isTimerRunning())
+        startTimer(1000 / m_maxOutputRate);
+}
+
+int ADMOSController::getMaxOutputRate() const
+{
+    return m_maxOutputRate;
 }
 
 const std::vector<int> ADMOSController::getObjNumsFromObjIdent(const juce::String& objIdent)
@@ -89,7 +121,10 @@ const std::vector<int> ADMOSController::getObjNumsFromObjIdent(const juce::Strin
     {
         if (objIdent == "*")
         {
-            objNums = m_knownObjNums;
+            auto numObjects = m_numObjects.load();
+            objNums.reserve(numObjects);
+            for (auto i = 1; i <= numObjects; i++)
+                objNums.push_back(i);
         }
         else if (objIdent.startsWith("{") && objIdent.endsWith("}"))
         {
@@ -105,10 +140,16 @@ const std::vector<int> ADMOSController::getObjNumsFromObjIdent(const juce::Strin
             auto numListStr = objIdent.substring(1, objIdent.length());
             juce::StringArray nsa;
             nsa.addTokens(numListStr, "-", "");
-            jassert(2 == nsa.size());
             auto startNum = nsa[0].getIntValue();
             auto endNum = nsa[1].getIntValue();
-            objNums.reserve(endNum - startNum + 1);
+            // runs on the OSC receive thread, never expand more than the preallocated object states
+            if (2 != nsa.size() || startNum < 1 || startNum > s_maxObjectCount || endNum < startNum)
+            {
+                DBG(juce::String(__FUNCTION__) + " OSC address ident range " + objIdent + " invalid.");
+                return objNums;
+            }
+            endNum = std::min(endNum, s_maxObjectCount);
+            objNums.reserve(size_t(endNum - startNum + 1));
             for (auto i = startNum; i <= endNum; i++)
                 objNums.push_back(i);
         }
@@ -167,72 +208,139 @@ void ADMOSController::setParameter(int objNum, const ADMOSController::ADMOSCPara
         jassertfalse;
         return;
     }
-    else
+    else if (storeParameter(objNum, param, pct))
     {
+        if (ADMOSCParameterChangeTarget::Internal == pct)
+            triggerAsyncUpdate();
+        else if (ADMOSCParameterChangeTarget::External == pct && !isTimerRunning())
         {
-            std::lock_guard<std::mutex> l(m_objCacheMutex);
-            m_objCache[objNum][param.type] = param;
+            // an idle sender goes out right away, further changes are throttled to the output rate by the timer
+            sendPendingParameterChanges();
+            startTimer(1000 / m_maxOutputRate);
         }
-        ADMOSCParameterChangedMessage::createAndPostIfNotAlreadyPending(objNum, param.type, pct, this);
     }
 }
 
-void ADMOSController::handleMessage(const Message& message)
+bool ADMOSController::storeParameter(int objNum, const ADMOSController::ADMOSCParameter& param, const ADMOSCParameterChangeTarget& pct)
+{
+    if (objNum < 1 || objNum > s_maxObjectCount || param.type <= ADMOSCParameterType::Empty || param.type >= s_parameterTypeCount)
+        return false;
+
+    auto& objectState = m_objectStates[objNum - 1];
+    auto& slot = objectState.parameters[param.type];
+
+    // take the slot by moving its sequence to odd, a concurrent writer only spins for the three stores below
+    auto sequence = slot.sequence.load(std::memory_order_relaxed);
+    while (0 != (sequence & 1) || !slot.sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed))
+        sequence = slot.sequence.load(std::memory_order_relaxed);
+    // keeps the payload stores below from becoming visible before the odd sequence, pairs with the fence in getParameter
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.words[0].store(param.parameter1, std::memory_order_relaxed);
+    slot.words[1].store(param.parameter2, std::memory_order_relaxed);
+    slot.words[2].store(param.parameter3, std::memory_order_relaxed);
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+
+    if (ADMOSCParameterChangeTarget::Internal == pct)
+        objectState.internalDirtyTypes.fetch_or(1u << param.type);
+    else if (ADMOSCParameterChangeTarget::External == pct)
+        objectState.externalDirtyTypes.fetch_or(1u << param.type);
+
+    return true;
+}
+
+void ADMOSController::handleAsyncUpdate()
 {
-    if (const ADMOSCParameterChangedMessage* apcm = dynamic_cast<const ADMOSCParameterChangedMessage*>(&message))
+    auto numObjects = m_numObjects.load();
+    for (int objNum = 1; objNum <= numObjects; objNum++)
     {
-        if (ADMOSCParameterChangeTarget::Internal == apcm->getTarget() && onParameterChanged)
-            onParameterChanged(apcm->getObjNum(), apcm->getType());
-        else if (ADMOSCParameterChangeTarget::External == apcm->getTarget())
-            sendParameterChange(apcm->getObjNum(), getParameter(apcm->getObjNum(), apcm->getType()));
+        auto& objectState = m_objectStates[objNum - 1];
+        auto internalDirtyTypes = objectState.internalDirtyTypes.exchange(0);
+        if (0 == internalDirtyTypes)
+            continue;
+
+        for (std::uint16_t t = ADMOSCParameterType::X; t <= ADMOSCParameterType::Mute; t++)
+            if (0 != (internalDirtyTypes & (1u << t)) && onParameterChanged)
+                onParameterChanged(objNum, t);
     }
 }
 
+void ADMOSController::timerCallback()
+{
+    if (!sendPendingParameterChanges())
+        stopTimer();
+}
+
 ADMOSController::ADMOSCParameter ADMOSController::getParameter(int objNum, std::uint16_t type)
 {
-    if (ADMOSController::ADMOSCParameterType::Empty == type || 0 == m_objCache.count(objNum) || 0 == m_objCache[objNum].count(type))
+    if (ADMOSController::ADMOSCParameterType::Empty == type || type >= s_parameterTypeCount || objNum < 1 || objNum > s_maxObjectCount)
     {
         jassertfalse;
         return {};
     }
     else
     {
-        auto parameter = ADMOSCParameter();
+        auto parameter = ADMOSCParameter(ADMOSCParameterType(type));
+        auto const& slot = m_objectStates[objNum - 1].parameters[type];
+        while (true)
         {
-            std::lock_guard<std::mutex> l(m_objCacheMutex);
-            parameter = m_objCache[objNum][type];
+            auto sequence = slot.sequence.load(std::memory_order_acquire);
+            if (0 != (sequence & 1))
+                continue;
+            parameter.parameter1 = slot.words[0].load(std::memory_order_relaxed);
+            parameter.parameter2 = slot.words[1].load(std::memory_order_relaxed);
+            parameter.parameter3 = slot.words[2].load(std::memory_order_relaxed);
+            // keeps the payload loads above from moving past the second sequence load, pairs with the fence in storeParameter
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) == sequence)
+                break;
         }
         return parameter;
     }
 }
 
-bool ADMOSController::sendParameterChange(int objNum, const ADMOSController::ADMOSCParameter& param)
+bool ADMOSController::sendPendingParameterChanges()
 {
-    if (m_oscSender)
+    auto sentAny = false;
+    auto bundle = juce::OSCBundle();
+    auto bundleMessageCount = 0;
+    auto sendBundle = [&]() {
+        if (m_oscSender && bundleMessageCount > 0)
+            m_oscSender->send(bundle);
+        bundle = juce::OSCBundle();
+        bundleMessageCount = 0;
+    };
+
+    auto numObjects = m_numObjects.load();
+    for (int objNum = 1; objNum <= numObjects; objNum++)
     {
-#ifdef DEBUG
-        auto msg = getParameterAsOSCMessage(objNum, param);
-        juce::String msgAsStr = msg.getAddressPattern().toString() + " ";
-        for (auto const& arg : msg)
-            switch (arg.getType())
-            {
-            case 'i':
-                msgAsStr += juce::String(arg.getInt32()) + " ";
-                break;
-            case 'f':
-                msgAsStr += juce::String(arg.getFloat32()) + " ";
-                break;
-            default:
-                break;
-            }
-        DBG(juce::String(__FUNCTION__) + " " + msgAsStr);
-        return m_oscSender->send(msg);
-#else
-        return m_oscSender->send(getParameterAsOSCMessage(objNum, param));
-#endif
+        auto externalDirtyTypes = m_objectStates[objNum - 1].externalDirtyTypes.exchange(0);
+        if (0 == externalDirtyTypes)
+            continue;
+
+        for (std::uint16_t t = ADMOSCParameterType::X; t <= ADMOSCParameterType::Mute; t++)
+        {
+            if (0 == (externalDirtyTypes & (1u << t)))
+                continue;
+
+            bundle.addElement(juce::OSCBundle::Element(getParameterAsOSCMessage(objNum, getParameter(objNum, t))));
+            sentAny = true;
+            if (++bundleMessageCount >= s_maxMessagesPerBundle)
+                sendBundle();
+        }
     }
-    else
-        return false;
+    sendBundle();
+
+    return sentAny;
+}
+
+const juce::OSCAddressPattern ADMOSController::getAddressPattern(int objNum, std::uint16_t type)
+{
+    auto patternIdx = size_t((objNum - 1) * s_parameterTypeCount + type);
+    if (objNum >= 1 && type < s_parameterTypeCount && patternIdx < m_objectAddressPatterns.size())
+        return m_objectAddressPatterns[patternIdx];
+
+    jassertfalse; // object is not known yet, setNumObjects should have been called before
+    return juce::OSCAddressPattern(s_admObjDomainStr + juce::String(objNum));
 }
 
 const juce::OSCMessage ADMOSController::getParameterAsOSCMessage(int objNum, const ADMOSController::ADMOSCParameter& param)
@@ -240,84 +348,176 @@ const juce::OSCMessage ADMOSController::getParameterAsOSCMessage(int objNum, con
     switch (param.type)
     {
     case ADMOSController::ADMOSCParameterType::X:
-        return juce::OSCMessage(juce::OSCAddressPattern(s_admObjDomainStr + juce::String(objNum) + s_xStr), ADMOSCParameterX(param).getParameterVal());
+        return juce::OSCMessage(getAddressPattern(objNum, ADMOSCParameterType::X), ADMOSCParameterX(param).getParameterVal());
     case ADMOSController::ADMOSCParameterType::Y:
-        return juce::OSCMessage(juce::OSCAddressPattern(s_admObjDomainStr + juce::String(objNum) + s_yStr), ADMOSCParameterY(param).getParameterVal());
+        return juce::OSCMessage(getAddressPattern(objNum, ADMOSCParameterType::Y), ADMOSCParameterY(param).getParameterVal());
     case ADMOSController::ADMOSCParameterType::Z:
-        return juce::OSCMessage(juce::OSCAddressPattern(s_admObjDomainStr + juce::String(objNum) + s_zStr), ADMOSCParameterZ(param).getParameterVal());
+        return juce::OSCMessage(getAddressPattern(objNum, ADMOSCParameterType::Z), ADMOSCParameterZ(param).getParameterVal());
     case ADMOSController::ADMOSCParameterType::XY:
     {
         auto xyVal = ADMOSCParameterXY(param).getParameterVals();
-        return juce::OSCMessage(juce::OSCAddressPattern(s_admObjDomainStr + juce::String(objNum) + s_xyStr), std::get<0>(xyVal), std::get<1>(xyVal));
+        return juce::OSCMessage(getAddressPattern(objNum, ADMOSCParameterType::XY), std::get<0>(xyVal), std::get<1>(xyVal));
     }
     case ADMOSController::ADMOSCParameterType::XYZ:
     {
         auto xyzVal = ADMOSCParameterXYZ(param).getParameterVals();
-        return juce::OSCMessage(juce::OSCAddressPattern(s_admObjDomainStr + juce::String(objNum) + s_xyzStr), std::get<0>(xyzVal), std::get<1>(xyzVal), std::get<2>(xyzVal));
+        return juce::OSCMessage(getAddressPattern(objNum, ADMOSCParameterType::XYZ), std::get<0>(xyzVal), std::get<1>(xyzVal), std::get<2>(xyzVal));
     }
     case ADMOSController::ADMOSCParameterType::Width:
-        return juce::OSCMessage(juce::OSCAddressPattern(s_admObjDomainStr + juce::String(objNum) + s_widthStr), ADMOSCParameterWidth(param).getParameterVal());
+        return juce::OSCMessage(getAddressPattern(objNum, ADMOSCParameterType::Width), ADMOSCParameterWidth(param).getParameterVal());
     case ADMOSController::ADMOSCParameterType::Mute:
-        return juce::OSCMessage(juce::OSCAddressPattern(s_admObjDomainStr + juce::String(objNum) + s_muteStr), ADMOSCParameterMute(param).getParameterVal01());
+        return juce::OSCMessage(getAddressPattern(objNum, ADMOSCParameterType::Mute), ADMOSCParameterMute(param).getParameterVal01());
     case ADMOSController::ADMOSCParameterType::Empty:
     default:
         jassertfalse;
-        return juce::OSCMessage(juce::OSCAddressPattern(s_admObjDomainStr + juce::String(objNum)));
+        return juce::OSCMessage(getAddressPattern(objNum, ADMOSCParameterType::Empty));
     }
 }
 
-void ADMOSController::oscMessageReceived(const juce::OSCMessage& message)
+ADMOSController::ADMOSCParameterType ADMOSController::getParameterTypeForAddressToken(const juce::CharPointer_UTF8& token)
+{
+    // dispatch on the last address token without building substrings: x, xy, xyz, y, z, w, mute
+    switch (token[0])
+    {
+    case 'x':
+        if (0 == token[1])
+            return ADMOSCParameterType::X;
+        else if ('y' == token[1] && 0 == token[2])
+            return ADMOSCParameterType::XY;
+        else if ('y' == token[1] && 'z' == token[2] && 0 == token[3])
+            return ADMOSCParameterType::XYZ;
+        break;
+    case 'y':
+        if (0 == token[1])
+            return ADMOSCParameterType::Y;
+        break;
+    case 'z':
+        if (0 == token[1])
+            return ADMOSCParameterType::Z;
+        break;
+    case 'w':
+        if (0 == token[1])
+            return ADMOSCParameterType::Width;
+        break;
+    case 'm':
+        if (0 == juce::CharacterFunctions::compare(token, juce::CharPointer_ASCII("mute")))
+            return ADMOSCParameterType::Mute;
+        break;
+    default:
+        break;
+    }
+    return ADMOSCParameterType::Empty;
+}
+
+bool ADMOSController::applyMessage(const juce::OSCMessage& message)
 {
     if (message.isEmpty())
-        return;
+        return false;
 
     auto addrStr = message.getAddressPattern().toString();
-    if (addrStr.startsWith(s_admObjDomainStr))
+    auto addr = addrStr.getCharPointer();
+    auto domain = s_admObjDomainStr.getCharPointer();
+    while (!domain.isEmpty() && *addr == *domain)
+    {
+        ++addr;
+        ++domain;
+    }
+    if (!domain.isEmpty())
     {
-        auto addrContents = addrStr.fromFirstOccurrenceOf(s_admObjDomainStr, false, false);
+        DBG(juce::String(__FUNCTION__) + " unhandled OSC message: " + addrStr + "(" + juce::String(message.size()) + " args)");
+        return false;
+    }
 
-        auto objIdent = addrContents.upToFirstOccurrenceOf("/", false, false);
-        auto objNums = getObjNumsFromObjIdent(objIdent);
+    // object ident token, plain object numbers are parsed in place, only patterns go through getObjNumsFromObjIdent
+    auto identStart = addr;
+    auto objNum = 0;
+    auto isPlainNumber = true;
+    while (!addr.isEmpty() && '/' != *addr)
+    {
+        auto c = *addr;
+        if (c >= '0' && c <= '9')
+            objNum = std::min(objNum * 10 + int(c - '0'), s_maxObjectCount + 1); // out of range either way, just avoid overflowing
+        else
+            isPlainNumber = false;
+        ++addr;
+    }
+    if (addr.isEmpty() || addr == identStart)
+        return false;
+    auto identEnd = addr;
+    ++addr;
 
-        ADMOSCParameter param;
-        if (addrContents.endsWith(s_xStr) && 1 == message.size())
+    auto type = getParameterTypeForAddressToken(addr);
+    ADMOSCParameter param;
+    switch (type)
+    {
+    case ADMOSCParameterType::X:
+        if (1 == message.size())
             param = ADMOSCParameterX(message[0].getFloat32());
-        else if (addrContents.endsWith(s_yStr) && 1 == message.size())
+        break;
+    case ADMOSCParameterType::Y:
+        if (1 == message.size())
             param = ADMOSCParameterY(message[0].getFloat32());
-        else if (addrContents.endsWith(s_zStr) && 1 == message.size())
+        break;
+    case ADMOSCParameterType::Z:
+        if (1 == message.size())
             param = ADMOSCParameterZ(message[0].getFloat32());
-        else if (addrContents.endsWith(s_xyStr) && 2 == message.size())
+        break;
+    case ADMOSCParameterType::XY:
+        if (2 == message.size())
             param = ADMOSCParameterXY(message[0].getFloat32(), message[1].getFloat32());
-        else if (addrContents.endsWith(s_xyzStr) && 3 == message.size())
+        break;
+    case ADMOSCParameterType::XYZ:
+        if (3 == message.size())
             param = ADMOSCParameterXYZ(message[0].getFloat32(), message[1].getFloat32(), message[2].getFloat32());
-        else if (addrContents.endsWith(s_widthStr) && 1 == message.size())
+        break;
+    case ADMOSCParameterType::Width:
+        if (1 == message.size())
             param = ADMOSCParameterWidth(message[0].getFloat32());
-        else if (addrContents.endsWith(s_muteStr) && 1 == message.size())
+        break;
+    case ADMOSCParameterType::Mute:
+        if (1 == message.size())
             param = ADMOSCParameterMute(message[0].getInt32());
-
-        for (auto const& objNum : objNums)
-            setParameter(objNum, param, ADMOSCParameterChangeTarget::Internal);
+        break;
+    case ADMOSCParameterType::Empty:
+    default:
+        break;
     }
-    else
+    if (ADMOSCParameterType::Empty == param.type)
+        return false;
+
+    if (isPlainNumber)
+        return storeParameter(objNum, param, ADMOSCParameterChangeTarget::Internal);
+
+    auto changed = false;
+    for (auto const& patternObjNum : getObjNumsFromObjIdent(juce::String(identStart, identEnd)))
+        changed = storeParameter(patternObjNum, param, ADMOSCParameterChangeTarget::Internal) || changed;
+    return changed;
+}
+
+bool ADMOSController::applyBundle(const juce::OSCBundle& bundle)
+{
+    auto changed = false;
+    for (auto const& element : bundle)
     {
-        DBG(juce::String(__FUNCTION__) + " unhandled OSC message: " + addrStr + "(" + juce::String(message.size()) + " args)");
+        if (element.isBundle())
+            changed = applyBundle(element.getBundle()) || changed;
+        else if (element.isMessage())
+            changed = applyMessage(element.getMessage()) || changed;
     }
+    return changed;
+}
+
+void ADMOSController::oscMessageReceived(const juce::OSCMessage& message)
+{
+    if (applyMessage(message))
+        triggerAsyncUpdate();
 }
 
 void ADMOSController::oscBundleReceived(const juce::OSCBundle& bundle)
 {
-    if (bundle.isEmpty())
-        return;
-    else
-    {
-        for (auto const& element : bundle)
-        {
-            if (element.isBundle())
-                oscBundleReceived(element.getBundle());
-            else if (element.isMessage())
-                oscMessageReceived(element.getMessage());
-        }
-    }
+    // the whole bundle is handed to the message thread with a single async update
+    if (!bundle.isEmpty() && applyBundle(bundle))
+        triggerAsyncUpdate();
 }
 
 
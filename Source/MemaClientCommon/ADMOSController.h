@@ -31,8 +31,17 @@ namespace Mema
  * Listens on a configurable UDP port for ADM-OSC messages (/adm/obj/n/x|y|z|xy|xyz|w|mute)
  * and forwards decoded parameter values to registered callbacks, which are consumed by
  * PanningControlComponent to drive TwoDFieldMultisliderComponent.
+ *
+ * Parameter values live in a flat, preallocated per-object array of seqlock protected slots,
+ * so the OSC realtime thread neither locks nor allocates when applying a message.  Changed
+ * parameters are only flagged in per-object dirty masks, a whole bundle results in a single
+ * async update on the message thread that dispatches all flagged parameters.
+ *
+ * Outgoing changes are flagged the same way and sent by a timer running at most at the
+ * configured output rate, all objects changed since the last tick going out as one OSC bundle
+ * with per-object address patterns built once in setNumObjects.
  */
-class ADMOSController : public juce::OSCReceiver::Listener<juce::OSCReceiver::RealtimeCallback>, public juce::MessageListener
+class ADMOSController : public juce::OSCReceiver::Listener<juce::OSCReceiver::RealtimeCallback>, private juce::AsyncUpdater, private juce::Timer
 {
 public:
     enum ADMOSCParameterChangeTarget
@@ -240,69 +249,8 @@ public:
         int getParameterVal01() { return int(parameter1); };
     };
 
-    class ADMOSCParameterChangedMessage : public juce::Message
-    {
-    public:
-        ADMOSCParameterChangedMessage(int objNum, std::uint16_t type, ADMOSCParameterChangeTarget target)
-        {
-            m_objNum = objNum;
-            m_type = type;
-            m_target = target;
-
-            std::lock_guard<std::mutex> l(m_typeMapMutex);
-            auto iter = std::find(m_typeMap[objNum].begin(), m_typeMap[objNum].end(), type);
-            if (iter == m_typeMap[objNum].end())
-                m_typeMap[objNum].push_back(type);
-        };
-        ~ADMOSCParameterChangedMessage()
-        {
-            std::lock_guard<std::mutex> l(m_typeMapMutex);
-            auto iter = std::find(m_typeMap[m_objNum].begin(), m_typeMap[m_objNum].end(), m_type);
-            jassert(iter != m_typeMap[m_objNum].end()); // must exist while this instance exists, otherwise something was messed up regarding creation/destruction!
-            if (iter != m_typeMap[m_objNum].end())
-                m_typeMap[m_objNum].erase(iter);
-        };
-
-        static bool createAndPostIfNotAlreadyPending(int objNum, std::uint16_t type, ADMOSCParameterChangeTarget target, ADMOSController* postTarget)
-        {
-            bool isAlreadyPending = false;
-            {
-                std::lock_guard<std::mutex> l(m_typeMapMutex);
-                auto iter = std::find(m_typeMap[objNum].begin(), m_typeMap[objNum].end(), type);
-                if (iter != m_typeMap[objNum].end())
-                    isAlreadyPending = true;
-            }
-
-            if (!isAlreadyPending)
-            {
-                postTarget->postMessage(std::make_unique<ADMOSCParameterChangedMessage>(objNum, type, target).release());
-                return true;
-            }
-            else
-                return false;
-        };
-
-        int getObjNum() const
-        {
-            return m_objNum;
-        };
-        std::uint16_t getType() const
-        {
-            return m_type;
-        };
-        ADMOSCParameterChangeTarget getTarget() const
-        {
-            return m_target;
-        };
-
-    private:
-        static std::mutex                                   m_typeMapMutex;
-        static std::map<int, std::vector<std::uint16_t>>    m_typeMap;
-
-        int                         m_objNum;
-        std::uint16_t               m_type;
-        ADMOSCParameterChangeTarget m_target;
-    };
+public:
+    static constexpr int s_defaultMaxOutputRate = 50;                   ///< Default outgoing bundles per second.
 
 public:
     ADMOSController();
@@ -312,6 +260,10 @@ public:
 
     void setNumObjects(int numObjects);
 
+    /** @brief Limits outgoing ADM-OSC bundles to @p bundlesPerSecond, changes in between are coalesced to their latest value. */
+    void setMaxOutputRate(int bundlesPerSecond);
+    int getMaxOutputRate() const;
+
     void setParameter(int objNum, const ADMOSCParameter& param, const ADMOSCParameterChangeTarget& pct = ADMOSCParameterChangeTarget::None);
     ADMOSCParameter getParameter(int objNum, std::uint16_t type);
     
@@ -319,21 +271,48 @@ public:
     void oscMessageReceived (const juce::OSCMessage& message) override;
     void oscBundleReceived(const juce::OSCBundle& bundle) override;
 
-    //==============================================================================
-    void handleMessage(const Message& message) override;
-
     //==============================================================================
     std::function<void(int, std::uint16_t)> onParameterChanged;
     
 protected:
     //==============================================================================
     const std::vector<int>  getObjNumsFromObjIdent(const juce::String& objIdent);
+    static ADMOSCParameterType getParameterTypeForAddressToken(const juce::CharPointer_UTF8& token);
     
-    bool sendParameterChange(int objNum, const ADMOSController::ADMOSCParameter& param);
+    bool sendPendingParameterChanges();
 
+    const juce::OSCAddressPattern getAddressPattern(int objNum, std::uint16_t type);
     const juce::OSCMessage getParameterAsOSCMessage(int objNum, const ADMOSController::ADMOSCParameter& param);
     
 private:
+    //==============================================================================
+    static constexpr int s_maxObjectCount = 256;                        ///< Number of preallocated object states, objects beyond are ignored.
+    static constexpr int s_parameterTypeCount = ADMOSCParameterType::Mute + 1;
+    static constexpr int s_maxMessagesPerBundle = 128;                  ///< Keeps a single outgoing bundle well below the UDP datagram size.
+
+    /** @brief Cached value of one parameter, up to three 32-bit words guarded by a sequence counter (odd while written). */
+    struct ParameterSlot
+    {
+        std::atomic<std::uint32_t>                  sequence{ 0 };
+        std::array<std::atomic<std::uint32_t>, 3>   words{};
+    };
+    /** @brief All cached parameters of one object plus the types changed since the last async update, as bitmask per target. */
+    struct ObjectState
+    {
+        std::array<ParameterSlot, s_parameterTypeCount> parameters;
+        std::atomic<std::uint32_t>                      internalDirtyTypes{ 0 };
+        std::atomic<std::uint32_t>                      externalDirtyTypes{ 0 };
+    };
+
+    //==============================================================================
+    void handleAsyncUpdate() override;
+    void timerCallback() override;
+
+    //==============================================================================
+    bool applyMessage(const juce::OSCMessage& message);
+    bool applyBundle(const juce::OSCBundle& bundle);
+    bool storeParameter(int objNum, const ADMOSCParameter& param, const ADMOSCParameterChangeTarget& pct);
+
     //==============================================================================
     const juce::String s_admObjDomainStr = "/adm/obj/";
     const juce::String s_xStr= "/x";
@@ -349,9 +328,12 @@ private:
     std::unique_ptr<juce::OSCSender>    m_oscSender;
 
     //==============================================================================
-    std::vector<int>    m_knownObjNums;
-    std::mutex  m_objCacheMutex;
-    std::map<int, std::map<std::uint16_t, ADMOSCParameter>>  m_objCache;
+    std::atomic<int>                m_numObjects{ 0 };
+    std::unique_ptr<ObjectState[]>  m_objectStates;     ///< s_maxObjectCount entries, index is objNum - 1.
+
+    //==============================================================================
+    std::vector<juce::OSCAddressPattern>    m_objectAddressPatterns;    ///< s_parameterTypeCount patterns per known object, index (objNum - 1) * s_parameterTypeCount + type.
+    int                                     m_maxOutputRate = s_defaultMaxOutputRate;
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ADMOSController)
 };
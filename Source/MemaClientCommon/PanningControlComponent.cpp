@@ -21,7 +21,6 @@
 #include <CustomLookAndFeel.h>
 #include <ToggleStateSlider.h>
 #include <MemaClientCommon/ADMOSController.h>
-#include <MemaClientCommon/InputPositionMapper.h>
 #include <MemaClientCommon/TwoDFieldMultisliderComponent.h>
 
 
@@ -51,16 +50,7 @@ PanningControlComponent::PanningControlComponent()
     };
     addAndMakeVisible(m_multiSlider.get());
 
-    m_positionMapper = std::make_unique<InputPositionMapper>();
-    m_positionMapper->onInputPositionMapped = [=](std::uint16_t channel, const std::map<juce::AudioChannelSet::ChannelType, float>& channelToOutputsDists) {
-        processOutputDistances(channel, channelToOutputsDists);
-    };
-    m_positionMapper->getAngleForChannelType = [=](juce::AudioChannelSet::ChannelType channelType) {
-        if (m_multiSlider)
-            return m_multiSlider->getAngleForChannelTypeInCurrentConfiguration(channelType);
-        else
-            return 0.0f;
-    };
+    m_panner = std::make_unique<InputPositionPanner>();
 
     m_admOsController = std::make_unique<ADMOSController>();
     m_admOsController->onParameterChanged = [=](int objNum, std::uint16_t objType) {
@@ -166,6 +156,11 @@ void PanningControlComponent::setIOCount(const std::pair<int, int>& ioCount)
     if (m_admOsController)
         m_admOsController->setNumObjects(ioCount.first);
 
+    // a new io count comes with a (re)connection, so the layout has to be handed out again before the next positions
+    if (m_panner)
+        m_panner->clearLayouts();
+    m_pannerLayouts.clear();
+
     selectInputChannel(m_currentInputChannel);
 }
 
@@ -175,6 +170,11 @@ void PanningControlComponent::setChannelConfig(const juce::AudioChannelSet& chan
 
     if (m_multiSlider)
         m_multiSlider->setChannelConfiguration(channelConfiguration);
+
+    // speaker unit vectors are recalculated per layer on next use
+    if (m_panner)
+        m_panner->clearLayouts();
+    m_pannerLayouts.clear();
 }
 
 const juce::AudioChannelSet& PanningControlComponent::getChannelConfig()
@@ -188,10 +188,21 @@ void PanningControlComponent::rebuildControls(bool force)
     resized();
 }
 
-void PanningControlComponent::setExternalControlSettings(int ADMOSCPort, const juce::IPAddress& ADMOSCControllerIP, int ADMOSCControllerPort)
+void PanningControlComponent::setServerSidePanningSupported(bool supported)
+{
+    // a (re)connected Mema knows no layouts yet, they go out again with the next positions
+    if (supported && !m_serverSidePanningSupported)
+        m_serverLayoutOutdated = true;
+    m_serverSidePanningSupported = supported;
+}
+
+void PanningControlComponent::setExternalControlSettings(int ADMOSCPort, const juce::IPAddress& ADMOSCControllerIP, int ADMOSCControllerPort, int ADMOSCMaxOutputRate)
 {
     if (m_admOsController)
+    {
+        m_admOsController->setMaxOutputRate(ADMOSCMaxOutputRate);
         m_admOsController->startConnection(ADMOSCPort, ADMOSCControllerIP, ADMOSCControllerPort);
+    }
 }
 
 void PanningControlComponent::handleExternalControlParameter(int objNum, std::uint16_t objType, void* /*sender*/)
@@ -435,11 +446,16 @@ void PanningControlComponent::changeInputPosition(std::uint16_t channel, std::op
 
     DBG(juce::String(__FUNCTION__) << " new pos: " << int(channel) << " " << xVal << "," << yVal << "(" << sharpnessVal << " / " << layerVal << ")");
 
-    if (m_multiSlider && m_positionMapper)
+    if (m_multiSlider && m_panner)
     {
-        m_positionMapper->setOutputIncludePositions(m_multiSlider->getOutputsInLayer(TwoDFieldMultisliderComponent::ChannelLayer(layerVal)));
-        m_positionMapper->setOutputIgnorePositions(m_multiSlider->getDirectiveOutputsNotInLayer(TwoDFieldMultisliderComponent::ChannelLayer(layerVal)));
-        m_positionMapper->mapInputPosition(channel, { -xVal, yVal }, sharpnessVal);
+        // only the latest position per input is kept, all pending inputs are panned together in handleAsyncUpdate
+        auto inputPosition = InputPositionPanner::InputPosition{ channel, layerVal, { -xVal, yVal }, sharpnessVal };
+        auto pendingIter = std::find_if(m_pendingInputPositions.begin(), m_pendingInputPositions.end(), [channel](const InputPositionPanner::InputPosition& pending) { return pending.input == channel; });
+        if (pendingIter != m_pendingInputPositions.end())
+            *pendingIter = inputPosition;
+        else
+            m_pendingInputPositions.push_back(inputPosition);
+        triggerAsyncUpdate();
 
         if (juce::NotificationType::dontSendNotification != notification)
         {
@@ -468,19 +484,81 @@ void PanningControlComponent::changeInputPosition(std::uint16_t channel, std::op
     }
 }
 
-void PanningControlComponent::processOutputDistances(std::uint16_t channel, const std::map<juce::AudioChannelSet::ChannelType, float>& channelToOutputsDists)
+void PanningControlComponent::updatePannerLayout(int layer)
 {
+    if (!m_multiSlider || !m_panner)
+        return;
+
+    auto& layerLayout = m_pannerLayouts[layer];
+    layerLayout.pannedOutputs.clear();
+    for (auto const& channelType : m_multiSlider->getOutputsInLayer(TwoDFieldMultisliderComponent::ChannelLayer(layer)))
+        layerLayout.pannedOutputs.push_back({ m_multiSlider->getChannelNumberForChannelTypeInCurrentConfiguration(channelType), m_multiSlider->getAngleForChannelTypeInCurrentConfiguration(channelType) });
+
+    layerLayout.silencedOutputs.clear();
+    for (auto const& channelType : m_multiSlider->getDirectiveOutputsNotInLayer(TwoDFieldMultisliderComponent::ChannelLayer(layer)))
+        layerLayout.silencedOutputs.push_back(m_multiSlider->getChannelNumberForChannelTypeInCurrentConfiguration(channelType));
+
+    m_panner->setLayout(layer, layerLayout);
+}
+
+void PanningControlComponent::handleAsyncUpdate()
+{
+    if (!m_multiSlider || !m_panner || m_pendingInputPositions.empty())
+        return;
+
+    auto layoutChanged = false;
+    for (auto const& inputPosition : m_pendingInputPositions)
+    {
+        if (!m_panner->hasLayout(inputPosition.layer))
+        {
+            updatePannerLayout(inputPosition.layer);
+            layoutChanged = true;
+        }
+    }
+
+    // server-side panning: Mema needs the layout before it can pan the positions
+    auto serverSidePanning = m_serverSidePanningSupported && onInputPositionsChanged;
+    if (serverSidePanning)
+    {
+        if ((layoutChanged || m_serverLayoutOutdated) && onPanningLayoutChanged)
+            onPanningLayoutChanged(m_pannerLayouts);
+        m_serverLayoutOutdated = false;
+        onInputPositionsChanged(m_pendingInputPositions);
+    }
+
+    // pan all pending inputs in one pass, straight into the crosspoint gain array
+    auto ioCount = getIOCount();
+    m_pannedCrosspointGains.resize(size_t(std::max(0, ioCount.first * ioCount.second)));
+    m_panner->process(m_pendingInputPositions, m_pannedCrosspointGains.data(), ioCount.first, ioCount.second);
+
     std::map<std::uint16_t, std::map<std::uint16_t, bool>> crosspointStates;
     std::map<std::uint16_t, std::map<std::uint16_t, float>> crosspointValues;
-    for (auto const& cToOdKV : channelToOutputsDists)
+    auto addCrosspoint = [&](std::uint16_t input, int output) {
+        if (output < 1 || output > ioCount.second)
+            return;
+        crosspointStates[input][std::uint16_t(output)] = true;
+        crosspointValues[input][std::uint16_t(output)] = m_pannedCrosspointGains[size_t((input - 1) * ioCount.second + (output - 1))];
+    };
+    for (auto const& inputPosition : m_pendingInputPositions)
     {
-        crosspointStates[channel][std::uint16_t(m_multiSlider->getChannelNumberForChannelTypeInCurrentConfiguration(cToOdKV.first))] = true;
-        crosspointValues[channel][std::uint16_t(m_multiSlider->getChannelNumberForChannelTypeInCurrentConfiguration(cToOdKV.first))] = cToOdKV.second;
+        if (inputPosition.input < 1 || inputPosition.input > ioCount.first)
+            continue;
+        for (auto const& output : m_panner->getPannedOutputs(inputPosition.layer))
+            addCrosspoint(inputPosition.input, output);
+        for (auto const& output : m_panner->getSilencedOutputs(inputPosition.layer))
+            addCrosspoint(inputPosition.input, output);
     }
-    if (onCrosspointStatesChanged)
+    m_pendingInputPositions.clear();
+
+    if (crosspointStates.empty())
+        return;
+
+    // with server-side panning Mema computes the same crosspoints itself, the local result only updates the display
+    auto sendCrosspoints = !serverSidePanning;
+    if (sendCrosspoints && onCrosspointStatesChanged)
         onCrosspointStatesChanged(crosspointStates);
     addCrosspointStates(crosspointStates);
-    if (onCrosspointValuesChanged)
+    if (sendCrosspoints && onCrosspointValuesChanged)
         onCrosspointValuesChanged(crosspointValues);
     addCrosspointValues(crosspointValues);
 }
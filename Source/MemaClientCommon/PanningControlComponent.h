@@ -21,6 +21,7 @@
 #include <JuceHeader.h>
 
 #include "MemaClientControlComponentBase.h"
+#include "../MemaProcessor/InputPositionPanner.h"
 
 
 /**
@@ -35,7 +36,6 @@ namespace Mema
 
 
 class ADMOSController;
-class InputPositionMapper;
 class TwoDFieldMultisliderComponent;
 
 
@@ -45,8 +45,14 @@ class TwoDFieldMultisliderComponent;
  * Hosts a TwoDFieldMultisliderComponent for interactive speaker-layout panning and an
  * ADMOSController for receiving external ADM-OSC position/mute updates.  Sends updated
  * ControlParametersMessage payloads back to Mema via the onMessageReadyToSend callback.
+ * Position changes are collected and panned together by an InputPositionPanner on the next
+ * message loop run, so a burst of automation results in a single crosspoint update.
+ * If onInputPositionsChanged is set and the connected Mema announced server-side panning support
+ * (setServerSidePanningSupported), only the positions (and beforehand the speaker layout via
+ * onPanningLayoutChanged) are handed out for Mema to pan server-side, the local panning result
+ * then only drives the crosspoint display.  Otherwise the panned crosspoints are sent.
  */
-class PanningControlComponent : public MemaClientControlComponentBase
+class PanningControlComponent : public MemaClientControlComponentBase, private juce::AsyncUpdater
 {
 public:
     PanningControlComponent();
@@ -73,19 +79,29 @@ public:
     void setChannelConfig(const juce::AudioChannelSet& channelConfiguration);
     const juce::AudioChannelSet& getChannelConfig();
 
-    void setExternalControlSettings(int ADMOSCPort, const juce::IPAddress& ADMOSCControllerIP, int ADMOSCControllerPort);
+    /** @brief Selects between server-side panning (positions only) and sending the locally panned crosspoints. */
+    void setServerSidePanningSupported(bool supported);
+
+    void setExternalControlSettings(int ADMOSCPort, const juce::IPAddress& ADMOSCControllerIP, int ADMOSCControllerPort, int ADMOSCMaxOutputRate);
 
     void handleExternalControlParameter(int objNum, std::uint16_t objType, void* sender = nullptr);
 
+    //==============================================================================
+    std::function<void(const std::map<int, InputPositionPanner::LayerLayout>&)> onPanningLayoutChanged;
+    std::function<void(const std::vector<InputPositionPanner::InputPosition>&)> onInputPositionsChanged;
+
 protected:
     //==============================================================================
     void changeInputPosition(std::uint16_t channel, std::optional<float> xValOpt, std::optional<float> yValOpt, std::optional<float> sharpnessOpt, std::optional<int> layerOpt, juce::NotificationType notification = juce::dontSendNotification);
-    void processOutputDistances(std::uint16_t channel, const std::map<juce::AudioChannelSet::ChannelType, float>& channelToOutputsDists);
+    void updatePannerLayout(int layer);
     void selectInputChannel(std::uint16_t channel);
     void rebuildControls(bool force = false);
     void rebuildInputControls(bool force = false);
 
 private:
+    //==============================================================================
+    void handleAsyncUpdate() override;
+
     //==============================================================================
     std::unique_ptr<juce::Viewport>     m_horizontalScrollViewport;
     std::unique_ptr<juce::Component>    m_horizontalScrollContainerComponent;
@@ -94,7 +110,13 @@ private:
     std::vector<std::unique_ptr<juce::TextButton>>  m_inputSelectButtons;
     std::vector<std::unique_ptr<juce::TextButton>>  m_inputMuteButtons;
     std::unique_ptr<ADMOSController>                m_admOsController;
-    std::unique_ptr<InputPositionMapper>            m_positionMapper;
+    std::unique_ptr<InputPositionPanner>            m_panner;
+    std::map<int, InputPositionPanner::LayerLayout> m_pannerLayouts;            ///< Layouts currently set on m_panner, per layer.
+    bool                                            m_serverSidePanningSupported = false; ///< True if the connected Mema pans positions itself.
+    bool                                            m_serverLayoutOutdated = true;      ///< True if Mema has not yet received the current layouts.
+
+    std::vector<InputPositionPanner::InputPosition> m_pendingInputPositions;    ///< Latest not yet panned position per input.
+    std::vector<float>                              m_pannedCrosspointGains;    ///< Row-major inputs x outputs gains written by m_panner.
     std::unique_ptr<TwoDFieldMultisliderComponent>  m_multiSlider;
 
     juce::AudioChannelSet   m_channelConfiguration;
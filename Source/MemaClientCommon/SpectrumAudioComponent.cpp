@@ -104,8 +104,8 @@ void SpectrumAudioComponent::paint(juce::Graphics & g)
         auto const& plotPoints = m_plotPoints[channelIdx];
 
         // Calculate this channel's plot area
-        auto visuAreaY = outerMargin + channelIdx * (channelPlotHeight + channelMargin);
-        juce::Rectangle<int> visuArea(outerMargin, visuAreaY, totalWidth, channelPlotHeight);
+        auto visuArea = getChannelPlotArea(channelIdx);
+        auto visuAreaY = visuArea.getY();
 
         auto visuAreaOrigX = float(outerMargin);
         auto visuAreaOrigY = float(visuAreaY + channelPlotHeight);
@@ -146,85 +146,11 @@ void SpectrumAudioComponent::paint(juce::Graphics & g)
             juce::Rectangle<float>(visuAreaOrigX + visuAreaWidth - 120.0f, float(visuAreaY), 110.0f, float(outerMargin)),
             juce::Justification::centred, true);
 
-        // Draw spectrum curve for this channel
-        if (!plotPoints.peaks.empty() && plotPoints.holds.size() == plotPoints.peaks.size())
-        {
-            // Helper lambda to calculate frequency for a given band index (logarithmic mapping)
-            auto getBandFrequency = [&plotPoints](int bandIndex) -> float
-                {
-                    if (plotPoints.minFreq <= 0.0f || plotPoints.maxFreq <= plotPoints.minFreq)
-                        return 0.0f;
-
-                    float ratio = plotPoints.maxFreq / plotPoints.minFreq;
-                    float t = static_cast<float>(bandIndex) / (plotPoints.peaks.size() - 1);
-                    return plotPoints.minFreq * std::pow(ratio, t);
-                };
-
-            // Helper lambda to convert frequency to screen X position (logarithmic scale)
-            auto frequencyToScreenX = [&](float frequency) -> float
-                {
-                    if (frequency <= 0.0f)
-                        return visuAreaOrigX;
-
-                    float skewedProportionX = (log10(frequency) - logScaleMin) / logScaleRange;
-                    return visuAreaOrigX + (static_cast<float>(visuAreaWidth) * skewedProportionX);
-                };
-
-            // Find the band indices that correspond to our plot frequency range
-            int minPlotIdx = -1;
-            int maxPlotIdx = -1;
-
-            for (int i = 0; i < plotPoints.peaks.size(); ++i)
-            {
-                float bandFreq = getBandFrequency(i);
-
-                if (minPlotIdx == -1 && bandFreq >= minPlotFreq)
-                    minPlotIdx = i;
-
-                if (bandFreq <= maxPlotFreq)
-                    maxPlotIdx = i;
-            }
-
-            // Ensure valid indices
-            if (minPlotIdx == -1)
-                minPlotIdx = 0;
-            if (maxPlotIdx == -1 || maxPlotIdx >= plotPoints.peaks.size())
-                maxPlotIdx = static_cast<int>(plotPoints.peaks.size() - 1);
-
-            if (minPlotIdx <= maxPlotIdx)
-            {
-                // Build hold and peak paths
-                auto holdPath = juce::Path{};
-                auto peakPath = juce::Path{};
-
-                // Start paths at first band
-                float startFreq = getBandFrequency(minPlotIdx);
-                float startX = frequencyToScreenX(startFreq);
-                float startHoldY = visuAreaOrigY - plotPoints.holds.at(minPlotIdx) * visuAreaHeight;
-                float startPeakY = visuAreaOrigY - plotPoints.peaks.at(minPlotIdx) * visuAreaHeight;
-
-                holdPath.startNewSubPath(juce::Point<float>(startX, startHoldY));
-                peakPath.startNewSubPath(juce::Point<float>(startX, startPeakY));
-
-                // Add remaining bands
-                for (int i = minPlotIdx + 1; i <= maxPlotIdx; ++i)
-                {
-                    float bandFreq = getBandFrequency(i);
-                    float pointX = frequencyToScreenX(bandFreq);
-
-                    float holdY = visuAreaOrigY - plotPoints.holds.at(i) * visuAreaHeight;
-                    holdPath.lineTo(juce::Point<float>(pointX, holdY));
-
-                    float peakY = visuAreaOrigY - plotPoints.peaks.at(i) * visuAreaHeight;
-                    peakPath.lineTo(juce::Point<float>(pointX, peakY));
-                }
-
-                g.setColour(holdColour);
-                g.strokePath(holdPath, juce::PathStrokeType(1));
-                g.setColour(peakColour);
-                g.strokePath(peakPath, juce::PathStrokeType(3));
-            }
-        }
+        // Draw spectrum curve for this channel - paths are prepared in processingDataChanged, decimated to pixel columns
+        g.setColour(holdColour);
+        g.strokePath(plotPoints.holdPath, juce::PathStrokeType(1));
+        g.setColour(peakColour);
+        g.strokePath(plotPoints.peakPath, juce::PathStrokeType(3));
     }
 
     // Draw frequency legend at the bottom
@@ -244,6 +170,119 @@ void SpectrumAudioComponent::paint(juce::Graphics & g)
     }
 }
 
+juce::Rectangle<int> SpectrumAudioComponent::getChannelPlotArea(int channelIdx)
+{
+    auto outerMargin = 6;
+    auto channelMargin = outerMargin; // margin between channel plots
+    auto channelLabelWidth = 20; // width for channel number area
+    auto numVisibleChannels = getNumVisibleChannels();
+    if (numVisibleChannels <= 0)
+        return {};
+
+    auto totalWidth = getWidth() - 2 * outerMargin - channelLabelWidth;
+    auto totalHeight = getHeight() - 2 * outerMargin - outerMargin; // space for legend at bottom
+
+    // Calculate height per channel plot including margins
+    auto totalChannelMargins = (numVisibleChannels - 1) * channelMargin;
+    auto availableHeightForPlots = totalHeight - totalChannelMargins;
+    auto channelPlotHeight = availableHeightForPlots / numVisibleChannels;
+
+    auto visuAreaY = outerMargin + channelIdx * (channelPlotHeight + channelMargin);
+    return juce::Rectangle<int>(outerMargin, visuAreaY, totalWidth, channelPlotHeight);
+}
+
+void SpectrumAudioComponent::updateBandColumns(const PlotPoints& plotPoints, int plotWidth)
+{
+    auto bandCount = int(plotPoints.peaks.size());
+    if (m_bandColumnsPlotWidth == plotWidth && m_bandColumnsMinFreq == plotPoints.minFreq && m_bandColumnsMaxFreq == plotPoints.maxFreq && int(m_bandColumns.size()) == bandCount)
+        return;
+
+    m_bandColumnsPlotWidth = plotWidth;
+    m_bandColumnsMinFreq = plotPoints.minFreq;
+    m_bandColumnsMaxFreq = plotPoints.maxFreq;
+    m_bandColumns.assign(bandCount, -1);
+
+    if (plotPoints.minFreq <= 0.0f || plotPoints.maxFreq <= plotPoints.minFreq || bandCount < 2)
+        return;
+
+    auto maxPlotFreq = 20000.0f;
+    auto minPlotFreq = 20.0f;
+    auto logScaleMin = log10(minPlotFreq);
+    auto logScaleRange = log10(maxPlotFreq) - logScaleMin;
+
+    // logarithmic band frequencies mapped onto the logarithmic frequency axis
+    auto ratio = plotPoints.maxFreq / plotPoints.minFreq;
+    for (int i = 0; i < bandCount; ++i)
+    {
+        auto bandFreq = plotPoints.minFreq * std::pow(ratio, static_cast<float>(i) / (bandCount - 1));
+        if (bandFreq < minPlotFreq || bandFreq > maxPlotFreq)
+            continue;
+
+        auto skewedProportionX = (log10(bandFreq) - logScaleMin) / logScaleRange;
+        m_bandColumns[i] = juce::jlimit(0, plotWidth - 1, static_cast<int>(static_cast<float>(plotWidth) * skewedProportionX));
+    }
+}
+
+void SpectrumAudioComponent::updatePlotPath(juce::Path& path, const std::vector<float>& values, const juce::Rectangle<float>& plotArea)
+{
+    path.clear();
+
+    auto columnCount = m_bandColumnsPlotWidth;
+    m_columnMins.assign(columnCount, std::numeric_limits<float>::max());
+    m_columnMaxs.assign(columnCount, std::numeric_limits<float>::lowest());
+
+    // collapse all bands that fall onto the same pixel column into their min/max
+    for (int i = 0; i < int(values.size()) && i < int(m_bandColumns.size()); ++i)
+    {
+        auto column = m_bandColumns[i];
+        if (column < 0)
+            continue;
+        m_columnMins[column] = std::min(m_columnMins[column], values[i]);
+        m_columnMaxs[column] = std::max(m_columnMaxs[column], values[i]);
+    }
+
+    auto started = false;
+    for (int column = 0; column < columnCount; ++column)
+    {
+        if (m_columnMins[column] > m_columnMaxs[column])
+            continue; // no band on this column, the line interpolates across
+
+        auto x = plotArea.getX() + column + 0.5f;
+        auto maxY = plotArea.getBottom() - m_columnMaxs[column] * plotArea.getHeight();
+        auto minY = plotArea.getBottom() - m_columnMins[column] * plotArea.getHeight();
+
+        if (!started)
+        {
+            path.startNewSubPath(x, maxY);
+            started = true;
+        }
+        else
+            path.lineTo(x, maxY);
+
+        if (minY != maxY)
+            path.lineTo(x, minY);
+    }
+}
+
+void SpectrumAudioComponent::updatePlotPaths(int channelIdx)
+{
+    if (channelIdx < 0 || channelIdx >= int(m_plotPoints.size()))
+        return;
+
+    auto& plotPoints = m_plotPoints[channelIdx];
+    auto plotArea = getChannelPlotArea(channelIdx).toFloat();
+    if (plotPoints.peaks.empty() || plotPoints.holds.size() != plotPoints.peaks.size() || plotArea.getWidth() < 1.0f)
+    {
+        plotPoints.peakPath.clear();
+        plotPoints.holdPath.clear();
+        return;
+    }
+
+    updateBandColumns(plotPoints, static_cast<int>(plotArea.getWidth()));
+    updatePlotPath(plotPoints.holdPath, plotPoints.holds, plotArea);
+    updatePlotPath(plotPoints.peakPath, plotPoints.peaks, plotArea);
+}
+
 void SpectrumAudioComponent::resized()
 {
     auto bounds = getLocalBounds();
@@ -254,6 +293,9 @@ void SpectrumAudioComponent::resized()
     if (m_chNumSelButton)
         m_chNumSelButton->setBounds(bounds.removeFromTop(22).removeFromRight(22));
 
+    for (auto i = 0; i < int(m_plotPoints.size()); i++)
+        updatePlotPaths(i);
+
     AbstractAudioVisualizer::resized();
 }
 
@@ -284,24 +326,27 @@ void SpectrumAudioComponent::processingDataChanged(AbstractProcessorData* data)
                     setNumVisibleChannels(m_numAvailableChannels);
             }
 
+            auto changed = false;
             for (auto i = 0; i < getNumVisibleChannels(); i++)
             {
-                auto spectrum = sd->GetSpectrum(i);
-                if (spectrum.freqRes <= 0)
+                // read the shared spectrum store in place, only take over channels that were updated since last time
+                auto spectrum = sd->GetSpectrumView(i);
+                if (!spectrum.isValid() || spectrum.freqRes <= 0 || spectrum.generation == m_plotPoints[i].generation)
                     continue;
 
-                if (m_plotPoints[i].peaks.size() != spectrum.count)
-                    m_plotPoints[i].peaks.resize(spectrum.count);
-                memcpy(&m_plotPoints[i].peaks[0], &spectrum.bandsPeak[0], spectrum.count * sizeof(float));
-
-                if (m_plotPoints[i].holds.size() != spectrum.count)
-                    m_plotPoints[i].holds.resize(spectrum.count);
-                memcpy(&m_plotPoints[i].holds[0], &spectrum.bandsHold[0], spectrum.count * sizeof(float));
+                m_plotPoints[i].peaks.assign(spectrum.bandsPeak, spectrum.bandsPeak + spectrum.count);
+                m_plotPoints[i].holds.assign(spectrum.bandsHold, spectrum.bandsHold + spectrum.count);
 
                 m_plotPoints[i].minFreq = spectrum.minFreq;
                 m_plotPoints[i].maxFreq = spectrum.maxFreq;
                 m_plotPoints[i].freqRes = spectrum.freqRes;
+                m_plotPoints[i].generation = spectrum.generation;
+                updatePlotPaths(i);
+                changed = true;
             }
+
+            if (!changed)
+                break;
         }
         else
             break;
@@ -321,6 +366,11 @@ void SpectrumAudioComponent::setNumVisibleChannels(int numChannels)
 {
     m_numVisibleChannels = numChannels;
     m_plotPoints.resize(numChannels);
+
+    // plot areas depend on the number of visible channels
+    for (auto i = 0; i < numChannels; i++)
+        updatePlotPaths(i);
+    repaint();
 }
 
 int SpectrumAudioComponent::getNumVisibleChannels()
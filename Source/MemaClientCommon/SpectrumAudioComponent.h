@@ -25,13 +25,11 @@
 namespace Mema
 {
 
-class CustomPaintingAudioVisualiserComponent;
-
 /** @class SpectrumAudioComponent @brief FFT frequency-spectrum visualisation component for Mema.Mo. */
 class SpectrumAudioComponent    :   public AbstractAudioVisualizer
 {
 public:
-    /** @brief Cached per-channel FFT peak and hold data ready for painting. */
+    /** @brief Cached per-channel FFT peak and hold data, plus the plot paths decimated to pixel columns ready for painting. */
     struct PlotPoints
     {
         std::vector<float> peaks;
@@ -39,6 +37,9 @@ public:
         float minFreq;
         float maxFreq;
         float freqRes;
+        std::uint64_t generation = 0; ///< Generation of the spectrum data the points were taken from.
+        juce::Path peakPath; ///< Min/max per pixel column of the peak values, reused across frames.
+        juce::Path holdPath; ///< Min/max per pixel column of the hold values, reused across frames.
     };
 
 public:
@@ -59,10 +60,24 @@ public:
     void processingDataChanged(AbstractProcessorData *data) override;
 
 private:
+    //==============================================================================
+    juce::Rectangle<int> getChannelPlotArea(int channelIdx);
+    void updateBandColumns(const PlotPoints& plotPoints, int plotWidth);
+    void updatePlotPaths(int channelIdx);
+    void updatePlotPath(juce::Path& path, const std::vector<float>& values, const juce::Rectangle<float>& plotArea);
+
     //==============================================================================
     std::unique_ptr<juce::DrawableButton>   m_chNumSelButton;
     std::vector<PlotPoints>                 m_plotPoints;
 
+    //==============================================================================
+    std::vector<int>    m_bandColumns;              ///< Pixel column per spectrum band (-1 if outside the plotted range).
+    int                 m_bandColumnsPlotWidth = 0; ///< Plot width m_bandColumns was calculated for.
+    float               m_bandColumnsMinFreq = 0.0f;///< Band frequency range m_bandColumns was calculated for.
+    float               m_bandColumnsMaxFreq = 0.0f;
+    std::vector<float>  m_columnMins;               ///< Decimation scratch, minimum per pixel column.
+    std::vector<float>  m_columnMaxs;               ///< Decimation scratch, maximum per pixel column.
+
     //==============================================================================
     int m_numAvailableChannels = 0;
     int m_numVisibleChannels = 1;
@@ -90,6 +90,92 @@ private:
 };
 
 
+//==============================================================================
+/** @brief Analytical ellipse containment test, avoids building a path per mouse event. */
+static bool isWithinEllipse(const juce::Rectangle<float>& area, const juce::Point<float>& position)
+{
+    if (area.isEmpty())
+        return false;
+
+    auto normalisedX = (position.getX() - area.getCentreX()) / (0.5f * area.getWidth());
+    auto normalisedY = (position.getY() - area.getCentreY()) / (0.5f * area.getHeight());
+    return (normalisedX * normalisedX + normalisedY * normalisedY) <= 1.0f;
+}
+
+/** @brief Projects a position outside the ellipse onto its outline, along the line towards the ellipse centre. */
+static juce::Point<float> getConstrainedEllipsePoint(const juce::Rectangle<float>& area, const juce::Point<float>& position)
+{
+    auto delta = position - area.getCentre();
+    auto normalisedX = delta.getX() / (0.5f * area.getWidth());
+    auto normalisedY = delta.getY() / (0.5f * area.getHeight());
+    auto normalisedDistance = std::sqrt(normalisedX * normalisedX + normalisedY * normalisedY);
+    if (normalisedDistance <= 1.0f)
+        return position;
+
+    return area.getCentre() + delta / normalisedDistance;
+}
+
+
+//==============================================================================
+void TwoDFieldMultisliderComponent::KnobHitGrid::reset(const juce::Rectangle<int>& bounds, int cellSize)
+{
+    m_bounds = bounds;
+    m_cellSize = std::max(1, cellSize);
+    m_columns = bounds.isEmpty() ? 0 : (bounds.getWidth() + m_cellSize - 1) / m_cellSize;
+    m_rows = bounds.isEmpty() ? 0 : (bounds.getHeight() + m_cellSize - 1) / m_cellSize;
+
+    m_cells.resize(size_t(m_columns * m_rows));
+    for (auto& cell : m_cells)
+        cell.clear();
+}
+
+juce::Rectangle<int> TwoDFieldMultisliderComponent::KnobHitGrid::getCellRange(const juce::Rectangle<float>& area) const
+{
+    if (m_cells.empty() || area.isEmpty() || !area.intersects(m_bounds.toFloat()))
+        return {};
+
+    auto firstColumn = juce::jlimit(0, m_columns - 1, int(std::floor((area.getX() - m_bounds.getX()) / m_cellSize)));
+    auto lastColumn = juce::jlimit(0, m_columns - 1, int(std::floor((area.getRight() - m_bounds.getX()) / m_cellSize)));
+    auto firstRow = juce::jlimit(0, m_rows - 1, int(std::floor((area.getY() - m_bounds.getY()) / m_cellSize)));
+    auto lastRow = juce::jlimit(0, m_rows - 1, int(std::floor((area.getBottom() - m_bounds.getY()) / m_cellSize)));
+
+    return { firstColumn, firstRow, lastColumn - firstColumn + 1, lastRow - firstRow + 1 };
+}
+
+void TwoDFieldMultisliderComponent::KnobHitGrid::insert(std::uint16_t input, const juce::Rectangle<float>& knobArea)
+{
+    auto range = getCellRange(knobArea);
+    for (auto row = range.getY(); row < range.getBottom(); row++)
+        for (auto column = range.getX(); column < range.getRight(); column++)
+            m_cells[size_t(row * m_columns + column)].push_back(input);
+}
+
+void TwoDFieldMultisliderComponent::KnobHitGrid::remove(std::uint16_t input, const juce::Rectangle<float>& knobArea)
+{
+    auto range = getCellRange(knobArea);
+    for (auto row = range.getY(); row < range.getBottom(); row++)
+    {
+        for (auto column = range.getX(); column < range.getRight(); column++)
+        {
+            auto& cell = m_cells[size_t(row * m_columns + column)];
+            auto inputIter = std::find(cell.begin(), cell.end(), input);
+            if (inputIter != cell.end())
+                cell.erase(inputIter);
+        }
+    }
+}
+
+const std::vector<std::uint16_t>& TwoDFieldMultisliderComponent::KnobHitGrid::getInputsAt(const juce::Point<float>& position) const
+{
+    if (m_cells.empty() || !m_bounds.toFloat().contains(position))
+        return m_noInputs;
+
+    auto column = juce::jlimit(0, m_columns - 1, int((position.getX() - m_bounds.getX()) / m_cellSize));
+    auto row = juce::jlimit(0, m_rows - 1, int((position.getY() - m_bounds.getY()) / m_cellSize));
+    return m_cells[size_t(row * m_columns + column)];
+}
+
+
 //==============================================================================
 TwoDFieldMultisliderComponent::TwoDFieldMultisliderComponent()
     : JUCEAppBasics::TwoDFieldBase(), juce::Component()
@@ -147,21 +233,112 @@ void TwoDFieldMultisliderComponent::paint(juce::Graphics& g)
     // paint slider knobs
     jassert(m_inputPositions.size() == m_inputPositionStackingOrder.size());
     // reverse iteration, since what we want to be painted last(on top of everything) is at the beginning of the list!
-    for (auto const & inputNumber : std::vector<std::uint16_t>(m_inputPositionStackingOrder.rbegin(), m_inputPositionStackingOrder.rend()))
+    for (auto inputIter = m_inputPositionStackingOrder.rbegin(); inputIter != m_inputPositionStackingOrder.rend(); inputIter++)
     {
+        auto const& inputNumber = *inputIter;
         auto& inputPosition = m_inputPositions[inputNumber];
-        auto emptyRect = juce::Rectangle<float>();
-        auto& area = emptyRect;
-        if (ChannelLayer::Positioned == inputPosition.layer && !m_positionedChannelsArea.isEmpty())
-            area = m_positionedChannelsArea;
-        else if (ChannelLayer::PositionedHeight == inputPosition.layer && !m_positionedHeightChannelsArea.isEmpty())
-            area = m_positionedHeightChannelsArea;
-
-        if (!area.isEmpty())
+        if (ChannelLayer::Directionless == inputPosition.layer)
+            continue;
+
+        // skip knobs outside of a partial repaint
+        auto const& area = getLayerArea(inputPosition.layer);
+        if (!area.isEmpty() && g.clipRegionIntersects(getKnobRepaintArea(inputPosition)))
             paintSliderKnob(g, area, inputPosition.value.relXPos, inputPosition.value.relYPos, inputNumber, inputPosition.isOn, inputPosition.isSliding);
     }
 }
 
+const juce::Rectangle<float>& TwoDFieldMultisliderComponent::getLayerArea(const ChannelLayer& layer) const
+{
+    if (ChannelLayer::Positioned == layer && !m_positionedChannelsArea.isEmpty())
+        return m_positionedChannelsArea;
+    else if (ChannelLayer::PositionedHeight == layer && !m_positionedHeightChannelsArea.isEmpty())
+        return m_positionedHeightChannelsArea;
+    else if (ChannelLayer::Directionless == layer && !m_directionlessChannelsArea.isEmpty())
+        return m_directionlessChannelsArea;
+    else
+        return m_noArea;
+}
+
+juce::Rectangle<float> TwoDFieldMultisliderComponent::getKnobArea(const TwoDMultisliderSourcePosition& inputPosition) const
+{
+    auto const& area = getLayerArea(inputPosition.layer);
+    auto maxPoint = area.getCentre() + juce::Point<float>((area.getWidth() / 2) * inputPosition.value.relXPos, (area.getHeight() / 2) * inputPosition.value.relYPos * -1.0f);
+    return juce::Rectangle<float>(static_cast<float>(m_thumbWidth), static_cast<float>(m_thumbWidth)).withCentre(maxPoint);
+}
+
+juce::Rectangle<int> TwoDFieldMultisliderComponent::getKnobRepaintArea(const TwoDMultisliderSourcePosition& inputPosition) const
+{
+    // directionless knobs are not painted, the directionless sliders take care of themselves
+    auto const& area = getLayerArea(inputPosition.layer);
+    if (area.isEmpty() || ChannelLayer::Directionless == inputPosition.layer)
+        return {};
+
+    // knob itself plus the value track from the field centre
+    auto knobArea = getKnobArea(inputPosition);
+    auto trackArea = juce::Rectangle<float>(area.getCentre(), knobArea.getCentre()).expanded(0.5f * m_trackWidth + 1.0f);
+    return knobArea.getUnion(trackArea).expanded(2.0f).getSmallestIntegerContainer();
+}
+
+std::uint16_t TwoDFieldMultisliderComponent::getKnobAt(const juce::Point<float>& position) const
+{
+    // of all knobs registered in the grid cell, the topmost one in stacking order wins
+    auto hitInput = std::uint16_t(0);
+    auto hitStackingIter = m_inputPositionStackingOrder.end();
+    for (auto const& input : m_knobHitGrid.getInputsAt(position))
+    {
+        auto knobAreaIter = m_knobAreas.find(input);
+        if (knobAreaIter == m_knobAreas.end() || !knobAreaIter->second.contains(position))
+            continue;
+
+        auto stackingIter = std::find(m_inputPositionStackingOrder.begin(), m_inputPositionStackingOrder.end(), input);
+        if (stackingIter < hitStackingIter)
+        {
+            hitStackingIter = stackingIter;
+            hitInput = input;
+        }
+    }
+
+    return hitInput;
+}
+
+void TwoDFieldMultisliderComponent::rebuildKnobHitGrid()
+{
+    m_knobHitGrid.reset(getLocalBounds(), std::max(8, m_thumbWidth));
+    m_knobAreas.clear();
+    for (auto const& inputPositionKV : m_inputPositions)
+    {
+        auto knobArea = getKnobArea(inputPositionKV.second);
+        m_knobAreas[inputPositionKV.first] = knobArea;
+        m_knobHitGrid.insert(inputPositionKV.first, knobArea);
+    }
+}
+
+void TwoDFieldMultisliderComponent::updateKnob(std::uint16_t channel, const TwoDMultisliderSourcePosition& previousPosition)
+{
+    auto const& inputPosition = m_inputPositions[channel];
+
+    // move the knob within the hit grid
+    auto knobAreaIter = m_knobAreas.find(channel);
+    if (knobAreaIter != m_knobAreas.end())
+        m_knobHitGrid.remove(channel, knobAreaIter->second);
+    auto knobArea = getKnobArea(inputPosition);
+    m_knobAreas[channel] = knobArea;
+    m_knobHitGrid.insert(channel, knobArea);
+
+    // only repaint where the knob and its track were and now are, plus the level tracks in the fields
+    repaint(getKnobRepaintArea(previousPosition));
+    repaint(getKnobRepaintArea(inputPosition));
+}
+
+void TwoDFieldMultisliderComponent::repaintLevelIndication()
+{
+    // level paths and lines never exceed the field circles by more than the meter width
+    if (!m_positionedChannelsArea.isEmpty())
+        repaint(m_positionedChannelsArea.expanded(4.0f).getSmallestIntegerContainer());
+    if (!m_positionedHeightChannelsArea.isEmpty())
+        repaint(m_positionedHeightChannelsArea.expanded(4.0f).getSmallestIntegerContainer());
+}
+
 void TwoDFieldMultisliderComponent::paintCircularLevelIndication(juce::Graphics& g, const juce::Rectangle<float>& circleArea, const std::map<int, juce::Point<float>>& channelLevelMaxPoints, const juce::Array<juce::AudioChannelSet::ChannelType>& channelsToPaint)
 {
 #if defined DEBUG && defined PAINTINGHELPER
@@ -466,6 +643,8 @@ void TwoDFieldMultisliderComponent::resized()
                 label->setBounds(labelBounds);
         }
     }
+
+    rebuildKnobHitGrid();
 }
 
 void TwoDFieldMultisliderComponent::lookAndFeelChanged()
@@ -480,35 +659,22 @@ void TwoDFieldMultisliderComponent::lookAndFeelChanged()
 
 void TwoDFieldMultisliderComponent::mouseDown(const juce::MouseEvent& e)
 {
-    // hit-test slider knobs
-    auto hadHit = false;
-    jassert(m_inputPositions.size() == m_inputPositionStackingOrder.size());
-    for (auto const& inputNumber : m_inputPositionStackingOrder)
-    {
-        auto& inputPosition = m_inputPositions[inputNumber];
-        auto emptyRect = juce::Rectangle<float>();
-        auto& area = emptyRect;
-        if (ChannelLayer::Positioned == inputPosition.layer && !m_positionedChannelsArea.isEmpty())
-            area = m_positionedChannelsArea;
-        else if (ChannelLayer::PositionedHeight == inputPosition.layer && !m_positionedHeightChannelsArea.isEmpty())
-            area = m_positionedHeightChannelsArea;
-        else if (ChannelLayer::Directionless == inputPosition.layer && !m_directionlessChannelsArea.isEmpty())
-            area = m_directionlessChannelsArea;
-
-        auto maxPoint = area.getCentre() - juce::Point<float>((area.getWidth() / 2) * -inputPosition.value.relXPos, (area.getHeight() / 2) * inputPosition.value.relYPos);
-        auto sliderKnob = juce::Rectangle<float>(static_cast<float>(m_thumbWidth), static_cast<float>(m_thumbWidth)).withCentre(maxPoint);
-        if (sliderKnob.contains(e.getMouseDownPosition().toFloat()) && false == hadHit)
-        {
-            inputPosition.isOn = true;
+    // hit-test slider knobs via the grid
+    auto hitInput = getKnobAt(e.getMouseDownPosition().toFloat());
 
-            selectInput(inputNumber, true, juce::sendNotification);
+    // deselect only those inputs whose selection state actually changes
+    std::vector<std::uint16_t> inputsToDeselect;
+    for (auto const& inputPositionKV : m_inputPositions)
+        if (inputPositionKV.first != hitInput && (inputPositionKV.second.isSliding || inputPositionKV.first == m_currentlySelectedInput))
+            inputsToDeselect.push_back(inputPositionKV.first);
+    for (auto const& inputNumber : inputsToDeselect)
+        selectInput(inputNumber, false, juce::sendNotification);
 
-            hadHit = true;
-        }
-        else
-        {
-            selectInput(inputNumber, false, juce::sendNotification);
-        }
+    if (0 != hitInput)
+    {
+        m_inputPositions[hitInput].isOn = true;
+
+        selectInput(hitInput, true, juce::sendNotification);
     }
 
     juce::Component::mouseDown(e);
@@ -530,21 +696,12 @@ void TwoDFieldMultisliderComponent::mouseDrag(const MouseEvent& e)
             auto& inputPosition = m_inputPositions[inputNumber];
             if (inputPosition.isSliding)
             {
-                auto emptyRect = juce::Rectangle<float>();
-                auto& area = emptyRect;
-                if (ChannelLayer::Positioned == inputPosition.layer && !m_positionedChannelsArea.isEmpty())
-                    area = m_positionedChannelsArea;
-                else if (ChannelLayer::PositionedHeight == inputPosition.layer && !m_positionedHeightChannelsArea.isEmpty())
-                    area = m_positionedHeightChannelsArea;
-                else if (ChannelLayer::Directionless == inputPosition.layer && !m_directionlessChannelsArea.isEmpty())
-                    area = m_directionlessChannelsArea;
+                auto const& area = getLayerArea(inputPosition.layer);
 
                 auto mousePosition = e.getMouseDownPosition() + e.getOffsetFromDragStart();
                 
-                juce::Path ellipsePath;
-                ellipsePath.addEllipse(area);
                 // if the mouse is within the resp. circle, do the regular calculation of knob pos
-                if (ellipsePath.contains(mousePosition.toFloat()))
+                if (isWithinEllipse(area, mousePosition.toFloat()))
                 {
                     auto positionInArea = area.getCentre() - area.getConstrainedPoint(mousePosition.toFloat());
                     auto relXPos = positionInArea.getX() / (0.5f * area.getWidth());
@@ -553,18 +710,15 @@ void TwoDFieldMultisliderComponent::mouseDrag(const MouseEvent& e)
                 }
                 else
                 {
-                    juce::Path positionedChannelsEllipsePath, positionedHeightChannelsEllipsePath;
-                    positionedChannelsEllipsePath.addEllipse(m_positionedChannelsArea);
-                    positionedHeightChannelsEllipsePath.addEllipse(m_positionedHeightChannelsArea);
                     // check if the mouse has entered another circle area while dragging
-                    if (positionedChannelsEllipsePath.contains(mousePosition.toFloat()))
+                    if (isWithinEllipse(m_positionedChannelsArea, mousePosition.toFloat()))
                     {
                         auto positionInArea = m_positionedChannelsArea.getCentre() - m_positionedChannelsArea.getConstrainedPoint(mousePosition.toFloat());
                         auto relXPos = positionInArea.getX() / (0.5f * m_positionedChannelsArea.getWidth());
                         auto relYPos = positionInArea.getY() / (0.5f * m_positionedChannelsArea.getHeight());
                         setInputPosition(inputNumber, { -relXPos, relYPos }, inputPosition.sharpness, ChannelLayer::Positioned, juce::sendNotification);
                     }
-                    else if (positionedHeightChannelsEllipsePath.contains(mousePosition.toFloat()))
+                    else if (isWithinEllipse(m_positionedHeightChannelsArea, mousePosition.toFloat()))
                     {
                         auto positionInArea = m_positionedHeightChannelsArea.getCentre() - m_positionedHeightChannelsArea.getConstrainedPoint(mousePosition.toFloat());
                         auto relXPos = positionInArea.getX() / (0.5f * m_positionedHeightChannelsArea.getWidth());
@@ -574,12 +728,9 @@ void TwoDFieldMultisliderComponent::mouseDrag(const MouseEvent& e)
                     // finally do the clipping to original circle, if the dragging happens somewhere outside everything
                     else
                     {
-                        juce::Point<float> constrainedPoint;
-                        ellipsePath.getNearestPoint(mousePosition.toFloat(), constrainedPoint);
-                        auto positionInArea = area.getCentre() - constrainedPoint;
+                        auto positionInArea = area.getCentre() - getConstrainedEllipsePoint(area, mousePosition.toFloat());
                         auto relXPos = positionInArea.getX() / (0.5f * area.getWidth());
                         auto relYPos = positionInArea.getY() / (0.5f * area.getHeight());
-                        inputPosition.value = { relXPos, relYPos };
                         setInputPosition(inputNumber, { -relXPos, relYPos }, inputPosition.sharpness, inputPosition.layer, juce::sendNotification);
                     }
 
@@ -594,11 +745,12 @@ void TwoDFieldMultisliderComponent::mouseDrag(const MouseEvent& e)
 void TwoDFieldMultisliderComponent::setInputPosition(std::uint16_t channel, const TwoDMultisliderValue& value, const float& sharpness, const ChannelLayer& layer, juce::NotificationType notification)
 {
     jassert(m_inputPositions.size() == m_inputPositionStackingOrder.size());
+    auto previousPosition = m_inputPositions[channel];
     m_inputPositions[channel].value = value;
     m_inputPositions[channel].sharpness = sharpness;
     m_inputPositions[channel].layer = layer;
 
-    repaint();
+    updateKnob(channel, previousPosition);
 
     DBG(juce::String(__FUNCTION__) << " new pos: " << int(channel) << " " << value.relXPos << "," << value.relYPos << "(" << sharpness << "/" << layer << ")");
 
@@ -609,9 +761,10 @@ void TwoDFieldMultisliderComponent::setInputPosition(std::uint16_t channel, cons
 void TwoDFieldMultisliderComponent::setInputPositionValue(std::uint16_t channel, const TwoDMultisliderValue& value, juce::NotificationType notification)
 {
     jassert(m_inputPositions.size() == m_inputPositionStackingOrder.size());
+    auto previousPosition = m_inputPositions[channel];
     m_inputPositions[channel].value = value;
 
-    repaint();
+    updateKnob(channel, previousPosition);
 
     DBG(juce::String(__FUNCTION__) << " new pos: " << int(channel) << " " << value.relXPos << "," << value.relYPos << "(" << m_inputPositions[channel].sharpness << "/" << m_inputPositions[channel].layer << ")");
 
@@ -627,8 +780,6 @@ void TwoDFieldMultisliderComponent::setInputPositionSharpness(std::uint16_t chan
     if (m_sharpnessEdit && 0 != m_currentlySelectedInput)
         m_sharpnessEdit->setText(juce::String(sharpness), juce::dontSendNotification);
 
-    repaint();
-
     DBG(juce::String(__FUNCTION__) << " new pos: " << int(channel) << " " << m_inputPositions[channel].value.relXPos << "," << m_inputPositions[channel].value.relYPos << "(" << sharpness << "/" << m_inputPositions[channel].layer << ")");
 
     if (juce::dontSendNotification != notification && onInputPositionChanged)
@@ -638,9 +789,10 @@ void TwoDFieldMultisliderComponent::setInputPositionSharpness(std::uint16_t chan
 void TwoDFieldMultisliderComponent::setInputPositionLayer(std::uint16_t channel, const ChannelLayer& layer, juce::NotificationType notification)
 {
     jassert(m_inputPositions.size() == m_inputPositionStackingOrder.size());
+    auto previousPosition = m_inputPositions[channel];
     m_inputPositions[channel].layer = layer;
 
-    repaint();
+    updateKnob(channel, previousPosition);
 
     DBG(juce::String(__FUNCTION__) << " new pos: " << int(channel) << " " << m_inputPositions[channel].value.relXPos << "," << m_inputPositions[channel].value.relYPos << "(" << m_inputPositions[channel].sharpness << "/" << layer << ")");
 
@@ -665,6 +817,7 @@ void TwoDFieldMultisliderComponent::selectInput(std::uint16_t channel, bool sele
     if (0 == m_inputPositions.count(channel))
         return;
 
+    auto previousPosition = m_inputPositions[channel];
     if (selectOn)
     {
         auto posIter = std::find(m_inputPositionStackingOrder.begin(), m_inputPositionStackingOrder.end(), channel);
@@ -681,7 +834,9 @@ void TwoDFieldMultisliderComponent::selectInput(std::uint16_t channel, bool sele
     else if (m_currentlySelectedInput != channel && selectOn)
         m_currentlySelectedInput = channel;
 
-    repaint();
+    // knob stacking and track changed, the level tracks are highlighted for the selected input
+    updateKnob(channel, previousPosition);
+    repaintLevelIndication();
 
     if (!m_directionslessChannelSliders.empty() && !m_inputToOutputVals.empty())
     {
@@ -766,6 +921,7 @@ void TwoDFieldMultisliderComponent::setIOCount(const std::pair<int, int>& ioCoun
 
     m_currentOutputCount = ioCount.second;
 
+    rebuildKnobHitGrid();
     repaint();
 }
 
@@ -794,7 +950,7 @@ void TwoDFieldMultisliderComponent::setInputToOutputStates(const std::map<std::u
         }
     }
 
-    repaint();
+    repaintLevelIndication();
 }
 
 void TwoDFieldMultisliderComponent::setInputToOutputLevels(const std::map<std::uint16_t, std::map<std::uint16_t, float>>& inputToOutputLevels)
@@ -817,14 +973,18 @@ void TwoDFieldMultisliderComponent::setInputToOutputLevels(const std::map<std::u
             if (sliderKV.second && sliderKV.second->displayValueConverter) // hacky: use the presence of the valueconverter as indicator if we need to switch to relctrl or not
                 configureDirectionlessSliderToRelativeCtrl(sliderKV.first, *sliderKV.second);
 
-    repaint();
+    repaintLevelIndication();
 }
 
 bool TwoDFieldMultisliderComponent::setChannelConfiguration(const juce::AudioChannelSet& channelLayout)
 {
     auto wasUpdated = TwoDFieldBase::setChannelConfiguration(channelLayout);
     if (wasUpdated)
+    {
         rebuildDirectionslessChannelSliders();
+        resized(); // field areas and the knob hit grid depend on the channel configuration
+        repaint();
+    }
 
     return wasUpdated;
 }
@@ -102,6 +102,38 @@ public:
     std::function<void(const std::map<std::uint16_t, std::map<std::uint16_t, float>>&)> onInputToOutputValuesChanged;
 
 private:
+    /**
+     * @brief Uniform grid over the component bounds, listing the inputs whose knob overlaps each cell.
+     * @details Rebuilt on resize, channel config or io count changes and updated per knob when a single input moves,
+     *          so mouse hit-testing only has to look at the few knobs in the cell under the mouse.
+     */
+    struct KnobHitGrid
+    {
+        void reset(const juce::Rectangle<int>& bounds, int cellSize);
+        void insert(std::uint16_t input, const juce::Rectangle<float>& knobArea);
+        void remove(std::uint16_t input, const juce::Rectangle<float>& knobArea);
+        const std::vector<std::uint16_t>& getInputsAt(const juce::Point<float>& position) const;
+
+    private:
+        juce::Rectangle<int> getCellRange(const juce::Rectangle<float>& area) const;
+
+        juce::Rectangle<int>                        m_bounds;
+        int                                         m_cellSize = 1;
+        int                                         m_columns = 0;
+        int                                         m_rows = 0;
+        std::vector<std::vector<std::uint16_t>>     m_cells;
+        std::vector<std::uint16_t>                  m_noInputs;
+    };
+
+    //==============================================================================
+    const juce::Rectangle<float>& getLayerArea(const ChannelLayer& layer) const;
+    juce::Rectangle<float> getKnobArea(const TwoDMultisliderSourcePosition& inputPosition) const;
+    juce::Rectangle<int> getKnobRepaintArea(const TwoDMultisliderSourcePosition& inputPosition) const;
+    std::uint16_t getKnobAt(const juce::Point<float>& position) const;
+    void rebuildKnobHitGrid();
+    void updateKnob(std::uint16_t channel, const TwoDMultisliderSourcePosition& previousPosition);
+    void repaintLevelIndication();
+
     //==============================================================================
     void paintCircularLevelIndication(juce::Graphics& g, const juce::Rectangle<float>& circleArea, const std::map<int, juce::Point<float>>& channelLevelMaxPoints, const juce::Array<juce::AudioChannelSet::ChannelType>& channelsToPaint);
     void paintSliderKnob(juce::Graphics& g, const juce::Rectangle<float>& sliderArea, const float& relXPos, const float& relYPos, const int& silderNumber, bool isSliderOn, bool isSliderSliding);
@@ -121,6 +153,10 @@ private:
     std::vector<std::uint16_t>                              m_inputPositionStackingOrder;
     std::uint16_t                                           m_currentlySelectedInput = 0;
 
+    KnobHitGrid                                             m_knobHitGrid;
+    std::map<std::uint16_t, juce::Rectangle<float>>         m_knobAreas;    ///< Knob area per input as currently registered in m_knobHitGrid.
+    const juce::Rectangle<float>                            m_noArea;
+
     std::unique_ptr<juce::Label>                            m_sharpnessLabel;
     std::unique_ptr<JUCEAppBasics::FixedFontTextEditor>     m_sharpnessEdit;
 
@@ -45,12 +45,12 @@ void TwoDFieldOutputComponent::paint (juce::Graphics& g)
     g.fillAll(getLookAndFeel().findColour(juce::ResizableWindow::backgroundColourId));
 
     // paint the level indications where applicable
-    if (!m_positionedChannelsArea.isEmpty())
-        paintCircularLevelIndication(g, m_positionedChannelsArea, m_channelLevelMaxPoints, m_clockwiseOrderedChannelTypes);
-    if (!m_positionedHeightChannelsArea.isEmpty())
-        paintCircularLevelIndication(g, m_positionedHeightChannelsArea, m_channelHeightLevelMaxPoints, m_clockwiseOrderedHeightChannelTypes);
+    if (!m_positionedChannelsGeometry.area.isEmpty())
+        paintCircularLevelIndication(g, m_positionedChannelsGeometry);
+    if (!m_positionedHeightChannelsGeometry.area.isEmpty())
+        paintCircularLevelIndication(g, m_positionedHeightChannelsGeometry);
     if (!m_directionlessChannelsArea.isEmpty())
-        paintLevelMeterIndication(g, m_directionlessChannelsArea, m_directionLessChannelTypes);
+        paintLevelMeterIndication(g, m_directionlessChannelsArea);
 
     // draw dBFS
     g.setFont(12.0f);
@@ -63,8 +63,26 @@ void TwoDFieldOutputComponent::paint (juce::Graphics& g)
     g.drawText(rangeText, getLocalBounds(), juce::Justification::topRight, true);
 }
 
-void TwoDFieldOutputComponent::paintCircularLevelIndication(juce::Graphics& g, const juce::Rectangle<float>& circleArea, const std::map<int, juce::Point<float>>& channelLevelMaxPoints, const juce::Array<juce::AudioChannelSet::ChannelType>& channelsToPaint)
+void TwoDFieldOutputComponent::updateLevelPoints(const CircularFieldGeometry& geometry, ProcessorLevelData::LevelType levelType)
 {
+    auto levelChannelCount = static_cast<int>(m_levelData.GetChannelCount());
+    auto levelValues = getUsesValuesInDB() ? m_levelData.GetLevelFactorsdB(levelType) : m_levelData.GetLevels(levelType);
+
+    // only scale the cached per channel vectors by the current level
+    m_levelPoints.resize(geometry.channels.size());
+    for (auto i = 0; i < int(geometry.channels.size()); i++)
+    {
+        auto const& channelGeometry = geometry.channels[i];
+        auto level = (channelGeometry.channel >= 1 && channelGeometry.channel <= levelChannelCount) ? levelValues[channelGeometry.channel - 1] : 0.0f;
+        m_levelPoints[i] = geometry.centre - (channelGeometry.centerToMax * level);
+    }
+}
+
+void TwoDFieldOutputComponent::paintCircularLevelIndication(juce::Graphics& g, const CircularFieldGeometry& geometry)
+{
+    auto const& circleArea = geometry.area;
+    auto const& circleCenter = geometry.centre;
+
 #if defined DEBUG && defined PAINTINGHELPER
     g.setColour(juce::Colours::blueviolet);
     g.drawRect(circleArea);
@@ -81,122 +99,53 @@ void TwoDFieldOutputComponent::paintCircularLevelIndication(juce::Graphics& g, c
     g.drawRect(getLocalBounds());
 #endif
 
-
     const float meterWidth = 5.0f;
-    const float halfMeterWidth = 2.0f;
-
 
     // helper std::function to avoid codeclones below
-    auto calcLevelVals = [=](std::map<int, float>& levels, bool isHold, bool isPeak, bool isRms) {
-        for (auto const& channelType : channelsToPaint)
-        {
-            if (isHold)
-            {
-                if (getUsesValuesInDB())
-                    levels[channelType] = m_levelData.GetLevel(getChannelNumberForChannelTypeInCurrentConfiguration(channelType)).GetFactorHOLDdB();
-                else
-                    levels[channelType] = m_levelData.GetLevel(getChannelNumberForChannelTypeInCurrentConfiguration(channelType)).hold;
-            }
-            else if (isPeak)
-            {
-                if (getUsesValuesInDB())
-                    levels[channelType] = m_levelData.GetLevel(getChannelNumberForChannelTypeInCurrentConfiguration(channelType)).GetFactorPEAKdB();
-                else
-                    levels[channelType] = m_levelData.GetLevel(getChannelNumberForChannelTypeInCurrentConfiguration(channelType)).peak;
-            }
-            else if (isRms)
-            {
-                if (getUsesValuesInDB())
-                    levels[channelType] = m_levelData.GetLevel(getChannelNumberForChannelTypeInCurrentConfiguration(channelType)).GetFactorRMSdB();
-                else
-                    levels[channelType] = m_levelData.GetLevel(getChannelNumberForChannelTypeInCurrentConfiguration(channelType)).rms;
-            }
-        }
-    };
-    // calculate hold values
-    std::map<int, float> holdLevels;
-    calcLevelVals(holdLevels, true, false, false);
-    // calculate peak values
-    std::map<int, float> peakLevels;
-    calcLevelVals(peakLevels, false, true, false);
-    // calculate rms values    
-    std::map<int, float> rmsLevels;
-    calcLevelVals(rmsLevels, false, false, true);
-
-
-    auto circleCenter = circleArea.getCentre();
-
-    // prepare max points
-    std::map<int, juce::Point<float>> centerToMaxVectors;
-    std::map<int, juce::Point<float>> meterWidthOffsetVectors;
-    for (int i = 0; i < channelsToPaint.size(); i++)
-    {
-        auto const& channelType = channelsToPaint[i];
-        if (0 < channelLevelMaxPoints.count(channelType))
-        {
-            auto angleRad = juce::degreesToRadians(getAngleForChannelTypeInCurrentConfiguration(channelType));
-            centerToMaxVectors[channelType] = circleCenter - channelLevelMaxPoints.at(channelType);
-            meterWidthOffsetVectors[channelType] = { cosf(angleRad) * halfMeterWidth, sinf(angleRad) * halfMeterWidth };
-        }
-    }
+    auto paintLevel = [&](ProcessorLevelData::LevelType levelType, juce::Graphics& g, const juce::Colour& colour, bool isHold) {
+        updateLevelPoints(geometry, levelType);
 
-    // helper std::function to avoid codeclones below
-    auto createAndPaintLevelPath = [=](std::map<int, juce::Point<float>>& centerToMaxPoints, std::map<int, juce::Point<float>>& meterWidthOffsetPoints, std::map<int, float>& levels, juce::Graphics& g, const juce::Colour& colour, bool stroke) {
-        juce::Path path;
-        auto pathStarted = false;
-        for (auto const& channelType : channelsToPaint)
+        // level outline path, reusing the path storage across frames
+        m_levelPath.clear();
+        for (auto i = 0; i < int(geometry.channels.size()); i++)
         {
-            auto channelMaxPoint = circleCenter - (centerToMaxPoints[channelType] * levels[channelType]);
-
-            if (!pathStarted)
-            {
-                path.startNewSubPath(channelMaxPoint - meterWidthOffsetPoints[channelType]);
-                pathStarted = true;
-            }
+            auto const& meterWidthOffset = geometry.channels[i].meterWidthOffset;
+            if (0 == i)
+                m_levelPath.startNewSubPath(m_levelPoints[i] - meterWidthOffset);
             else
-                path.lineTo(channelMaxPoint - meterWidthOffsetPoints[channelType]);
+                m_levelPath.lineTo(m_levelPoints[i] - meterWidthOffset);
 
-            path.lineTo(channelMaxPoint + meterWidthOffsetPoints[channelType]);
+            m_levelPath.lineTo(m_levelPoints[i] + meterWidthOffset);
         }
-        path.closeSubPath();
+        m_levelPath.closeSubPath();
 
         g.setColour(colour);
-        if (stroke)
-            g.strokePath(path, juce::PathStrokeType(1));
+        if (isHold)
+            g.strokePath(m_levelPath, juce::PathStrokeType(1));
         else
-            g.fillPath(path);
+            g.fillPath(m_levelPath);
 #if defined DEBUG && defined PAINTINGHELPER
         g.setColour(juce::Colours::yellow);
-        g.drawRect(path.getBounds());
+        g.drawRect(m_levelPath.getBounds());
+        g.setColour(colour);
 #endif
-    };
-    // paint hold values as path
-    createAndPaintLevelPath(centerToMaxVectors, meterWidthOffsetVectors, holdLevels, g, getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringHoldColourId), true);
-    // paint peak values as path
-    createAndPaintLevelPath(centerToMaxVectors, meterWidthOffsetVectors, peakLevels, g, getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringPeakColourId), false);
-    // paint rms values as path
-    createAndPaintLevelPath(centerToMaxVectors, meterWidthOffsetVectors, rmsLevels, g, getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringRmsColourId), false);
 
-
-    // helper std::function to avoid codeclones below
-    auto paintLevelMeterLines = [=](std::map<int, juce::Point<float>>& centerToMaxPoints, std::map<int, juce::Point<float>>& meterWidthOffsetPoints, std::map<int, float>& levels, juce::Graphics& g, const juce::Colour& colour, bool isHoldLine) {
-        g.setColour(colour);
-        for (auto const& channelType : channelsToPaint)
+        // level meter lines
+        for (auto i = 0; i < int(geometry.channels.size()); i++)
         {
-            auto channelMaxPoint = circleCenter - (centerToMaxPoints[channelType] * levels[channelType]);
-
-            if (isHoldLine)
-                g.drawLine(juce::Line<float>(channelMaxPoint - meterWidthOffsetPoints[channelType], channelMaxPoint + meterWidthOffsetPoints[channelType]), 1.0f);
+            auto const& meterWidthOffset = geometry.channels[i].meterWidthOffset;
+            if (isHold)
+                g.drawLine(juce::Line<float>(m_levelPoints[i] - meterWidthOffset, m_levelPoints[i] + meterWidthOffset), 1.0f);
             else
-                g.drawLine(juce::Line<float>(circleCenter, channelMaxPoint), meterWidth);
+                g.drawLine(juce::Line<float>(circleCenter, m_levelPoints[i]), meterWidth);
         }
     };
-    // paint hold values as max line
-    paintLevelMeterLines(centerToMaxVectors, meterWidthOffsetVectors, holdLevels, g, getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringHoldColourId), true);
-    // paint peak values as line
-    paintLevelMeterLines(centerToMaxVectors, meterWidthOffsetVectors, peakLevels, g, getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringPeakColourId), false);
-    // paint rms values as line
-    paintLevelMeterLines(centerToMaxVectors, meterWidthOffsetVectors, rmsLevels, g, getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringRmsColourId), false);
+    // paint hold values as path and max line
+    paintLevel(ProcessorLevelData::Hold, g, getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringHoldColourId), true);
+    // paint peak values as path and line
+    paintLevel(ProcessorLevelData::Peak, g, getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringPeakColourId), false);
+    // paint rms values as path and line
+    paintLevel(ProcessorLevelData::Rms, g, getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringRmsColourId), false);
 
     // draw a simple circle surrounding
     g.setColour(getLookAndFeel().findColour(juce::TextButton::textColourOffId));
@@ -204,32 +153,22 @@ void TwoDFieldOutputComponent::paintCircularLevelIndication(juce::Graphics& g, c
 
     // draw dashed field dimension indication lines
     float dparam[]{ 4.0f, 5.0f };
-    for (auto const& channelType : channelsToPaint)
-        if (0 < channelLevelMaxPoints.count(channelType))
-            g.drawDashedLine(juce::Line<float>(channelLevelMaxPoints.at(channelType), circleCenter), dparam, 2);
+    for (auto const& channelGeometry : geometry.channels)
+        g.drawDashedLine(juce::Line<float>(channelGeometry.maxPoint, circleCenter), dparam, 2);
 
     // draw channelType naming legend
     g.setColour(getLookAndFeel().findColour(juce::TextButton::textColourOffId));
-    for (auto const& channelType : channelsToPaint)
+    for (auto const& channelGeometry : geometry.channels)
     {
-        if (0 >= channelLevelMaxPoints.count(channelType))
-            continue;
-
-        auto channelName = juce::AudioChannelSet::getAbbreviatedChannelTypeName(channelType);
+        auto channelName = juce::AudioChannelSet::getAbbreviatedChannelTypeName(channelGeometry.channelType);
         auto textRect = juce::Rectangle<float>(juce::GlyphArrangement::getStringWidth(g.getCurrentFont(), channelName), g.getCurrentFont().getHeight());
-        auto angle = getAngleForChannelTypeInCurrentConfiguration(channelType);
         auto textRectOffset = juce::Point<int>(-int(textRect.getWidth() / 2.0f), 0);
-        if (90.0f < angle)
-            angle += 180.0f;
-        else if (-90.0f > angle)
-            angle -= 180.0f;
-        else
+        if (channelGeometry.labelAbove)
             textRectOffset.addXY(0, -int(g.getCurrentFont().getHeight()));
-        auto angleRad = juce::degreesToRadians(angle);
 
         g.saveState();
-        g.setOrigin(channelLevelMaxPoints.at(channelType).toInt());
-        g.addTransform(juce::AffineTransform().translated(textRectOffset).rotated(angleRad));
+        g.setOrigin(channelGeometry.maxPoint.toInt());
+        g.addTransform(juce::AffineTransform().translated(textRectOffset).rotated(channelGeometry.labelAngleRad));
         g.drawText(channelName, textRect, Justification::centred, true);
 
 #if defined DEBUG && defined PAINTINGHELPER
@@ -242,8 +181,10 @@ void TwoDFieldOutputComponent::paintCircularLevelIndication(juce::Graphics& g, c
     }
 }
 
-void TwoDFieldOutputComponent::paintLevelMeterIndication(juce::Graphics& g, const juce::Rectangle<float>& levelMeterArea, const juce::Array<juce::AudioChannelSet::ChannelType>& channelsToPaint)
+void TwoDFieldOutputComponent::paintLevelMeterIndication(juce::Graphics& g, const juce::Rectangle<float>& levelMeterArea)
 {
+    auto const& channelsToPaint = m_directionLessChannelTypes;
+
 #if defined DEBUG && defined PAINTINGHELPER
     g.setColour(juce::Colours::aqua);
     g.drawRect(levelMeterArea);
@@ -261,24 +202,24 @@ void TwoDFieldOutputComponent::paintLevelMeterIndication(juce::Graphics& g, cons
     auto meterMaxLength = visuArea.getHeight();
     auto meterLeft = levelMeterArea.getX() + 0.5f * meterSpacing;
 
+    auto levelChannelCount = static_cast<int>(m_levelData.GetChannelCount());
+    auto peakLevels = getUsesValuesInDB() ? m_levelData.GetLevelFactorsdB(ProcessorLevelData::Peak) : m_levelData.GetLevels(ProcessorLevelData::Peak);
+    auto rmsLevels = getUsesValuesInDB() ? m_levelData.GetLevelFactorsdB(ProcessorLevelData::Rms) : m_levelData.GetLevels(ProcessorLevelData::Rms);
+    auto holdLevels = getUsesValuesInDB() ? m_levelData.GetLevelFactorsdB(ProcessorLevelData::Hold) : m_levelData.GetLevels(ProcessorLevelData::Hold);
+
     g.setFont(14.0f);
-    for (auto const& channelType : channelsToPaint)
+    for (auto i = 0; i < channelsToPaint.size(); i++)
     {
-        auto level = m_levelData.GetLevel(getChannelNumberForChannelTypeInCurrentConfiguration(channelType));
+        auto const& channelType = channelsToPaint[i];
+        auto channel = i < int(m_directionlessChannels.size()) ? m_directionlessChannels[i] : 0;
         float peakMeterLength{ 0 };
         float rmsMeterLength{ 0 };
         float holdMeterLength{ 0 };
-        if (getUsesValuesInDB())
-        {
-            peakMeterLength = meterMaxLength * level.GetFactorPEAKdB();
-            rmsMeterLength = meterMaxLength * level.GetFactorRMSdB();
-            holdMeterLength = meterMaxLength * level.GetFactorHOLDdB();
-        }
-        else
+        if (channel >= 1 && channel <= levelChannelCount)
         {
-            peakMeterLength = meterMaxLength * level.peak;
-            rmsMeterLength = meterMaxLength * level.rms;
-            holdMeterLength = meterMaxLength * level.hold;
+            peakMeterLength = meterMaxLength * peakLevels[channel - 1];
+            rmsMeterLength = meterMaxLength * rmsLevels[channel - 1];
+            holdMeterLength = meterMaxLength * holdLevels[channel - 1];
         }
 
         // peak bar
@@ -371,9 +312,68 @@ void TwoDFieldOutputComponent::resized()
         m_channelHeightLevelMaxPoints[channelType] = m_positionedHeightChannelsArea.getCentre() + juce::Point<float>(xLength, -yLength);
     }
 
+    updateGeometry();
+
     AbstractAudioVisualizer::resized();
 }
 
+bool TwoDFieldOutputComponent::setChannelConfiguration(const juce::AudioChannelSet& channelLayout)
+{
+    auto wasUpdated = JUCEAppBasics::TwoDFieldBase::setChannelConfiguration(channelLayout);
+    if (wasUpdated)
+        resized();
+
+    return wasUpdated;
+}
+
+void TwoDFieldOutputComponent::updateGeometry()
+{
+    updateCircularFieldGeometry(m_positionedChannelsGeometry, m_positionedChannelsArea, m_channelLevelMaxPoints, m_clockwiseOrderedChannelTypes);
+    updateCircularFieldGeometry(m_positionedHeightChannelsGeometry, m_positionedHeightChannelsArea, m_channelHeightLevelMaxPoints, m_clockwiseOrderedHeightChannelTypes);
+
+    m_directionlessChannels.clear();
+    for (auto const& channelType : m_directionLessChannelTypes)
+        m_directionlessChannels.push_back(getChannelNumberForChannelTypeInCurrentConfiguration(channelType));
+}
+
+void TwoDFieldOutputComponent::updateCircularFieldGeometry(CircularFieldGeometry& geometry, const juce::Rectangle<float>& circleArea, const std::map<int, juce::Point<float>>& channelLevelMaxPoints, const juce::Array<juce::AudioChannelSet::ChannelType>& channelsToPaint)
+{
+    const float halfMeterWidth = 2.0f;
+
+    geometry.area = circleArea;
+    geometry.centre = circleArea.getCentre();
+    geometry.channels.clear();
+    if (circleArea.isEmpty())
+        return;
+
+    for (auto const& channelType : channelsToPaint)
+    {
+        if (0 >= channelLevelMaxPoints.count(channelType))
+            continue;
+
+        CircularChannelGeometry channelGeometry;
+        channelGeometry.channelType = channelType;
+        channelGeometry.channel = getChannelNumberForChannelTypeInCurrentConfiguration(channelType);
+        channelGeometry.maxPoint = channelLevelMaxPoints.at(channelType);
+        channelGeometry.centerToMax = geometry.centre - channelGeometry.maxPoint;
+
+        auto angle = getAngleForChannelTypeInCurrentConfiguration(channelType);
+        auto angleRad = juce::degreesToRadians(angle);
+        channelGeometry.meterWidthOffset = { cosf(angleRad) * halfMeterWidth, sinf(angleRad) * halfMeterWidth };
+
+        // labels in the lower half are flipped to stay readable
+        if (90.0f < angle)
+            angle += 180.0f;
+        else if (-90.0f > angle)
+            angle -= 180.0f;
+        else
+            channelGeometry.labelAbove = true;
+        channelGeometry.labelAngleRad = juce::degreesToRadians(angle);
+
+        geometry.channels.push_back(channelGeometry);
+    }
+}
+
 void TwoDFieldOutputComponent::processingDataChanged(AbstractProcessorData *data)
 {
     if(!data)
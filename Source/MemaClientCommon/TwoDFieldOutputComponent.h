@@ -37,15 +37,49 @@ public:
     void paint (Graphics&) override;
     void resized() override;
     
+    //==============================================================================
+    bool setChannelConfiguration(const juce::AudioChannelSet& channelLayout) override;
+
     //==============================================================================
     void processingDataChanged(AbstractProcessorData *data) override;
 
 private:
+    /** @brief Geometry of a single channel within a circular level indication. Only depends on channel layout and bounds. */
+    struct CircularChannelGeometry
+    {
+        juce::AudioChannelSet::ChannelType  channelType = juce::AudioChannelSet::unknown;
+        int                 channel = 0;        ///< One-based channel number in the current configuration.
+        juce::Point<float>  maxPoint;           ///< Position of full level on the circle.
+        juce::Point<float>  centerToMax;        ///< Vector from maxPoint to the circle centre, scaled by the level per frame.
+        juce::Point<float>  meterWidthOffset;   ///< Half meter width, perpendicular to centerToMax.
+        float               labelAngleRad = 0.0f;   ///< Rotation of the channel name label, flipped to stay readable.
+        bool                labelAbove = false;     ///< True if the label is placed above the max point.
+    };
+    /** @brief Cached geometry of one circular level indication (positioned or height channels). */
+    struct CircularFieldGeometry
+    {
+        juce::Rectangle<float>                  area;
+        juce::Point<float>                      centre;
+        std::vector<CircularChannelGeometry>    channels;
+    };
+
     //==============================================================================
-    void paintCircularLevelIndication(juce::Graphics& g, const juce::Rectangle<float>& circleArea, const std::map<int, juce::Point<float>>& channelLevelMaxPoints, const juce::Array<juce::AudioChannelSet::ChannelType>& channelsToPaint);
-    void paintLevelMeterIndication(juce::Graphics& g, const juce::Rectangle<float>& levelMeterArea, const juce::Array<juce::AudioChannelSet::ChannelType>& channelsToPaint);
+    void updateGeometry();
+    void updateCircularFieldGeometry(CircularFieldGeometry& geometry, const juce::Rectangle<float>& circleArea, const std::map<int, juce::Point<float>>& channelLevelMaxPoints, const juce::Array<juce::AudioChannelSet::ChannelType>& channelsToPaint);
+
+    //==============================================================================
+    void updateLevelPoints(const CircularFieldGeometry& geometry, ProcessorLevelData::LevelType levelType);
+    void paintCircularLevelIndication(juce::Graphics& g, const CircularFieldGeometry& geometry);
+    void paintLevelMeterIndication(juce::Graphics& g, const juce::Rectangle<float>& levelMeterArea);
 
     ProcessorLevelData  m_levelData;
+
+    //==============================================================================
+    CircularFieldGeometry               m_positionedChannelsGeometry;       ///< Geometry cache of m_positionedChannelsArea.
+    CircularFieldGeometry               m_positionedHeightChannelsGeometry; ///< Geometry cache of m_positionedHeightChannelsArea.
+    std::vector<int>                    m_directionlessChannels;            ///< One-based channel numbers of m_directionLessChannelTypes.
+    std::vector<juce::Point<float>>     m_levelPoints;                      ///< Per frame scratch, current level point per channel.
+    juce::Path                          m_levelPath;                        ///< Per frame scratch, reused for the level outline paths.
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TwoDFieldOutputComponent)
 };
@@ -26,58 +26,12 @@
 namespace Mema
 {
 
-//==============================================================================
-class CustomPaintingAudioVisualiserComponent : public juce::AudioVisualiserComponent
-{
-public:
-    //==============================================================================
-    CustomPaintingAudioVisualiserComponent(int initialNumChannels)
-        : juce::AudioVisualiserComponent(initialNumChannels) {};
-    virtual ~CustomPaintingAudioVisualiserComponent() = default;
-
-    void setColours(juce::Colour tc,  juce::Colour bc, juce::Colour wc)
-    {
-        m_trackColour = tc;
-        m_waveformColour = wc;
-        
-        juce::AudioVisualiserComponent::setColours(bc, wc);
-    };
-
-    //==============================================================================
-    void paintChannel(juce::Graphics& g, juce::Rectangle<float> area,
-        const Range<float>* levels, int numLevels, int nextSample) override
-    {
-        auto margin = area.getHeight() * 0.05f;
-        margin = jlimit(1.0f, 3.0f, margin);
-
-        area.reduce(margin, margin);
-
-        g.setColour(m_trackColour);
-        g.fillRect(area);
-
-        juce::Path p;
-        getChannelAsPath(p, levels, numLevels, nextSample);
-
-        g.setColour(m_waveformColour);
-        g.fillPath(p, juce::AffineTransform::fromTargetPoints(0.0f, -1.0f, area.getX(), area.getY(),
-            0.0f, 1.0f, area.getX(), area.getBottom(),
-            (float)numLevels, -1.0f, area.getRight(), area.getY()));
-    }
-
-private:
-    juce::Colour m_trackColour = juce::Colours::white;
-    juce::Colour m_waveformColour = juce::Colours::grey;
-};
-
-
 //==============================================================================
 WaveformAudioComponent::WaveformAudioComponent()
     : AbstractAudioVisualizer()
 {
-    m_waveformsComponent = std::make_unique<CustomPaintingAudioVisualiserComponent>(m_numVisibleChannels);
-    m_waveformsComponent->setBufferSize(2048);
-    m_waveformsComponent->setRepaintRate(20);
-    addAndMakeVisible(m_waveformsComponent.get());
+    m_peakPyramid.setChannelCount(m_numVisibleChannels);
+    setRefreshFrequency(60);
 
     m_chNumSelButton = std::make_unique<juce::DrawableButton>("SelectChannelcount", juce::DrawableButton::ButtonStyle::ImageFitted);
     m_chNumSelButton->setTooltip("Select number of visible channels.");
@@ -123,18 +77,107 @@ void WaveformAudioComponent::paint(Graphics& g)
         for (int i = 1; i <= m_numVisibleChannels; ++i)
             g.drawText(juce::String(i), legendArea.removeFromTop(singleWaveformHeight), juce::Justification::centred, true);
     }
+
+    // bring the cached waveform image up to date and blit it
+    updateWaveformImage(g.getInternalContext().getPhysicalPixelScaleFactor());
+    if (m_waveformImage.isValid())
+        g.drawImage(m_waveformImage, getWaveformArea().toFloat());
 }
 
-void WaveformAudioComponent::resized()
+juce::Rectangle<int> WaveformAudioComponent::getWaveformArea() const
 {
-    auto bounds = getLocalBounds();
-    auto visuArea = bounds;
-    auto legendArea = visuArea.removeFromRight(m_legendWidth);
-    ignoreUnused(legendArea);
+    auto visuArea = getLocalBounds();
+    visuArea.removeFromRight(m_legendWidth);
+    return visuArea;
+}
+
+void WaveformAudioComponent::updateWaveformImage(float scale)
+{
+    auto area = getWaveformArea();
+    auto width = juce::roundToInt(area.getWidth() * scale);
+    auto height = juce::roundToInt(area.getHeight() * scale);
+    if (width <= 0 || height <= 0 || m_numVisibleChannels <= 0)
+    {
+        m_waveformImage = juce::Image();
+        return;
+    }
+
+    auto level = WaveformPeakPyramid::getLevelForSamplesPerColumn(double(s_historySamples) / double(width));
+    auto bucketCount = m_peakPyramid.getBucketCount(level);
 
-    if (m_waveformsComponent)
-        m_waveformsComponent->setBounds(visuArea);
+    // full render if geometry, resolution or history changed
+    if (m_waveformImageInvalid || !m_waveformImage.isValid() || m_waveformImage.getWidth() != width || m_waveformImage.getHeight() != height
+        || m_waveformImageScale != scale || m_waveformImageLevel != level || bucketCount < m_renderedBucketCount)
+    {
+        if (!m_waveformImage.isValid() || m_waveformImage.getWidth() != width || m_waveformImage.getHeight() != height)
+            m_waveformImage = juce::Image(juce::Image::ARGB, width, height, false);
+
+        m_waveformImageScale = scale;
+        m_waveformImageLevel = level;
+        m_waveformImageInvalid = false;
+        renderWaveformColumns(0, width, std::int64_t(bucketCount) - width);
+        m_renderedBucketCount = bucketCount;
+        return;
+    }
+
+    // otherwise scroll by the number of columns completed since last time and only render those
+    auto newColumns = int(std::min(bucketCount - m_renderedBucketCount, std::uint64_t(width)));
+    if (newColumns <= 0)
+        return;
+
+    if (newColumns < width)
+        m_waveformImage.moveImageSection(0, 0, newColumns, 0, width - newColumns, height);
+    renderWaveformColumns(width - newColumns, newColumns, std::int64_t(bucketCount) - newColumns);
+    m_renderedBucketCount = bucketCount;
+}
+
+void WaveformAudioComponent::renderWaveformColumns(int firstColumn, int numColumns, std::int64_t firstBucketIdx)
+{
+    if (!m_waveformImage.isValid() || numColumns <= 0 || m_numVisibleChannels <= 0)
+        return;
+
+    auto height = m_waveformImage.getHeight();
+    juce::Image::BitmapData bitmap(m_waveformImage, firstColumn, 0, numColumns, height, juce::Image::BitmapData::writeOnly);
+    jassert(juce::Image::ARGB == bitmap.pixelFormat);
+
+    auto backgroundPixel = m_backgroundColour.getPixelARGB();
+    auto trackPixel = m_trackColour.getPixelARGB();
+    auto waveformPixel = m_waveformColour.getPixelARGB();
+
+    for (auto channel = 0; channel < m_numVisibleChannels; channel++)
+    {
+        auto stripTop = channel * height / m_numVisibleChannels;
+        auto stripBottom = (channel + 1) * height / m_numVisibleChannels;
+        auto margin = juce::roundToInt(juce::jlimit(1.0f, 3.0f, (stripBottom - stripTop) / m_waveformImageScale * 0.05f) * m_waveformImageScale);
+        auto trackTop = stripTop + margin;
+        auto trackBottom = std::max(trackTop + 1, stripBottom - margin);
+        auto halfTrackHeight = 0.5f * (trackBottom - trackTop);
+        auto trackCentre = trackTop + halfTrackHeight;
+
+        for (auto column = 0; column < numColumns; column++)
+        {
+            auto bucketIdx = firstBucketIdx + column;
+            auto bucket = bucketIdx < 0 ? WaveformPeakPyramid::MinMax() : m_peakPyramid.getBucket(channel, m_waveformImageLevel, std::uint64_t(bucketIdx));
+            auto waveformTop = juce::jlimit(trackTop, trackBottom - 1, juce::roundToInt(trackCentre - bucket.max * halfTrackHeight));
+            auto waveformBottom = juce::jlimit(waveformTop, trackBottom - 1, juce::roundToInt(trackCentre - bucket.min * halfTrackHeight));
+
+            for (auto y = stripTop; y < stripBottom; y++)
+            {
+                auto pixel = reinterpret_cast<juce::PixelARGB*>(bitmap.getPixelPointer(column, y));
+                if (y < trackTop || y >= trackBottom)
+                    *pixel = backgroundPixel;
+                else if (y >= waveformTop && y <= waveformBottom)
+                    *pixel = waveformPixel;
+                else
+                    *pixel = trackPixel;
+            }
+        }
+    }
+}
 
+void WaveformAudioComponent::resized()
+{
+    auto bounds = getLocalBounds();
     if (m_chNumSelButton)
         m_chNumSelButton->setBounds(bounds.removeFromBottom(22).removeFromLeft(22));
 
@@ -143,11 +186,10 @@ void WaveformAudioComponent::resized()
 
 void WaveformAudioComponent::lookAndFeelChanged()
 {
-    if (m_waveformsComponent)
-        m_waveformsComponent->setColours(
-            getLookAndFeel().findColour(juce::Slider::backgroundColourId),
-            getLookAndFeel().findColour(juce::ResizableWindow::backgroundColourId),
-            getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::MeteringRmsColourId));
+    m_trackColour = getLookAndFeel().findColour(juce::Slider::backgroundColourId);
+    m_backgroundColour = getLookAndFeel().findColour(juce::ResizableWindow::backgroundColourId);
+    m_waveformColour = getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::MeteringRmsColourId);
+    m_waveformImageInvalid = true;
 
     auto chNumSelButtonDrawable = juce::Drawable::createFromSVG(*juce::XmlDocument::parse(BinaryData::waves24px_svg).get());
     chNumSelButtonDrawable->replaceColour(juce::Colours::black, getLookAndFeel().findColour(juce::TextButton::ColourIds::textColourOnId));
@@ -157,8 +199,7 @@ void WaveformAudioComponent::lookAndFeelChanged()
 void WaveformAudioComponent::processingDataChanged(AbstractProcessorData* data)
 {
     if (!data)
-        if (!data)
-            return;
+        return;
 
     switch (data->GetDataType())
     {
@@ -174,10 +215,7 @@ void WaveformAudioComponent::processingDataChanged(AbstractProcessorData* data)
                 if (init)
                     setNumVisibleChannels(m_numAvailableChannels);
             }
-            if (m_waveformsComponent)
-            {
-                m_waveformsComponent->pushBuffer(*sd);
-            }
+            m_peakPyramid.pushSamples(*sd);
         }
         else
             break;
@@ -195,8 +233,15 @@ void WaveformAudioComponent::processingDataChanged(AbstractProcessorData* data)
 void WaveformAudioComponent::setNumVisibleChannels(int numChannels)
 {
     m_numVisibleChannels = numChannels;
-    if (m_waveformsComponent)
-        m_waveformsComponent->setNumChannels(numChannels);
+    m_peakPyramid.setChannelCount(numChannels);
+    m_waveformImageInvalid = true;
+    repaint();
+}
+
+void WaveformAudioComponent::processChanges()
+{
+    // the legend is static, only the waveform area needs to be refreshed
+    repaint(getWaveformArea());
 }
 
 int WaveformAudioComponent::getNumVisibleChannels()
@@ -21,13 +21,20 @@
 #include <JuceHeader.h>
 
 #include "../MemaProcessorEditor/AbstractAudioVisualizer.h"
+#include "WaveformPeakPyramid.h"
 
 namespace Mema
 {
 
-class CustomPaintingAudioVisualiserComponent;
-
-/** @class WaveformAudioComponent @brief Scrolling waveform visualisation component for Mema.Mo. */
+/**
+ * @class WaveformAudioComponent
+ * @brief Scrolling waveform visualisation component for Mema.Mo.
+ *
+ * @details Incoming audio is folded into a WaveformPeakPyramid, the waveforms are rendered from the
+ * pyramid level matching the current samples-per-pixel into a cached image.  On refresh the image is
+ * scrolled by the number of newly completed columns and only those are rendered, so the cost per
+ * frame depends on elapsed time and height, not on the displayed history length.
+ */
 class WaveformAudioComponent    :   public AbstractAudioVisualizer
 {
 public:
@@ -46,11 +53,30 @@ public:
     
     //==============================================================================
     void processingDataChanged(AbstractProcessorData *data) override;
+    void processChanges() override;
 
 private:
     //==============================================================================
-    std::unique_ptr<CustomPaintingAudioVisualiserComponent> m_waveformsComponent;
-    std::unique_ptr<juce::DrawableButton>                   m_chNumSelButton;
+    juce::Rectangle<int> getWaveformArea() const;
+    void updateWaveformImage(float scale);
+    void renderWaveformColumns(int firstColumn, int numColumns, std::int64_t firstBucketIdx);
+
+    //==============================================================================
+    std::unique_ptr<juce::DrawableButton>   m_chNumSelButton;
+
+    //==============================================================================
+    WaveformPeakPyramid m_peakPyramid{ s_historySamples };  ///< Min/max history of all visible channels.
+    juce::Image         m_waveformImage;                    ///< Scrolling image of all channel waveforms, in physical pixels.
+    float               m_waveformImageScale = 0.0f;        ///< Physical pixel scale m_waveformImage was rendered for.
+    int                 m_waveformImageLevel = 0;           ///< Pyramid level one image column is taken from.
+    std::uint64_t       m_renderedBucketCount = 0;          ///< Pyramid bucket count of m_waveformImageLevel the image is rendered up to.
+    bool                m_waveformImageInvalid = true;      ///< Forces a full render on next paint.
+
+    juce::Colour        m_backgroundColour;
+    juce::Colour        m_trackColour;
+    juce::Colour        m_waveformColour;
+
+    static constexpr int s_historySamples = 524288;         ///< Number of samples covered by the full component width.
 
     //==============================================================================
     int m_numAvailableChannels = 0;
@@ -0,0 +1,194 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace Mema
+{
+
+/**
+ * @class WaveformPeakPyramid
+ * @brief Multi-resolution min/max history of a multichannel audio stream.
+ *
+ * @details Level 0 holds the min/max of every `s_baseBucketSize` incoming samples, each further
+ * level merges two buckets of the level below, so level `n` covers `s_baseBucketSize << n` samples
+ * per bucket.  The pyramid is built incrementally while samples are pushed, every level is a
+ * fixed size ring per channel, sized to just hold the configured history span.  A display then
+ * picks the level whose bucket size best matches its samples-per-pixel and reads one bucket per
+ * pixel column, independent of how many samples the history covers.
+ */
+class WaveformPeakPyramid
+{
+public:
+    /** @brief Min/max of the samples covered by one bucket. */
+    struct MinMax
+    {
+        float min = 0.0f;
+        float max = 0.0f;
+    };
+
+    static constexpr int s_baseBucketSize = 128;   ///< Samples per bucket on level 0.
+    static constexpr int s_levelCount = 8;         ///< Number of levels, the top level holds 16384 samples per bucket.
+
+public:
+    /**
+     * @param historySamples    Number of samples the history shall cover.
+     * @param maxColumns        Upper limit of buckets kept per level and channel, i.e. the widest supported display.
+     */
+    explicit WaveformPeakPyramid(int historySamples = 524288, int maxColumns = 4096)
+    {
+        for (auto level = 0; level < s_levelCount; level++)
+        {
+            // a level is only picked for displays that need less than twice the history in its bucket size
+            m_levels[level].capacity = juce::jlimit(2, maxColumns, 2 * historySamples / getBucketSize(level));
+        }
+    };
+    ~WaveformPeakPyramid() = default;
+
+    //==============================================================================
+    /** @brief Resizes the history to @p channelCount channels, discarding all collected data. */
+    void setChannelCount(int channelCount)
+    {
+        m_channelCount = std::max(0, channelCount);
+        for (auto& level : m_levels)
+            level.buckets.assign(size_t(m_channelCount) * size_t(level.capacity), {});
+        m_pending.assign(size_t(m_channelCount), {});
+        clear();
+    };
+    int getChannelCount() const { return m_channelCount; };
+
+    /** @brief Discards all collected data, keeping the channel count. */
+    void clear()
+    {
+        for (auto& level : m_levels)
+            level.count = 0;
+        m_pendingSampleCount = 0;
+    };
+
+    //==============================================================================
+    /** @brief Returns the number of samples covered by a single bucket on @p level. */
+    static int getBucketSize(int level) { return s_baseBucketSize << level; };
+
+    /** @brief Returns the lowest level whose buckets cover at least @p samplesPerColumn samples. */
+    static int getLevelForSamplesPerColumn(double samplesPerColumn)
+    {
+        auto level = 0;
+        while (level < s_levelCount - 1 && getBucketSize(level) < samplesPerColumn)
+            level++;
+        return level;
+    };
+
+    /** @brief Returns the number of buckets kept in the ring of @p level. */
+    int getCapacity(int level) const { return m_levels[level].capacity; };
+
+    /** @brief Returns the total number of buckets ever completed on @p level. Identical for all channels. */
+    std::uint64_t getBucketCount(int level) const { return m_levels[level].count; };
+
+    /**
+     * @brief Returns bucket number @p bucketIdx (counted since the last clear) of @p channel on @p level.
+     * @details Only the last `getCapacity(level)` buckets are available, older ones read as silence.
+     */
+    MinMax getBucket(int channel, int level, std::uint64_t bucketIdx) const
+    {
+        auto const& l = m_levels[level];
+        if (channel < 0 || channel >= m_channelCount || bucketIdx >= l.count || l.count - bucketIdx > std::uint64_t(l.capacity))
+            return {};
+        return l.buckets[size_t(channel) * size_t(l.capacity) + size_t(bucketIdx % std::uint64_t(l.capacity))];
+    };
+
+    //==============================================================================
+    /** @brief Appends the samples of @p buffer. Channels beyond getChannelCount() are ignored, missing ones are treated as silence. */
+    void pushSamples(const juce::AudioBuffer<float>& buffer)
+    {
+        if (m_channelCount <= 0)
+            return;
+
+        auto numSamples = buffer.getNumSamples();
+        auto numChannels = std::min(buffer.getNumChannels(), m_channelCount);
+        auto readPos = 0;
+        while (readPos < numSamples)
+        {
+            auto segmentLength = std::min(numSamples - readPos, s_baseBucketSize - m_pendingSampleCount);
+            for (auto channel = 0; channel < m_channelCount; channel++)
+            {
+                auto range = channel < numChannels
+                    ? juce::FloatVectorOperations::findMinAndMax(buffer.getReadPointer(channel, readPos), segmentLength)
+                    : juce::Range<float>();
+                auto& pending = m_pending[size_t(channel)];
+                if (0 == m_pendingSampleCount)
+                    pending = { range.getStart(), range.getEnd() };
+                else
+                    pending = { std::min(pending.min, range.getStart()), std::max(pending.max, range.getEnd()) };
+            }
+
+            m_pendingSampleCount += segmentLength;
+            readPos += segmentLength;
+
+            if (s_baseBucketSize == m_pendingSampleCount)
+            {
+                auto& base = m_levels[0];
+                for (auto channel = 0; channel < m_channelCount; channel++)
+                    base.buckets[size_t(channel) * size_t(base.capacity) + size_t(base.count % std::uint64_t(base.capacity))] = m_pending[size_t(channel)];
+                commitBucket(0);
+                m_pendingSampleCount = 0;
+            }
+        }
+    };
+
+private:
+    //==============================================================================
+    /** @brief Counts the freshly written bucket on @p level and merges every completed pair into the level above. */
+    void commitBucket(int level)
+    {
+        auto& l = m_levels[level];
+        l.count++;
+        if (level + 1 >= s_levelCount || 0 != (l.count % 2))
+            return;
+
+        auto& upper = m_levels[level + 1];
+        auto firstIdx = size_t((l.count - 2) % std::uint64_t(l.capacity));
+        auto secondIdx = size_t((l.count - 1) % std::uint64_t(l.capacity));
+        auto upperIdx = size_t(upper.count % std::uint64_t(upper.capacity));
+        for (auto channel = 0; channel < m_channelCount; channel++)
+        {
+            auto const& first = l.buckets[size_t(channel) * size_t(l.capacity) + firstIdx];
+            auto const& second = l.buckets[size_t(channel) * size_t(l.capacity) + secondIdx];
+            upper.buckets[size_t(channel) * size_t(upper.capacity) + upperIdx] = { std::min(first.min, second.min), std::max(first.max, second.max) };
+        }
+        commitBucket(level + 1);
+    };
+
+    //==============================================================================
+    struct Level
+    {
+        std::vector<MinMax> buckets;    ///< Channel-major rings, `capacity` buckets per channel.
+        int                 capacity = 1;
+        std::uint64_t       count = 0;  ///< Buckets completed since the last clear.
+    };
+
+    std::array<Level, s_levelCount> m_levels;
+    std::vector<MinMax>             m_pending;              ///< Per-channel min/max of the incomplete level 0 bucket.
+    int                             m_pendingSampleCount = 0;
+    int                             m_channelCount = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WaveformPeakPyramid)
+};
+
+} // namespace Mema
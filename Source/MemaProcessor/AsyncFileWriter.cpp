@@ -0,0 +1,155 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "AsyncFileWriter.h"
+
+namespace Mema
+{
+
+//==============================================================================
+AsyncFileWriter::AsyncFileWriter()
+    : juce::Thread("MemaAsyncFileWriter")
+{
+    startThread(juce::Thread::Priority::background);
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+    stopThread(10000);
+
+    // anything queued after the thread's last round is written here
+    writePendingJobs();
+}
+
+//==============================================================================
+void AsyncFileWriter::write(const juce::File& file, Serializer serializer, bool skipIfTargetIsNewer)
+{
+    if (file == juce::File() || !serializer)
+        return;
+
+    {
+        const juce::ScopedLock sl(m_jobsLock);
+        m_pendingJobs[file.getFullPathName()] = { file, std::move(serializer), {}, juce::Time::getCurrentTime(), skipIfTargetIsNewer, m_nextSequence++ };
+    }
+    notify();
+}
+
+void AsyncFileWriter::write(const juce::File& file, std::unique_ptr<juce::XmlElement> xml, bool skipIfTargetIsNewer)
+{
+    if (!xml)
+        return;
+
+    // std::function requires a copyable callable, the shared_ptr keeps the tree alive until it is written
+    auto sharedXml = std::shared_ptr<juce::XmlElement>(std::move(xml));
+    write(file, [sharedXml](juce::OutputStream& stream) {
+        sharedXml->writeTo(stream);
+        return !stream.getStatus().failed();
+    }, skipIfTargetIsNewer);
+}
+
+void AsyncFileWriter::write(const juce::File& file, juce::MemoryBlock data, bool skipIfTargetIsNewer)
+{
+    auto sharedData = std::make_shared<juce::MemoryBlock>(std::move(data));
+    write(file, [sharedData](juce::OutputStream& stream) {
+        return stream.write(sharedData->getData(), sharedData->getSize());
+    }, skipIfTargetIsNewer);
+}
+
+void AsyncFileWriter::append(const juce::File& file, const juce::MemoryBlock& data)
+{
+    if (file == juce::File() || data.isEmpty())
+        return;
+
+    {
+        const juce::ScopedLock sl(m_jobsLock);
+        auto& job = m_pendingJobs[file.getFullPathName()];
+        if (job.file == juce::File())
+        {
+            job.file = file;
+            job.queuedTime = juce::Time::getCurrentTime();
+            job.sequence = m_nextSequence++;
+        }
+        job.appendData.append(data.getData(), data.getSize());
+    }
+    notify();
+}
+
+void AsyncFileWriter::flush()
+{
+    writePendingJobs();
+}
+
+//==============================================================================
+void AsyncFileWriter::run()
+{
+    while (!threadShouldExit())
+    {
+        wait(-1);
+        writePendingJobs();
+    }
+}
+
+void AsyncFileWriter::writePendingJobs()
+{
+    const juce::ScopedLock wl(m_writeLock);
+
+    while (true)
+    {
+        auto job = Job();
+        {
+            const juce::ScopedLock sl(m_jobsLock);
+            if (m_pendingJobs.empty())
+                return;
+            auto jobIter = std::min_element(m_pendingJobs.begin(), m_pendingJobs.end(), [](const auto& a, const auto& b) { return a.second.sequence < b.second.sequence; });
+            job = std::move(jobIter->second);
+            m_pendingJobs.erase(jobIter);
+        }
+
+        if (!job.serializer)
+        {
+            // plain append, the file is extended in place
+            juce::FileOutputStream stream(job.file);
+            if (!stream.openedOk() || !stream.write(job.appendData.getData(), job.appendData.getSize()))
+                DBG(juce::String(__FUNCTION__) << " failed to append to " << job.file.getFullPathName());
+            stream.flush();
+            continue;
+        }
+
+        // someone else wrote the file after the snapshot was taken, it already holds newer content
+        if (job.skipIfTargetIsNewer && job.file.existsAsFile() && job.file.getLastModificationTime() > job.queuedTime)
+            continue;
+
+        juce::TemporaryFile tempFile(job.file);
+        auto written = false;
+        {
+            auto stream = tempFile.getFile().createOutputStream();
+            if (stream)
+            {
+                written = job.serializer(*stream);
+                if (written && !job.appendData.isEmpty())
+                    written = stream->write(job.appendData.getData(), job.appendData.getSize());
+                stream->flush();
+                written = written && !stream->getStatus().failed();
+            }
+        }
+        if (!written || !tempFile.overwriteTargetFileWithTemporary())
+            DBG(juce::String(__FUNCTION__) << " failed to write " << job.file.getFullPathName());
+    }
+}
+
+} // namespace Mema
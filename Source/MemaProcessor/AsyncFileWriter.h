@@ -0,0 +1,93 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace Mema
+{
+
+/**
+ * @class AsyncFileWriter
+ * @brief Background I/O thread that serialises and writes files off the message thread.
+ *
+ * @details The caller takes a cheap snapshot of the data on its own thread (an XML tree copy, a
+ * memory block) and hands it over together with the target file.  Serialisation and disk I/O happen
+ * on the writer thread, every file is written to a temporary sibling first and then renamed over the
+ * target, so a crash never leaves a half written file behind.  Writes to the same file are coalesced,
+ * when a burst of changes arrives while the thread is busy only the latest queued content is written.
+ * Appends to a file are collected until the thread picks them up and then written in one go, files
+ * are processed in the order their content was last replaced.
+ */
+class AsyncFileWriter : private juce::Thread
+{
+public:
+    /** @brief Streams the snapshot to the given stream on the writer thread, returns false on failure. */
+    using Serializer = std::function<bool(juce::OutputStream&)>;
+
+public:
+    AsyncFileWriter();
+    /** @brief Writes everything still pending before the thread is stopped. */
+    ~AsyncFileWriter() override;
+
+    //==============================================================================
+    /**
+     * @brief Queues @p serializer to be written to @p file, replacing content that is still pending for the same file.
+     * @param skipIfTargetIsNewer   If true, the write is dropped when @p file was modified by someone else
+     *                              after it was queued, since that file then already holds more recent content.
+     */
+    void write(const juce::File& file, Serializer serializer, bool skipIfTargetIsNewer = false);
+    /** @brief Convenience overload that writes a copy of @p xml taken by the caller. */
+    void write(const juce::File& file, std::unique_ptr<juce::XmlElement> xml, bool skipIfTargetIsNewer = false);
+    /** @brief Convenience overload that writes @p data as is. */
+    void write(const juce::File& file, juce::MemoryBlock data, bool skipIfTargetIsNewer = false);
+    /** @brief Queues @p data to be appended to @p file, after any content still pending for it. */
+    void append(const juce::File& file, const juce::MemoryBlock& data);
+
+    /** @brief Blocks until all writes queued so far are on disk. Meant for shutdown, not for regular use. */
+    void flush();
+
+private:
+    //==============================================================================
+    void run() override;
+
+    //==============================================================================
+    /** @brief Writes all currently queued jobs, returns once the queue was found empty. */
+    void writePendingJobs();
+
+    //==============================================================================
+    struct Job
+    {
+        juce::File          file;
+        Serializer          serializer;     ///< Replaces the file content if set.
+        juce::MemoryBlock   appendData;     ///< Appended after the serializer output, or to the existing file.
+        juce::Time          queuedTime;
+        bool                skipIfTargetIsNewer = false;
+        std::uint64_t       sequence = 0;
+    };
+
+    juce::CriticalSection           m_jobsLock;
+    std::map<juce::String, Job>     m_pendingJobs;  ///< Latest job per full target path.
+    std::uint64_t                   m_nextSequence = 0;
+    juce::CriticalSection           m_writeLock;    ///< Held while jobs are written, so flush can wait for a running write.
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AsyncFileWriter)
+};
+
+} // namespace Mema
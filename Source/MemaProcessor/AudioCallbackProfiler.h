@@ -0,0 +1,274 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace Mema
+{
+
+/**
+ * @class AudioCallbackProfiler
+ * @brief Lock-free timing instrumentation of the audio device callback.
+ *
+ * @details The audio thread brackets every device callback with beginCallback / endCallback and
+ * marks the end of each processing stage in between, the time since the previous mark is added
+ * to that stage.  Besides the per-stage totals, the callback durations are counted in a histogram
+ * relative to the buffer deadline (the duration of the block at the current sample rate), and
+ * callbacks that started too late after the previous one are counted as xruns.
+ *
+ * All counters are atomics written by the audio thread only, so recording neither locks nor
+ * allocates.  Readers take a Snapshot of the totals since the last reset and derive the values
+ * of an interval from two snapshots, see Snapshot::getDifference.
+ */
+class AudioCallbackProfiler
+{
+public:
+    /** @brief Processing stages of a callback, a stage that is passed several times sums up. */
+    enum Stage
+    {
+        LockWait = 0,   ///< Waiting for the callback lock held by the message thread.
+        InputCopy,      ///< Copying the device input into the processing buffer.
+        Mutes,          ///< Input and output mutes.
+        PrePlugin,      ///< Plug-in processing before the matrix, incl. applying queued parameter changes.
+        Matrix,         ///< Crosspoint matrix.
+        PostPlugin,     ///< Plug-in processing after the matrix.
+        Metering,       ///< Handing the input and output buffers to the analyzers and network clients.
+        OutputCopy,     ///< Copying the processing buffer to the device output.
+        StageCount
+    };
+
+    static constexpr int s_histogramBinCount = 8;
+    /** @brief Upper limits of the histogram bins in percent of the deadline, the last bin is open ended. */
+    static constexpr std::array<int, s_histogramBinCount - 1> s_histogramBinLimitsPercent = { 10, 25, 50, 75, 90, 100, 150 };
+
+    /** @brief Totals since the last reset. Durations in microseconds. */
+    struct Snapshot
+    {
+        std::uint64_t                                   callbackCount = 0;
+        std::uint64_t                                   deadlineMissCount = 0;  ///< Callbacks that took longer than their deadline.
+        std::uint64_t                                   xrunCount = 0;          ///< Callbacks that started more than 1.5 deadlines after the previous one.
+        double                                          deadlineUs = 0.0;       ///< Deadline of the most recent callback.
+        double                                          callbackUs = 0.0;       ///< Sum of all callback durations.
+        double                                          maxCallbackUs = 0.0;    ///< Longest callback since the last reset.
+        std::array<double, StageCount>                  stageUs{};              ///< Sum of the durations per stage.
+        std::array<std::uint64_t, s_histogramBinCount>  histogram{};            ///< Callback count per deadline ratio bin.
+
+        /** @brief Returns the mean callback duration in microseconds. */
+        double getMeanCallbackUs() const { return callbackCount > 0 ? callbackUs / double(callbackCount) : 0.0; };
+        /** @brief Returns the mean callback duration relative to the deadline, 1.0 being a fully used deadline. */
+        double getMeanLoad() const { return deadlineUs > 0.0 ? getMeanCallbackUs() / deadlineUs : 0.0; };
+        /** @brief Returns the mean duration of @p stage per callback in microseconds. */
+        double getMeanStageUs(Stage stage) const { return callbackCount > 0 ? stageUs[stage] / double(callbackCount) : 0.0; };
+
+        /**
+         * @brief Returns what was recorded between @p earlier and this snapshot.
+         * @details The maximum cannot be differentiated and stays the one since the last reset.
+         *          If the profiler was reset in between, this snapshot is returned unchanged.
+         */
+        Snapshot getDifference(const Snapshot& earlier) const
+        {
+            if (earlier.callbackCount > callbackCount)
+                return *this;
+
+            auto difference = *this;
+            difference.callbackCount -= earlier.callbackCount;
+            difference.deadlineMissCount -= std::min(earlier.deadlineMissCount, deadlineMissCount);
+            difference.xrunCount -= std::min(earlier.xrunCount, xrunCount);
+            difference.callbackUs -= earlier.callbackUs;
+            for (auto i = 0; i < StageCount; i++)
+                difference.stageUs[i] -= earlier.stageUs[i];
+            for (auto i = 0; i < s_histogramBinCount; i++)
+                difference.histogram[i] -= std::min(earlier.histogram[i], histogram[i]);
+            return difference;
+        };
+    };
+
+public:
+    AudioCallbackProfiler() = default;
+    ~AudioCallbackProfiler() = default;
+
+    //==============================================================================
+    /** @brief Returns a short human readable name of @p stage. */
+    static juce::String getStageName(Stage stage)
+    {
+        switch (stage)
+        {
+        case LockWait:      return "Lock wait";
+        case InputCopy:     return "Input copy";
+        case Mutes:         return "Mutes";
+        case PrePlugin:     return "Pre-plugin";
+        case Matrix:        return "Matrix";
+        case PostPlugin:    return "Post-plugin";
+        case Metering:      return "Metering";
+        case OutputCopy:    return "Output copy";
+        case StageCount:
+        default:            return {};
+        }
+    };
+
+    /** @brief Returns a label like "50-75%" for histogram bin @p binIdx. */
+    static juce::String getHistogramBinName(int binIdx)
+    {
+        if (binIdx <= 0)
+            return "<" + juce::String(s_histogramBinLimitsPercent.front()) + "%";
+        if (binIdx >= s_histogramBinCount - 1)
+            return ">" + juce::String(s_histogramBinLimitsPercent.back()) + "%";
+        return juce::String(s_histogramBinLimitsPercent[size_t(binIdx - 1)]) + "-" + juce::String(s_histogramBinLimitsPercent[size_t(binIdx)]) + "%";
+    };
+
+    //==============================================================================
+    /**
+     * @brief Starts timing a callback. Audio thread only.
+     * @param startTicks    High resolution ticks taken at the very start of the callback.
+     */
+    void beginCallback(juce::int64 startTicks, int numSamples, double sampleRate) noexcept
+    {
+        if (m_resetRequested.exchange(false, std::memory_order_acquire))
+            clear();
+
+        m_deadlineTicks = (sampleRate > 0.0) ? juce::int64(double(numSamples) / sampleRate * double(juce::Time::getHighResolutionTicksPerSecond())) : 0;
+
+        if (0 != m_callbackStartTicks && m_deadlineTicks > 0 && (startTicks - m_callbackStartTicks) * 2 > m_deadlineTicks * 3)
+            increment(m_xrunCount);
+
+        m_callbackStartTicks = startTicks;
+        m_stageStartTicks = startTicks;
+        m_inCallback = true;
+    };
+
+    /** @brief Adds the time since the previous mark to @p stage. Audio thread only, ignored outside of a callback. */
+    void endStage(Stage stage) noexcept
+    {
+        if (!m_inCallback)
+            return;
+
+        auto nowTicks = juce::Time::getHighResolutionTicks();
+        add(m_stageTicks[stage], nowTicks - m_stageStartTicks);
+        m_stageStartTicks = nowTicks;
+    };
+
+    /** @brief Finishes timing the callback started with beginCallback. Audio thread only. */
+    void endCallback() noexcept
+    {
+        if (!m_inCallback)
+            return;
+        m_inCallback = false;
+
+        auto durationTicks = juce::Time::getHighResolutionTicks() - m_callbackStartTicks;
+        increment(m_callbackCount);
+        add(m_callbackTicks, durationTicks);
+        if (durationTicks > m_maxCallbackTicks.load(std::memory_order_relaxed))
+            m_maxCallbackTicks.store(durationTicks, std::memory_order_relaxed);
+        m_lastDeadlineTicks.store(m_deadlineTicks, std::memory_order_relaxed);
+
+        auto binIdx = s_histogramBinCount - 1;
+        if (m_deadlineTicks > 0)
+        {
+            for (auto i = 0; i < s_histogramBinCount - 1; i++)
+            {
+                if (durationTicks * 100 < m_deadlineTicks * s_histogramBinLimitsPercent[size_t(i)])
+                {
+                    binIdx = i;
+                    break;
+                }
+            }
+            if (durationTicks > m_deadlineTicks)
+                increment(m_deadlineMissCount);
+        }
+        increment(m_histogram[size_t(binIdx)]);
+    };
+
+    /** @brief Marks the device as stopped, the next callback after a restart is not taken for an xrun. Audio thread or with the audio thread stopped. */
+    void deviceStopped() noexcept
+    {
+        m_callbackStartTicks = 0;
+        m_inCallback = false;
+    };
+
+    //==============================================================================
+    /** @brief Requests all totals to be cleared, effective with the next callback. Any thread. */
+    void reset() noexcept
+    {
+        m_resetRequested.store(true, std::memory_order_release);
+    };
+
+    /** @brief Returns the totals since the last reset. Any thread, the values of a callback in progress may be partially included. */
+    Snapshot getSnapshot() const
+    {
+        auto ticksToUs = [](juce::int64 ticks) { return double(ticks) * 1.0e6 / double(juce::Time::getHighResolutionTicksPerSecond()); };
+
+        auto snapshot = Snapshot();
+        snapshot.callbackCount = m_callbackCount.load(std::memory_order_relaxed);
+        snapshot.deadlineMissCount = m_deadlineMissCount.load(std::memory_order_relaxed);
+        snapshot.xrunCount = m_xrunCount.load(std::memory_order_relaxed);
+        snapshot.deadlineUs = ticksToUs(m_lastDeadlineTicks.load(std::memory_order_relaxed));
+        snapshot.callbackUs = ticksToUs(m_callbackTicks.load(std::memory_order_relaxed));
+        snapshot.maxCallbackUs = ticksToUs(m_maxCallbackTicks.load(std::memory_order_relaxed));
+        for (auto i = 0; i < StageCount; i++)
+            snapshot.stageUs[size_t(i)] = ticksToUs(m_stageTicks[size_t(i)].load(std::memory_order_relaxed));
+        for (auto i = 0; i < s_histogramBinCount; i++)
+            snapshot.histogram[size_t(i)] = m_histogram[size_t(i)].load(std::memory_order_relaxed);
+        return snapshot;
+    };
+
+private:
+    //==============================================================================
+    // single writer, a relaxed load and store is enough and cheaper than a locked read-modify-write
+    template <typename T>
+    static void add(std::atomic<T>& counter, T value) noexcept { counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed); };
+    template <typename T>
+    static void increment(std::atomic<T>& counter) noexcept { add(counter, T(1)); };
+
+    void clear() noexcept
+    {
+        m_callbackCount.store(0, std::memory_order_relaxed);
+        m_deadlineMissCount.store(0, std::memory_order_relaxed);
+        m_xrunCount.store(0, std::memory_order_relaxed);
+        m_callbackTicks.store(0, std::memory_order_relaxed);
+        m_maxCallbackTicks.store(0, std::memory_order_relaxed);
+        for (auto& stageTicks : m_stageTicks)
+            stageTicks.store(0, std::memory_order_relaxed);
+        for (auto& binCount : m_histogram)
+            binCount.store(0, std::memory_order_relaxed);
+        m_callbackStartTicks = 0;
+    };
+
+    //==============================================================================
+    std::atomic<std::uint64_t>                                  m_callbackCount{ 0 };
+    std::atomic<std::uint64_t>                                  m_deadlineMissCount{ 0 };
+    std::atomic<std::uint64_t>                                  m_xrunCount{ 0 };
+    std::atomic<juce::int64>                                    m_callbackTicks{ 0 };
+    std::atomic<juce::int64>                                    m_maxCallbackTicks{ 0 };
+    std::atomic<juce::int64>                                    m_lastDeadlineTicks{ 0 };
+    std::array<std::atomic<juce::int64>, StageCount>            m_stageTicks{};
+    std::array<std::atomic<std::uint64_t>, s_histogramBinCount> m_histogram{};
+    std::atomic<bool>                                           m_resetRequested{ false };
+
+    // audio thread only
+    juce::int64 m_callbackStartTicks = 0;
+    juce::int64 m_stageStartTicks = 0;
+    juce::int64 m_deadlineTicks = 0;
+    bool        m_inCallback = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioCallbackProfiler)
+};
+
+} // namespace Mema
@@ -0,0 +1,169 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+
+
+namespace Mema
+{
+
+
+/**
+ * @class InputPositionPanner
+ * @brief Batch panner mapping 2-D input positions to crosspoint gains of the configured output speakers.
+ *
+ * @details Per layer, the output speaker unit vectors are precomputed once from the channel layout and kept as
+ * contiguous x/y arrays.  A batch of input positions is then evaluated against all speakers of its layer with vector
+ * operations for the distance part, and the resulting gains are written straight into a row-major crosspoint gain
+ * array with one row per input.  The panning law is `(0.5 * distance) ^ jmap(sharpness, 1, 5)`, outputs of other
+ * layers that have a direction are silenced.
+ */
+class InputPositionPanner
+{
+public:
+    /** @brief Position of a single input to be panned. */
+    struct InputPosition
+    {
+        std::uint16_t       input = 0;          ///< One-based input channel number.
+        int                 layer = 0;          ///< Layer whose outputs the input is panned across.
+        juce::Point<float>  position;           ///< Position in the unit circle, y pointing downwards.
+        float               sharpness = 0.5f;   ///< Panning sharpness [0, 1].
+    };
+
+    /** @brief Output speaker of a layer, given by its one-based output channel number and its angle in degrees. */
+    struct OutputSpeaker
+    {
+        int     output = 0;
+        float   angle = 0.0f;
+    };
+
+    /** @brief Panned and silenced outputs of a single layer, see setLayout. */
+    struct LayerLayout
+    {
+        std::vector<OutputSpeaker>  pannedOutputs;
+        std::vector<int>            silencedOutputs;
+    };
+
+public:
+    //==============================================================================
+    InputPositionPanner() = default;
+    virtual ~InputPositionPanner() = default;
+
+    //==============================================================================
+    /** @brief Drops all precomputed layouts, e.g. when the channel configuration changed. */
+    void clearLayouts() { m_layouts.clear(); };
+    bool hasLayout(int layer) const { return 0 != m_layouts.count(layer); };
+
+    /**
+     * @brief Precomputes the speaker unit vectors of @p layer.
+     * @param pannedOutputs     Speakers the inputs of this layer are panned across.
+     * @param silencedOutputs   One-based output channel numbers that are set to zero gain for inputs of this layer.
+     */
+    void setLayout(int layer, const std::vector<OutputSpeaker>& pannedOutputs, const std::vector<int>& silencedOutputs)
+    {
+        auto& layout = m_layouts[layer];
+        layout.outputs.clear();
+        layout.xs.clear();
+        layout.ys.clear();
+        for (auto const& speaker : pannedOutputs)
+        {
+            auto angleRad = juce::degreesToRadians(speaker.angle);
+            layout.outputs.push_back(speaker.output);
+            layout.xs.push_back(sinf(angleRad));
+            layout.ys.push_back(-cosf(angleRad));
+        }
+        layout.silencedOutputs = silencedOutputs;
+
+        m_scratch.resize(std::max(m_scratch.size(), layout.xs.size()));
+        m_scratchY.resize(m_scratch.size());
+    };
+    void setLayout(int layer, const LayerLayout& layerLayout) { setLayout(layer, layerLayout.pannedOutputs, layerLayout.silencedOutputs); };
+
+    /** @brief Returns the one-based output channel numbers an input of @p layer is panned across. */
+    const std::vector<int>& getPannedOutputs(int layer) const { return hasLayout(layer) ? m_layouts.at(layer).outputs : m_noOutputs; };
+    /** @brief Returns the one-based output channel numbers silenced for an input of @p layer. */
+    const std::vector<int>& getSilencedOutputs(int layer) const { return hasLayout(layer) ? m_layouts.at(layer).silencedOutputs : m_noOutputs; };
+
+    //==============================================================================
+    /**
+     * @brief Evaluates the gains of all @p inputs in one pass.
+     * @details Gains are written to `crosspointGains[(input - 1) * numOutputs + (output - 1)]`, inputs and outputs outside
+     *          of @p numInputs / @p numOutputs as well as inputs of layers without layout are skipped.
+     */
+    void process(const std::vector<InputPosition>& inputs, float* crosspointGains, int numInputs, int numOutputs)
+    {
+        for (auto const& input : inputs)
+        {
+            auto layoutIter = m_layouts.find(input.layer);
+            if (layoutIter == m_layouts.end() || input.input < 1 || input.input > numInputs)
+                continue;
+
+            auto const& layout = layoutIter->second;
+            auto numSpeakers = int(layout.xs.size());
+            auto* row = crosspointGains + (input.input - 1) * numOutputs;
+
+            if (numSpeakers > 0)
+            {
+                // 0.25 * squared distance of the input to every speaker of the layer
+                auto* dx = m_scratch.data();
+                auto* dy = m_scratchY.data();
+                juce::FloatVectorOperations::add(dx, layout.xs.data(), -input.position.getX(), numSpeakers);
+                juce::FloatVectorOperations::add(dy, layout.ys.data(), -input.position.getY(), numSpeakers);
+                juce::FloatVectorOperations::multiply(dx, dx, numSpeakers);
+                juce::FloatVectorOperations::multiply(dy, dy, numSpeakers);
+                juce::FloatVectorOperations::add(dx, dy, numSpeakers);
+                juce::FloatVectorOperations::multiply(dx, 0.25f, numSpeakers);
+
+                // (0.5 * distance) ^ exp == (0.25 * distance^2) ^ (exp / 2), saves the square root
+                auto halfExp = 0.5f * juce::jmap(input.sharpness, 1.0f, 5.0f);
+                for (auto i = 0; i < numSpeakers; i++)
+                {
+                    auto output = layout.outputs[size_t(i)];
+                    if (output >= 1 && output <= numOutputs)
+                        row[output - 1] = std::pow(dx[i], halfExp);
+                }
+            }
+
+            for (auto const& output : layout.silencedOutputs)
+                if (output >= 1 && output <= numOutputs)
+                    row[output - 1] = 0.0f;
+        }
+    };
+
+private:
+    //==============================================================================
+    /** @brief Precomputed speaker unit vectors of one layer, structure of arrays. */
+    struct Layout
+    {
+        std::vector<int>    outputs;
+        std::vector<float>  xs;
+        std::vector<float>  ys;
+        std::vector<int>    silencedOutputs;
+    };
+
+    //==============================================================================
+    std::map<int, Layout>   m_layouts;
+    std::vector<float>      m_scratch;      ///< Per input distance scratch, sized to the largest layout.
+    std::vector<float>      m_scratchY;
+    const std::vector<int>  m_noOutputs;
+};
+
+
+};
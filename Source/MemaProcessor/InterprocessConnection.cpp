@@ -76,8 +76,15 @@ void InterprocessConnectionServerImpl::createMessageThread(int id)
 {
     m_sendMessageResults[id].store(true);
 
+    auto telemetryCounters = std::make_shared<TelemetryCounters>();
+    telemetryCounters->connectedTicks = juce::Time::getHighResolutionTicks();
+    {
+        std::lock_guard<std::mutex> tl(m_telemetryMutex);
+        m_telemetryCounters[id] = telemetryCounters;
+    }
+
     m_sendMessageThreadsActive[id].store(true);
-    m_sendMessageThreads[id] = std::make_unique<std::thread>([this, id]() {
+    m_sendMessageThreads[id] = std::make_unique<std::thread>([this, id, telemetryCounters]() {
         auto thisId = id;
         std::unique_lock<std::mutex> sendMessageSignal(m_sendMessageCVMutexs[thisId]);
         while (m_sendMessageThreadsActive[thisId].load())
@@ -87,11 +94,42 @@ void InterprocessConnectionServerImpl::createMessageThread(int id)
             std::unique_lock<std::mutex> l(m_sendMessageMutexs[thisId]);
             while (!m_sendMessageLists[thisId].empty())
             {
-                auto messageData = m_sendMessageLists[thisId].front();
+                auto queuedMessage = m_sendMessageLists[thisId].front();
                 m_sendMessageLists[thisId].pop();
+                telemetryCounters->queuedMessages.store(m_sendMessageLists[thisId].size(), std::memory_order_relaxed);
                 l.unlock();
-                if (m_connections[thisId] && m_connections[thisId]->isConnected() && !m_connections[thisId]->sendMessage(messageData))
-                    m_sendMessageResults[thisId].store(false);
+                if (m_connections[thisId] && m_connections[thisId]->isConnected())
+                {
+                    auto writeStartTicks = juce::Time::getHighResolutionTicks();
+                    auto sent = m_connections[thisId]->sendMessage(queuedMessage.data);
+                    auto writeEndTicks = juce::Time::getHighResolutionTicks();
+                    if (!sent)
+                    {
+                        m_sendMessageResults[thisId].store(false);
+                        telemetryCounters->sendFailures.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        auto& typeCounters = telemetryCounters->types[size_t(getMessageTypeSlot(queuedMessage.data))];
+                        typeCounters.sentMessages.fetch_add(1, std::memory_order_relaxed);
+                        typeCounters.sentBytes.fetch_add(queuedMessage.data.getSize(), std::memory_order_relaxed);
+
+                        // only this thread writes the sums and maxima, no compare-exchange needed
+                        auto latencyTicks = writeEndTicks - queuedMessage.enqueueTicks;
+                        telemetryCounters->sendLatencySumTicks.fetch_add(latencyTicks, std::memory_order_relaxed);
+                        if (latencyTicks > telemetryCounters->sendLatencyMaxTicks.load(std::memory_order_relaxed))
+                            telemetryCounters->sendLatencyMaxTicks.store(latencyTicks, std::memory_order_relaxed);
+
+                        auto writeTicks = writeEndTicks - writeStartTicks;
+                        if (writeTicks > telemetryCounters->writeMaxTicks.load(std::memory_order_relaxed))
+                            telemetryCounters->writeMaxTicks.store(writeTicks, std::memory_order_relaxed);
+                        if (juce::Time::highResolutionTicksToSeconds(writeTicks) * 1.0e6 > s_writeStallThresholdUs)
+                        {
+                            telemetryCounters->writeStallCount.fetch_add(1, std::memory_order_relaxed);
+                            telemetryCounters->writeStallSumTicks.fetch_add(writeTicks, std::memory_order_relaxed);
+                        }
+                    }
+                }
                 l.lock();
             }
         }
@@ -119,6 +157,9 @@ void InterprocessConnectionServerImpl::endMessageThread(int id)
     m_sendMessageThreads.erase(id);
     m_sendMessageCVs.erase(id);
     m_sendMessageCVMutexs.erase(id);
+
+    std::lock_guard<std::mutex> tl(m_telemetryMutex);
+    m_telemetryCounters.erase(id);
 }
 
 std::map<int, std::pair<double, bool>> InterprocessConnectionServerImpl::getListHealth()
@@ -140,6 +181,47 @@ std::map<int, std::pair<double, bool>> InterprocessConnectionServerImpl::getList
     return rList;
 }
 
+std::vector<InterprocessConnectionServerImpl::ConnectionTelemetry> InterprocessConnectionServerImpl::getTelemetry() const
+{
+    auto ticksToUs = [](juce::int64 ticks) { return juce::Time::highResolutionTicksToSeconds(ticks) * 1.0e6; };
+    auto nowTicks = juce::Time::getHighResolutionTicks();
+
+    std::lock_guard<std::mutex> tl(m_telemetryMutex);
+    std::vector<ConnectionTelemetry> telemetry;
+    telemetry.reserve(m_telemetryCounters.size());
+    for (auto const& countersKV : m_telemetryCounters)
+    {
+        auto const& counters = *countersKV.second;
+        auto connectionTelemetry = ConnectionTelemetry();
+        connectionTelemetry.connectionId = countersKV.first;
+        connectionTelemetry.connectedSeconds = juce::Time::highResolutionTicksToSeconds(nowTicks - counters.connectedTicks);
+        connectionTelemetry.queuedMessages = counters.queuedMessages.load(std::memory_order_relaxed);
+        connectionTelemetry.sendFailures = counters.sendFailures.load(std::memory_order_relaxed);
+        connectionTelemetry.sendLatencySumUs = ticksToUs(counters.sendLatencySumTicks.load(std::memory_order_relaxed));
+        connectionTelemetry.sendLatencyMaxUs = ticksToUs(counters.sendLatencyMaxTicks.load(std::memory_order_relaxed));
+        connectionTelemetry.writeStallCount = counters.writeStallCount.load(std::memory_order_relaxed);
+        connectionTelemetry.writeStallSumUs = ticksToUs(counters.writeStallSumTicks.load(std::memory_order_relaxed));
+        connectionTelemetry.writeMaxUs = ticksToUs(counters.writeMaxTicks.load(std::memory_order_relaxed));
+        for (auto i = 0; i < s_messageTypeSlotCount; i++)
+        {
+            connectionTelemetry.types[size_t(i)].sentMessages = counters.types[size_t(i)].sentMessages.load(std::memory_order_relaxed);
+            connectionTelemetry.types[size_t(i)].sentBytes = counters.types[size_t(i)].sentBytes.load(std::memory_order_relaxed);
+            connectionTelemetry.types[size_t(i)].droppedMessages = counters.types[size_t(i)].droppedMessages.load(std::memory_order_relaxed);
+        }
+        telemetry.push_back(connectionTelemetry);
+    }
+    return telemetry;
+}
+
+int InterprocessConnectionServerImpl::getMessageTypeSlot(const juce::MemoryBlock& message)
+{
+    // serialized messages start with their uint32 type discriminator
+    std::uint32_t type = 0;
+    if (message.getSize() >= sizeof(std::uint32_t))
+        message.copyTo(&type, 0, sizeof(std::uint32_t));
+    return type < std::uint32_t(s_messageTypeSlotCount) ? int(type) : 0;
+}
+
 bool InterprocessConnectionServerImpl::hasActiveConnection(int id)
 {
     if (m_connections.count(id) != 1)
@@ -197,19 +279,28 @@ const std::vector<int> InterprocessConnectionServerImpl::getActiveConnectionIds(
 bool InterprocessConnectionServerImpl::enqueueMessage(const MemoryBlock& message, std::vector<int> sendIds)
 {
     auto rVal = true;
+    auto enqueueTicks = juce::Time::getHighResolutionTicks();
+    std::lock_guard<std::mutex> tl(m_telemetryMutex);
     for (auto const& th : m_sendMessageThreads)
     {
         if (sendIds.empty() || std::find(sendIds.begin(), sendIds.end(), th.first) != sendIds.end())
         {
+            auto countersIter = m_telemetryCounters.find(th.first);
+            auto counters = (m_telemetryCounters.end() != countersIter) ? countersIter->second.get() : nullptr;
+
             std::lock_guard<std::mutex> l(m_sendMessageMutexs[th.first]);
-            m_sendMessageLists[th.first].push(message);
+            m_sendMessageLists[th.first].push({ message, enqueueTicks });
             if (m_sendMessageLists[th.first].size() > s_listSizeThreshold)
             {
+                if (counters)
+                    counters->types[size_t(getMessageTypeSlot(m_sendMessageLists[th.first].front().data))].droppedMessages.fetch_add(1, std::memory_order_relaxed);
                 m_sendMessageLists[th.first].pop();
                 m_sendMessageListClipped[th.first] = true;
             }
             else
                 m_sendMessageListClipped[th.first] = false;
+            if (counters)
+                counters->queuedMessages.store(m_sendMessageLists[th.first].size(), std::memory_order_relaxed);
             if (!m_sendMessageResults[th.first].load())
             {
                 rVal = false;
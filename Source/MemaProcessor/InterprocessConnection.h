@@ -53,9 +53,48 @@ private:
 
 /** @class InterprocessConnectionServerImpl
  *  @brief TCP server that accepts multiple simultaneous client connections on a fixed port.
+ *
+ *  Every connection has its own send thread draining a send queue, which is clipped at
+ *  s_listSizeThreshold messages by dropping the oldest one.  Send statistics per connection and
+ *  message type are counted in atomics by the send thread and enqueueMessage, getTelemetry
+ *  returns them as plain totals since the connection was accepted.
  */
 class InterprocessConnectionServerImpl : public juce::InterprocessConnectionServer
 {
+public:
+    static constexpr int s_messageTypeSlotCount = 32;           ///< Message types are counted by their type discriminator, higher ones in slot 0.
+    static constexpr double s_writeStallThresholdUs = 1000.0;   ///< Socket writes taking longer than this count as stall.
+
+    /** @brief Send statistics of one connection, totals since it was accepted. */
+    struct ConnectionTelemetry
+    {
+        /** @brief Counters of one message type. */
+        struct TypeCounters
+        {
+            std::uint64_t   sentMessages = 0;
+            std::uint64_t   sentBytes = 0;
+            std::uint64_t   droppedMessages = 0;    ///< Discarded from the full send queue before they were sent.
+        };
+
+        int                                                 connectionId = -1;
+        double                                              connectedSeconds = 0.0;
+        std::uint64_t                                       queuedMessages = 0;     ///< Current send queue length.
+        std::uint64_t                                       sendFailures = 0;
+        double                                              sendLatencySumUs = 0.0; ///< Sum of enqueue to socket write completion over all sent messages.
+        double                                              sendLatencyMaxUs = 0.0;
+        std::uint64_t                                       writeStallCount = 0;
+        double                                              writeStallSumUs = 0.0;  ///< Time spent in socket writes that took longer than s_writeStallThresholdUs.
+        double                                              writeMaxUs = 0.0;
+        std::array<TypeCounters, s_messageTypeSlotCount>    types;
+
+        /** @brief Returns the number of messages sent, over all types. */
+        std::uint64_t getSentMessages() const { std::uint64_t count = 0; for (auto const& type : types) count += type.sentMessages; return count; };
+        /** @brief Returns the number of bytes sent, over all types. */
+        std::uint64_t getSentBytes() const { std::uint64_t count = 0; for (auto const& type : types) count += type.sentBytes; return count; };
+        /** @brief Returns the number of messages dropped from the send queue, over all types. */
+        std::uint64_t getDroppedMessages() const { std::uint64_t count = 0; for (auto const& type : types) count += type.droppedMessages; return count; };
+    };
+
 public:
     InterprocessConnectionServerImpl();
     virtual ~InterprocessConnectionServerImpl();
@@ -63,6 +102,8 @@ public:
     void createMessageThread(int id);
 
     std::map<int, std::pair<double, bool>> getListHealth();
+    /** @brief Returns the send statistics of all connections. Safe to call from any thread. */
+    std::vector<ConnectionTelemetry> getTelemetry() const;
 
     bool hasActiveConnection(int id);
     bool hasActiveConnections();
@@ -78,11 +119,42 @@ public:
     static constexpr double s_listSizeThreshold = 35.0;
 
 private:
+    /** @brief A message waiting in a send queue. */
+    struct QueuedMessage
+    {
+        juce::MemoryBlock   data;
+        juce::int64         enqueueTicks = 0;   ///< High resolution ticks at enqueueMessage, reference for the send latency.
+    };
+
+    /** @brief Atomic counterpart of ConnectionTelemetry, durations in high resolution ticks. */
+    struct TelemetryCounters
+    {
+        struct TypeCounters
+        {
+            std::atomic<std::uint64_t>  sentMessages{ 0 };
+            std::atomic<std::uint64_t>  sentBytes{ 0 };
+            std::atomic<std::uint64_t>  droppedMessages{ 0 };
+        };
+
+        juce::int64                                         connectedTicks = 0;
+        std::atomic<std::uint64_t>                          queuedMessages{ 0 };
+        std::atomic<std::uint64_t>                          sendFailures{ 0 };
+        std::atomic<juce::int64>                            sendLatencySumTicks{ 0 };
+        std::atomic<juce::int64>                            sendLatencyMaxTicks{ 0 };
+        std::atomic<std::uint64_t>                          writeStallCount{ 0 };
+        std::atomic<juce::int64>                            writeStallSumTicks{ 0 };
+        std::atomic<juce::int64>                            writeMaxTicks{ 0 };
+        std::array<TypeCounters, s_messageTypeSlotCount>    types;
+    };
+
     InterprocessConnection* createConnectionObject();
     void endMessageThread(int id);
 
+    /** @brief Returns the telemetry slot of a serialized message, i.e. its type discriminator. */
+    static int getMessageTypeSlot(const juce::MemoryBlock& message);
+
     std::map<int, std::mutex>                       m_sendMessageMutexs;
-    std::map<int, std::queue<juce::MemoryBlock>>    m_sendMessageLists;
+    std::map<int, std::queue<QueuedMessage>>        m_sendMessageLists;
     std::map<int, bool>                             m_sendMessageListClipped;
     std::map<int, std::atomic<bool>>                m_sendMessageResults;
 
@@ -91,6 +163,9 @@ private:
     std::map<int, std::condition_variable>		m_sendMessageCVs;
     std::map<int, std::mutex>                   m_sendMessageCVMutexs;
 
+    std::map<int, std::shared_ptr<TelemetryCounters>>   m_telemetryCounters; ///< Shared with the send thread, which keeps its counters alive until it ended.
+    mutable std::mutex                                  m_telemetryMutex; ///< Guards m_telemetryCounters (not the counters), which is read from other threads than it is changed on.
+
     std::map<int, std::unique_ptr<InterprocessConnectionImpl>> m_connections;
     int m_connectionIdIter = 0;
 };
@@ -59,6 +59,12 @@ void MemaInputCommander::setInputLevelPollCallback(const std::function<void(Mema
 	onInputLevelPollCallback = callback;
 }
 
+void MemaInputCommander::setInputMutes(const std::map<std::uint16_t, bool>& muteStates, int userId)
+{
+	for (auto const& muteStateKV : muteStates)
+		setInputMute(muteStateKV.first, muteStateKV.second, userId);
+}
+
 void MemaInputCommander::inputMuteChange(std::uint16_t channel, bool muteState, MemaInputCommander* /*sender*/)
 {
 	if (onInputMuteChangeCallback)
@@ -112,6 +118,12 @@ void MemaOutputCommander::setOutputLevelPollCallback(const std::function<void(Me
 	onOutputLevelPollCallback = callback;
 }
 
+void MemaOutputCommander::setOutputMutes(const std::map<std::uint16_t, bool>& muteStates, int userId)
+{
+	for (auto const& muteStateKV : muteStates)
+		setOutputMute(muteStateKV.first, muteStateKV.second, userId);
+}
+
 void MemaOutputCommander::outputMuteChange(std::uint16_t channel, bool muteState, MemaOutputCommander* /*sender*/)
 {
 	if (onOutputMuteChangeCallback)
@@ -155,6 +167,16 @@ void MemaCrosspointCommander::setCrosspointEnabledPollCallback(const std::functi
 	onCrosspointEnabledPollCallback = callback;
 }
 
+void MemaCrosspointCommander::setCrosspointValues(const std::map<std::uint16_t, std::map<std::uint16_t, bool>>& enabledStates, const std::map<std::uint16_t, std::map<std::uint16_t, float>>& factors, int userId)
+{
+	for (auto const& enabledStatesKV : enabledStates)
+		for (auto const& enabledStateKV : enabledStatesKV.second)
+			setCrosspointEnabledValue(enabledStatesKV.first, enabledStateKV.first, enabledStateKV.second, userId);
+	for (auto const& factorsKV : factors)
+		for (auto const& factorKV : factorsKV.second)
+			setCrosspointFactorValue(factorsKV.first, factorKV.first, factorKV.second, userId);
+}
+
 void MemaCrosspointCommander::crosspointEnabledChange(std::uint16_t input, std::uint16_t output, bool enabledState, MemaCrosspointCommander* sender)
 {
 	if (onCrosspointEnabledChangeCallback)
@@ -54,6 +54,8 @@ public:
     void setInputLevelPollCallback(const std::function<void(MemaInputCommander* sender, std::uint16_t)>& callback);
 
     virtual void setInputMute(std::uint16_t channel, bool muteState, int userId = -1) = 0;
+    /** @brief Sets the mute states of all channels in @p muteStates at once, channels not contained are left untouched. The default implementation forwards to setInputMute per channel. */
+    virtual void setInputMutes(const std::map<std::uint16_t, bool>& muteStates, int userId = -1);
     virtual void setInputLevel(std::uint16_t channel, float levelValue, int userId = -1) { ignoreUnused(channel); ignoreUnused(levelValue); ignoreUnused(userId); };
 
 protected:
@@ -85,6 +87,8 @@ public:
     void setOutputLevelPollCallback(const std::function<void(MemaOutputCommander* sender, std::uint16_t)>& callback);
 
     virtual void setOutputMute(std::uint16_t channel, bool muteState, int userId = -1) = 0;
+    /** @brief Sets the mute states of all channels in @p muteStates at once, channels not contained are left untouched. The default implementation forwards to setOutputMute per channel. */
+    virtual void setOutputMutes(const std::map<std::uint16_t, bool>& muteStates, int userId = -1);
     virtual void setOutputLevel(std::uint16_t channel, float levelValue, int userId = -1) { ignoreUnused(channel); ignoreUnused(levelValue); ignoreUnused(userId);
     };
 
@@ -119,6 +123,14 @@ public:
     void setCrosspointFactorPollCallback(const std::function<void(MemaCrosspointCommander* sender, std::uint16_t, std::uint16_t)>& callback);
     virtual void setCrosspointFactorValue(std::uint16_t input, std::uint16_t output, float factor, int userId = -1) = 0;
 
+    /**
+     * @brief Sets enabled states and factors of many crosspoints at once, e.g. the whole matrix on reset or scene recall.
+     * @details Both maps are [input][output] and may be sparse, nodes not contained are left untouched.  The default
+     *          implementation forwards to setCrosspointEnabledValue / setCrosspointFactorValue per node, implementations
+     *          should override it to apply the batch as a single update.
+     */
+    virtual void setCrosspointValues(const std::map<std::uint16_t, std::map<std::uint16_t, bool>>& enabledStates, const std::map<std::uint16_t, std::map<std::uint16_t, float>>& factors, int userId = -1);
+
     virtual void setIOCount(std::uint16_t inputCount, std::uint16_t outputCount) = 0;
 
 protected:
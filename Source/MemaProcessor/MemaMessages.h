@@ -23,6 +23,8 @@
 #include <CustomLookAndFeel.h>
 
 #include "MemaPluginParameterInfo.h"
+#include "InputPositionPanner.h"
+#include "AudioCallbackProfiler.h"
 
 namespace Mema
 {
@@ -42,6 +44,14 @@ class ControlParametersMessage;
 class PluginParameterInfosMessage;
 class PluginParameterValueMessage;
 class PluginProcessingStateMessage;
+class PluginParameterValuesMessage;
+class PluginParameterSubscriptionMessage;
+class PanningLayoutMessage;
+class ObjectPositionsMessage;
+class SceneListMessage;
+class SceneRecallMessage;
+class SceneStoreMessage;
+class AudioCallbackProfileMessage;
 
 /**
  * @class SerializableMessage
@@ -88,7 +98,15 @@ public:
         ControlParameters,           ///< Full routing-matrix state snapshot; sent by Mema on connect and echoed by Mema.Re on change.
         PluginParameterInfos,        ///< Plugin name and full parameter descriptor list; sent by Mema when a plugin is loaded or changed.
         PluginParameterValue,        ///< Single parameter value update sent from Mema.Re to Mema.
-        PluginProcessingState        ///< Plugin enabled and pre/post processing state; sent bidirectionally between Mema and Mema.Re.
+        PluginProcessingState,       ///< Plugin enabled and pre/post processing state; sent bidirectionally between Mema and Mema.Re.
+        PluginParameterValues,       ///< Batch of coalesced parameter value updates (latest value per index) sent from Mema to clients once per flush tick.
+        PluginParameterSubscription, ///< Sent by a client to restrict the parameter value updates it receives to a set of parameter indices.
+        PanningLayout,               ///< Output speaker layout per layer; sent by a client before it sends object positions for server-side panning.
+        ObjectPositions,             ///< Batch of input object positions; panned to crosspoint gains by Mema.
+        SceneList,                   ///< Ids and names of the scenes stored in Mema; sent on connect and whenever the store changes.
+        SceneRecall,                 ///< Sent by a client to recall a stored scene, optionally crossfaded.
+        SceneStore,                  ///< Sent by a client to store the current state as scene.
+        AudioCallbackProfile         ///< Audio callback stage timings, deadline histogram and xrun count; sent by Mema periodically to subscribed clients.
     };
 
 public:
@@ -158,11 +176,58 @@ public:
             return reinterpret_cast<SerializableMessage*>(std::make_unique<PluginParameterValueMessage>(blob).release());
         case PluginProcessingState:
             return reinterpret_cast<SerializableMessage*>(std::make_unique<PluginProcessingStateMessage>(blob).release());
+        case PluginParameterValues:
+            return reinterpret_cast<SerializableMessage*>(std::make_unique<PluginParameterValuesMessage>(blob).release());
+        case PluginParameterSubscription:
+            return reinterpret_cast<SerializableMessage*>(std::make_unique<PluginParameterSubscriptionMessage>(blob).release());
+        case PanningLayout:
+            return reinterpret_cast<SerializableMessage*>(std::make_unique<PanningLayoutMessage>(blob).release());
+        case ObjectPositions:
+            return reinterpret_cast<SerializableMessage*>(std::make_unique<ObjectPositionsMessage>(blob).release());
+        case SceneList:
+            return reinterpret_cast<SerializableMessage*>(std::make_unique<SceneListMessage>(blob).release());
+        case SceneRecall:
+            return reinterpret_cast<SerializableMessage*>(std::make_unique<SceneRecallMessage>(blob).release());
+        case SceneStore:
+            return reinterpret_cast<SerializableMessage*>(std::make_unique<SceneStoreMessage>(blob).release());
+        case AudioCallbackProfile:
+            return reinterpret_cast<SerializableMessage*>(std::make_unique<AudioCallbackProfileMessage>(blob).release());
         case None:
         default:
             return nullptr;
         }
     };
+    /**
+     * @brief Returns a short lowercase name of a message type, as used for diagnostics and metrics labels.
+     * @param type The message type discriminator.
+     * @return The name, or "unknown" for types outside the enum.
+     */
+    static const char* getTypeName(SerializableMessageType type)
+    {
+        switch (type)
+        {
+        case None:                          return "none";
+        case EnvironmentParameters:         return "environment_parameters";
+        case AnalyzerParameters:            return "analyzer_parameters";
+        case ReinitIOCount:                 return "reinit_io_count";
+        case AudioInputBuffer:              return "audio_input_buffer";
+        case AudioOutputBuffer:             return "audio_output_buffer";
+        case DataTrafficTypeSelection:      return "data_traffic_type_selection";
+        case ControlParameters:             return "control_parameters";
+        case PluginParameterInfos:          return "plugin_parameter_infos";
+        case PluginParameterValue:          return "plugin_parameter_value";
+        case PluginProcessingState:         return "plugin_processing_state";
+        case PluginParameterValues:         return "plugin_parameter_values";
+        case PluginParameterSubscription:   return "plugin_parameter_subscription";
+        case PanningLayout:                 return "panning_layout";
+        case ObjectPositions:               return "object_positions";
+        case SceneList:                     return "scene_list";
+        case SceneRecall:                   return "scene_recall";
+        case SceneStore:                    return "scene_store";
+        case AudioCallbackProfile:          return "audio_callback_profile";
+        default:                            return "unknown";
+        }
+    };
     /**
      * @brief Type-correctly destroys a `SerializableMessage*` returned by `initFromMemoryBlock()`.
      * @details Because the pointer is typed as the base class, a plain `delete` would invoke the
@@ -220,6 +285,46 @@ public:
                     auto pesm = std::unique_ptr<PluginProcessingStateMessage>(reinterpret_cast<PluginProcessingStateMessage*>(message));
                 }
                 break;
+            case PluginParameterValues:
+                {
+                    auto ppvsm = std::unique_ptr<PluginParameterValuesMessage>(reinterpret_cast<PluginParameterValuesMessage*>(message));
+                }
+                break;
+            case PluginParameterSubscription:
+                {
+                    auto ppsm = std::unique_ptr<PluginParameterSubscriptionMessage>(reinterpret_cast<PluginParameterSubscriptionMessage*>(message));
+                }
+                break;
+            case PanningLayout:
+                {
+                    auto plm = std::unique_ptr<PanningLayoutMessage>(reinterpret_cast<PanningLayoutMessage*>(message));
+                }
+                break;
+            case ObjectPositions:
+                {
+                    auto opm = std::unique_ptr<ObjectPositionsMessage>(reinterpret_cast<ObjectPositionsMessage*>(message));
+                }
+                break;
+            case SceneList:
+                {
+                    auto slm = std::unique_ptr<SceneListMessage>(reinterpret_cast<SceneListMessage*>(message));
+                }
+                break;
+            case SceneRecall:
+                {
+                    auto srm = std::unique_ptr<SceneRecallMessage>(reinterpret_cast<SceneRecallMessage*>(message));
+                }
+                break;
+            case SceneStore:
+                {
+                    auto ssm = std::unique_ptr<SceneStoreMessage>(reinterpret_cast<SceneStoreMessage*>(message));
+                }
+                break;
+            case AudioCallbackProfile:
+                {
+                    auto acpm = std::unique_ptr<AudioCallbackProfileMessage>(reinterpret_cast<AudioCallbackProfileMessage*>(message));
+                }
+                break;
             case None:
             default:
                 break;
@@ -265,39 +370,58 @@ protected:
  * @details Sent by `MemaProcessor` immediately after a new TCP client connects, so that
  * Mema.Mo and Mema.Re can match Mema's current dark/light palette without manual
  * configuration on the client side.  Also re-sent whenever the user changes the palette
- * in Mema's settings menu.
+ * in Mema's settings menu.  It also announces the optional protocol features the sending
+ * Mema supports, so that clients can fall back to older message flows when talking to an
+ * older Mema.
  *
- * **Wire payload (4 bytes):** `PaletteStyle` enum value.
+ * **Wire payload (8 bytes):** `PaletteStyle` enum value + uint32 capability flags.  Older Mema
+ * versions only send the palette style, which reads as no capabilities, older clients ignore
+ * the trailing flags.
  */
 class EnvironmentParametersMessage : public SerializableMessage
 {
+public:
+    /** @brief Optional protocol features, combined as bit flags. */
+    enum Capability : std::uint32_t
+    {
+        ServerSidePanning = 1 << 0,  ///< Mema pans PanningLayout/ObjectPositions itself, clients need not send crosspoints.
+    };
+    static constexpr std::uint32_t s_supportedCapabilities = ServerSidePanning; ///< Capabilities of this build.
+
 public:
     EnvironmentParametersMessage() = default;
-    EnvironmentParametersMessage(JUCEAppBasics::CustomLookAndFeel::PaletteStyle paletteStyle) { m_type = SerializableMessageType::EnvironmentParameters; m_paletteStyle = paletteStyle; };
+    EnvironmentParametersMessage(JUCEAppBasics::CustomLookAndFeel::PaletteStyle paletteStyle, std::uint32_t capabilities = s_supportedCapabilities) { m_type = SerializableMessageType::EnvironmentParameters; m_paletteStyle = paletteStyle; m_capabilities = capabilities; };
     EnvironmentParametersMessage(const juce::MemoryBlock& blob)
     {
         jassert(SerializableMessageType::EnvironmentParameters == static_cast<SerializableMessageType>(blob[0]));
 
         m_type = SerializableMessageType::EnvironmentParameters;
         blob.copyTo(&m_paletteStyle, sizeof(SerializableMessageType), sizeof(JUCEAppBasics::CustomLookAndFeel::PaletteStyle));
+        auto capabilitiesPos = sizeof(SerializableMessageType) + sizeof(JUCEAppBasics::CustomLookAndFeel::PaletteStyle);
+        if (blob.getSize() >= capabilitiesPos + sizeof(std::uint32_t))
+            blob.copyTo(&m_capabilities, int(capabilitiesPos), sizeof(std::uint32_t));
 
     };
     ~EnvironmentParametersMessage() = default;
 
     /** @brief Returns the palette style carried by this message. @return The look-and-feel palette (dark, light, or follow-host). */
     JUCEAppBasics::CustomLookAndFeel::PaletteStyle getPaletteStyle() const { return m_paletteStyle; };
+    /** @brief Returns true if the sending Mema supports @p capability. */
+    bool hasCapability(Capability capability) const { return 0 != (m_capabilities & capability); };
 
 protected:
     juce::MemoryBlock createSerializedContent(size_t& contentSize) const override
     {
         juce::MemoryBlock blob;
         blob.append(&m_paletteStyle, sizeof(JUCEAppBasics::CustomLookAndFeel::PaletteStyle));
+        blob.append(&m_capabilities, sizeof(std::uint32_t));
         contentSize = blob.getSize();
         return blob;
     };
 
 private:
     JUCEAppBasics::CustomLookAndFeel::PaletteStyle m_paletteStyle = JUCEAppBasics::CustomLookAndFeel::PS_Dark; ///< The palette style to apply on the receiving client.
+    std::uint32_t m_capabilities = 0; ///< Capability flags of the sending Mema, 0 if it predates them.
 };
 
 //==============================================================================
@@ -1211,6 +1335,621 @@ private:
     bool m_post = false; ///< Whether the plugin is inserted post-matrix.
 };
 
+/**
+ * @class PluginParameterValuesMessage
+ * @brief Carries a batch of normalised plugin parameter values from Mema to its clients.
+ *
+ * @details Plugins that report many parameter changes per block (meters exposed as parameters,
+ * LFO-modulated values) would otherwise produce one `PluginParameterValueMessage` per change.
+ * `MemaNetworkClientCommanderWrapper` instead coalesces all changes to the latest value per
+ * parameter index and sends a single instance of this message per client and flush tick,
+ * containing only the parameters the client subscribed to (see `PluginParameterSubscriptionMessage`).
+ * Clients opt in by listing `PluginParameterValues` in their `DataTrafficTypeSelectionMessage`;
+ * clients that only list `PluginParameterValue` keep receiving individual (coalesced) messages.
+ *
+ * The string parameter ID is not transmitted; receivers resolve it from the
+ * `PluginParameterInfosMessage` that is always sent before value updates of a newly loaded plugin.
+ *
+ * **Wire payload:** uint16 valueCount + (uint16 parameterIndex + float currentValue) × valueCount.
+ *
+ * @note Values are normalised to [0, 1] as required by JUCE's `AudioProcessorParameter::setValue()`.
+ */
+class PluginParameterValuesMessage : public SerializableMessage
+{
+public:
+    PluginParameterValuesMessage() = default;
+    PluginParameterValuesMessage(const std::vector<std::pair<std::uint16_t, float>>& parameterValues)
+    {
+        m_type = SerializableMessageType::PluginParameterValues;
+        m_parameterValues = parameterValues;
+    }
+
+    PluginParameterValuesMessage(const juce::MemoryBlock& blob)
+    {
+        jassert(SerializableMessageType::PluginParameterValues == static_cast<SerializableMessageType>(blob[0]));
+
+        m_type = SerializableMessageType::PluginParameterValues;
+
+        auto readPos = int(sizeof(SerializableMessageType));
+
+        std::uint16_t valueCount;
+        blob.copyTo(&valueCount, readPos, sizeof(std::uint16_t));
+        readPos += sizeof(std::uint16_t);
+        m_parameterValues.resize(valueCount);
+        for (int i = 0; i < valueCount; i++)
+        {
+            blob.copyTo(&m_parameterValues[i].first, readPos, sizeof(std::uint16_t));
+            readPos += sizeof(std::uint16_t);
+            blob.copyTo(&m_parameterValues[i].second, readPos, sizeof(float));
+            readPos += sizeof(float);
+        }
+    }
+
+    ~PluginParameterValuesMessage() = default;
+
+    /** @brief Returns the (zero-based parameter index, normalised value) pairs carried by this batch. */
+    const std::vector<std::pair<std::uint16_t, float>>& getParameterValues() const { return m_parameterValues; }
+
+protected:
+    juce::MemoryBlock createSerializedContent(size_t& contentSize) const override
+    {
+        juce::MemoryBlock blob;
+        auto valueCount = std::uint16_t(m_parameterValues.size());
+        blob.append(&valueCount, sizeof(std::uint16_t));
+        for (auto const& parameterValue : m_parameterValues)
+        {
+            blob.append(&parameterValue.first, sizeof(std::uint16_t));
+            blob.append(&parameterValue.second, sizeof(float));
+        }
+        contentSize = blob.getSize();
+        return blob;
+    }
+
+private:
+    std::vector<std::pair<std::uint16_t, float>> m_parameterValues; ///< Latest normalised value per zero-based parameter index.
+};
+
+/**
+ * @class PluginParameterSubscriptionMessage
+ * @brief Sent by a client to select which plugin parameters it wants value updates for.
+ *
+ * @details Until a client sends this message it receives updates for all parameters.  Once sent,
+ * Mema only forwards value changes of the listed parameter indices to that client (an empty list
+ * unsubscribes from all parameter value updates).  Each message replaces the previous selection.
+ * Mema.Re subscribes to the parameters flagged as remote controllable whenever it receives a new
+ * `PluginParameterInfosMessage`.
+ *
+ * **Wire payload:** uint16 indexCount + uint16 parameterIndex × indexCount.
+ */
+class PluginParameterSubscriptionMessage : public SerializableMessage
+{
+public:
+    PluginParameterSubscriptionMessage() = default;
+    PluginParameterSubscriptionMessage(const std::vector<std::uint16_t>& parameterIndices)
+    {
+        m_type = SerializableMessageType::PluginParameterSubscription;
+        m_parameterIndices = parameterIndices;
+    }
+
+    PluginParameterSubscriptionMessage(const juce::MemoryBlock& blob)
+    {
+        jassert(SerializableMessageType::PluginParameterSubscription == static_cast<SerializableMessageType>(blob[0]));
+
+        m_type = SerializableMessageType::PluginParameterSubscription;
+
+        auto readPos = int(sizeof(SerializableMessageType));
+
+        std::uint16_t indexCount;
+        blob.copyTo(&indexCount, readPos, sizeof(std::uint16_t));
+        readPos += sizeof(std::uint16_t);
+        m_parameterIndices.resize(indexCount);
+        for (int i = 0; i < indexCount; i++)
+        {
+            blob.copyTo(&m_parameterIndices[i], readPos, sizeof(std::uint16_t));
+            readPos += sizeof(std::uint16_t);
+        }
+    }
+
+    ~PluginParameterSubscriptionMessage() = default;
+
+    /** @brief Returns the zero-based parameter indices the client wants value updates for. */
+    const std::vector<std::uint16_t>& getParameterIndices() const { return m_parameterIndices; }
+
+protected:
+    juce::MemoryBlock createSerializedContent(size_t& contentSize) const override
+    {
+        juce::MemoryBlock blob;
+        auto indexCount = std::uint16_t(m_parameterIndices.size());
+        blob.append(&indexCount, sizeof(std::uint16_t));
+        for (auto const& parameterIndex : m_parameterIndices)
+            blob.append(&parameterIndex, sizeof(std::uint16_t));
+        contentSize = blob.getSize();
+        return blob;
+    }
+
+private:
+    std::vector<std::uint16_t> m_parameterIndices; ///< Zero-based indices of the subscribed parameters.
+};
+
+
+/**
+ * @class PanningLayoutMessage
+ * @brief Carries the output speaker layout a client pans across, so Mema can run the panning itself.
+ *
+ * @details The channel layout and its speaker angles are chosen on the client (Mema.Re panning
+ * settings), Mema has no notion of them.  Before sending `ObjectPositionsMessage`s a client therefore
+ * sends this message once per channel configuration change; Mema feeds it into its
+ * `InputPositionPanner` and keeps it until the next layout message replaces it.
+ *
+ * **Wire payload:** uint16 layerCount + (int32 layer + uint16 speakerCount + (uint16 output + float angle) × speakerCount
+ * + uint16 silencedCount + uint16 output × silencedCount) × layerCount.
+ */
+class PanningLayoutMessage : public SerializableMessage
+{
+public:
+    PanningLayoutMessage() = default;
+    PanningLayoutMessage(const std::map<int, InputPositionPanner::LayerLayout>& layerLayouts)
+    {
+        m_type = SerializableMessageType::PanningLayout;
+        m_layerLayouts = layerLayouts;
+    }
+
+    PanningLayoutMessage(const juce::MemoryBlock& blob)
+    {
+        jassert(SerializableMessageType::PanningLayout == static_cast<SerializableMessageType>(blob[0]));
+
+        m_type = SerializableMessageType::PanningLayout;
+
+        auto readPos = int(sizeof(SerializableMessageType));
+
+        std::uint16_t layerCount;
+        blob.copyTo(&layerCount, readPos, sizeof(std::uint16_t));
+        readPos += sizeof(std::uint16_t);
+        for (int i = 0; i < layerCount; i++)
+        {
+            std::int32_t layer;
+            blob.copyTo(&layer, readPos, sizeof(std::int32_t));
+            readPos += sizeof(std::int32_t);
+            auto& layerLayout = m_layerLayouts[int(layer)];
+
+            std::uint16_t speakerCount;
+            blob.copyTo(&speakerCount, readPos, sizeof(std::uint16_t));
+            readPos += sizeof(std::uint16_t);
+            layerLayout.pannedOutputs.resize(speakerCount);
+            for (auto& speaker : layerLayout.pannedOutputs)
+            {
+                std::uint16_t output;
+                blob.copyTo(&output, readPos, sizeof(std::uint16_t));
+                readPos += sizeof(std::uint16_t);
+                speaker.output = int(output);
+                blob.copyTo(&speaker.angle, readPos, sizeof(float));
+                readPos += sizeof(float);
+            }
+
+            std::uint16_t silencedCount;
+            blob.copyTo(&silencedCount, readPos, sizeof(std::uint16_t));
+            readPos += sizeof(std::uint16_t);
+            layerLayout.silencedOutputs.resize(silencedCount);
+            for (auto& silencedOutput : layerLayout.silencedOutputs)
+            {
+                std::uint16_t output;
+                blob.copyTo(&output, readPos, sizeof(std::uint16_t));
+                readPos += sizeof(std::uint16_t);
+                silencedOutput = int(output);
+            }
+        }
+    }
+
+    ~PanningLayoutMessage() = default;
+
+    /** @brief Returns the layouts carried by this message, keyed by layer. */
+    const std::map<int, InputPositionPanner::LayerLayout>& getLayerLayouts() const { return m_layerLayouts; }
+
+protected:
+    juce::MemoryBlock createSerializedContent(size_t& contentSize) const override
+    {
+        juce::MemoryBlock blob;
+        auto layerCount = std::uint16_t(m_layerLayouts.size());
+        blob.append(&layerCount, sizeof(std::uint16_t));
+        for (auto const& layerLayoutKV : m_layerLayouts)
+        {
+            auto layer = std::int32_t(layerLayoutKV.first);
+            blob.append(&layer, sizeof(std::int32_t));
+
+            auto speakerCount = std::uint16_t(layerLayoutKV.second.pannedOutputs.size());
+            blob.append(&speakerCount, sizeof(std::uint16_t));
+            for (auto const& speaker : layerLayoutKV.second.pannedOutputs)
+            {
+                auto output = std::uint16_t(speaker.output);
+                blob.append(&output, sizeof(std::uint16_t));
+                blob.append(&speaker.angle, sizeof(float));
+            }
+
+            auto silencedCount = std::uint16_t(layerLayoutKV.second.silencedOutputs.size());
+            blob.append(&silencedCount, sizeof(std::uint16_t));
+            for (auto const& silencedOutput : layerLayoutKV.second.silencedOutputs)
+            {
+                auto output = std::uint16_t(silencedOutput);
+                blob.append(&output, sizeof(std::uint16_t));
+            }
+        }
+        contentSize = blob.getSize();
+        return blob;
+    }
+
+private:
+    std::map<int, InputPositionPanner::LayerLayout> m_layerLayouts; ///< Panned and silenced outputs per layer.
+};
+
+/**
+ * @class ObjectPositionsMessage
+ * @brief Carries a batch of input object positions from a client to Mema for server-side panning.
+ *
+ * @details Instead of evaluating the panning law locally and sending the resulting crosspoint
+ * gains of every affected input/output pair, a client sends only the positions of the inputs
+ * that moved.  Mema pans the whole batch with the layout received via `PanningLayoutMessage`
+ * and applies the resulting crosspoints in one go, so all objects of a batch take effect in the
+ * same audio block.
+ *
+ * **Wire payload:** uint16 positionCount + (uint16 input + int32 layer + float x + float y + float sharpness) × positionCount.
+ */
+class ObjectPositionsMessage : public SerializableMessage
+{
+public:
+    ObjectPositionsMessage() = default;
+    ObjectPositionsMessage(const std::vector<InputPositionPanner::InputPosition>& inputPositions)
+    {
+        m_type = SerializableMessageType::ObjectPositions;
+        m_inputPositions = inputPositions;
+    }
+
+    ObjectPositionsMessage(const juce::MemoryBlock& blob)
+    {
+        jassert(SerializableMessageType::ObjectPositions == static_cast<SerializableMessageType>(blob[0]));
+
+        m_type = SerializableMessageType::ObjectPositions;
+
+        auto readPos = int(sizeof(SerializableMessageType));
+
+        std::uint16_t positionCount;
+        blob.copyTo(&positionCount, readPos, sizeof(std::uint16_t));
+        readPos += sizeof(std::uint16_t);
+        m_inputPositions.resize(positionCount);
+        for (auto& inputPosition : m_inputPositions)
+        {
+            blob.copyTo(&inputPosition.input, readPos, sizeof(std::uint16_t));
+            readPos += sizeof(std::uint16_t);
+            std::int32_t layer;
+            blob.copyTo(&layer, readPos, sizeof(std::int32_t));
+            readPos += sizeof(std::int32_t);
+            inputPosition.layer = int(layer);
+            float x, y;
+            blob.copyTo(&x, readPos, sizeof(float));
+            readPos += sizeof(float);
+            blob.copyTo(&y, readPos, sizeof(float));
+            readPos += sizeof(float);
+            inputPosition.position = { x, y };
+            blob.copyTo(&inputPosition.sharpness, readPos, sizeof(float));
+            readPos += sizeof(float);
+        }
+    }
+
+    ~ObjectPositionsMessage() = default;
+
+    /** @brief Returns the input positions carried by this batch. */
+    const std::vector<InputPositionPanner::InputPosition>& getInputPositions() const { return m_inputPositions; }
+
+protected:
+    juce::MemoryBlock createSerializedContent(size_t& contentSize) const override
+    {
+        juce::MemoryBlock blob;
+        auto positionCount = std::uint16_t(m_inputPositions.size());
+        blob.append(&positionCount, sizeof(std::uint16_t));
+        for (auto const& inputPosition : m_inputPositions)
+        {
+            auto layer = std::int32_t(inputPosition.layer);
+            auto x = inputPosition.position.getX();
+            auto y = inputPosition.position.getY();
+            blob.append(&inputPosition.input, sizeof(std::uint16_t));
+            blob.append(&layer, sizeof(std::int32_t));
+            blob.append(&x, sizeof(float));
+            blob.append(&y, sizeof(float));
+            blob.append(&inputPosition.sharpness, sizeof(float));
+        }
+        contentSize = blob.getSize();
+        return blob;
+    }
+
+private:
+    std::vector<InputPositionPanner::InputPosition> m_inputPositions; ///< Latest position per moved input.
+};
+
+
+/**
+ * @class SceneListMessage
+ * @brief Carries the ids and names of the scenes stored in Mema.
+ *
+ * @details Sent by `MemaProcessor` to every client on connect and to all clients whenever a scene
+ * was stored or removed, so a remote can offer the scenes for recall.  Scene contents are never
+ * sent, a recall only transfers the resulting `ControlParametersMessage`.
+ *
+ * **Wire payload:** uint16 sceneCount + (uint16 id + uint16 nameLength + UTF-8 name) × sceneCount.
+ */
+class SceneListMessage : public SerializableMessage
+{
+public:
+    SceneListMessage() = default;
+    SceneListMessage(const std::vector<std::pair<std::uint16_t, juce::String>>& sceneList)
+    {
+        m_type = SerializableMessageType::SceneList;
+        m_sceneList = sceneList;
+    }
+
+    SceneListMessage(const juce::MemoryBlock& blob)
+    {
+        jassert(SerializableMessageType::SceneList == static_cast<SerializableMessageType>(blob[0]));
+
+        m_type = SerializableMessageType::SceneList;
+
+        auto readPos = int(sizeof(SerializableMessageType));
+
+        std::uint16_t sceneCount;
+        blob.copyTo(&sceneCount, readPos, sizeof(std::uint16_t));
+        readPos += sizeof(std::uint16_t);
+        m_sceneList.resize(sceneCount);
+        for (auto& scene : m_sceneList)
+        {
+            blob.copyTo(&scene.first, readPos, sizeof(std::uint16_t));
+            readPos += sizeof(std::uint16_t);
+            std::uint16_t nameLength;
+            blob.copyTo(&nameLength, readPos, sizeof(std::uint16_t));
+            readPos += sizeof(std::uint16_t);
+            scene.second = juce::String(juce::CharPointer_UTF8(static_cast<const char*>(blob.begin()) + readPos), nameLength);
+            readPos += nameLength;
+        }
+    }
+
+    ~SceneListMessage() = default;
+
+    /** @brief Returns id and name of the stored scenes, ordered by id. */
+    const std::vector<std::pair<std::uint16_t, juce::String>>& getSceneList() const { return m_sceneList; }
+
+protected:
+    juce::MemoryBlock createSerializedContent(size_t& contentSize) const override
+    {
+        juce::MemoryBlock blob;
+        auto sceneCount = std::uint16_t(m_sceneList.size());
+        blob.append(&sceneCount, sizeof(std::uint16_t));
+        for (auto const& scene : m_sceneList)
+        {
+            blob.append(&scene.first, sizeof(std::uint16_t));
+            auto nameUtf8 = scene.second.toUTF8();
+            std::uint16_t nameLength = std::uint16_t(strlen(nameUtf8));
+            blob.append(&nameLength, sizeof(std::uint16_t));
+            blob.append(nameUtf8, nameLength);
+        }
+        contentSize = blob.getSize();
+        return blob;
+    }
+
+private:
+    std::vector<std::pair<std::uint16_t, juce::String>> m_sceneList; ///< Id and name per stored scene.
+};
+
+
+/**
+ * @class SceneRecallMessage
+ * @brief Requests Mema to recall a stored scene.
+ *
+ * @details Sent by Mema.Re.  A crossfade time of 0 switches the matrix within one audio block,
+ * otherwise crosspoint gains are ramped from the current to the scene values over the given time.
+ *
+ * **Wire payload:** uint16 sceneId + uint32 crossfadeMs.
+ */
+class SceneRecallMessage : public SerializableMessage
+{
+public:
+    SceneRecallMessage() = default;
+    SceneRecallMessage(std::uint16_t sceneId, std::uint32_t crossfadeMs)
+    {
+        m_type = SerializableMessageType::SceneRecall;
+        m_sceneId = sceneId;
+        m_crossfadeMs = crossfadeMs;
+    }
+
+    SceneRecallMessage(const juce::MemoryBlock& blob)
+    {
+        jassert(SerializableMessageType::SceneRecall == static_cast<SerializableMessageType>(blob[0]));
+
+        m_type = SerializableMessageType::SceneRecall;
+
+        auto readPos = int(sizeof(SerializableMessageType));
+
+        blob.copyTo(&m_sceneId, readPos, sizeof(std::uint16_t));
+        readPos += sizeof(std::uint16_t);
+        blob.copyTo(&m_crossfadeMs, readPos, sizeof(std::uint32_t));
+        readPos += sizeof(std::uint32_t);
+    }
+
+    ~SceneRecallMessage() = default;
+
+    /** @brief Returns the id of the scene to recall. */
+    std::uint16_t getSceneId() const { return m_sceneId; }
+    /** @brief Returns the crossfade time in milliseconds, 0 for an instant switch. */
+    std::uint32_t getCrossfadeMs() const { return m_crossfadeMs; }
+
+protected:
+    juce::MemoryBlock createSerializedContent(size_t& contentSize) const override
+    {
+        juce::MemoryBlock blob;
+        blob.append(&m_sceneId, sizeof(std::uint16_t));
+        blob.append(&m_crossfadeMs, sizeof(std::uint32_t));
+        contentSize = blob.getSize();
+        return blob;
+    }
+
+private:
+    std::uint16_t m_sceneId = 0; ///< Id of the scene to recall.
+    std::uint32_t m_crossfadeMs = 0; ///< Crossfade time in milliseconds.
+};
+
+
+/**
+ * @class SceneStoreMessage
+ * @brief Requests Mema to store its current mutes, crosspoints and plug-in parameter values as scene.
+ *
+ * @details Sent by Mema.Re.  Mema answers all clients with an updated `SceneListMessage`.
+ *
+ * **Wire payload:** int32 sceneId (< 1 for the next free id) + uint16 nameLength + UTF-8 name.
+ */
+class SceneStoreMessage : public SerializableMessage
+{
+public:
+    SceneStoreMessage() = default;
+    SceneStoreMessage(int sceneId, const juce::String& sceneName)
+    {
+        m_type = SerializableMessageType::SceneStore;
+        m_sceneId = std::int32_t(sceneId);
+        m_sceneName = sceneName;
+    }
+
+    SceneStoreMessage(const juce::MemoryBlock& blob)
+    {
+        jassert(SerializableMessageType::SceneStore == static_cast<SerializableMessageType>(blob[0]));
+
+        m_type = SerializableMessageType::SceneStore;
+
+        auto readPos = int(sizeof(SerializableMessageType));
+
+        blob.copyTo(&m_sceneId, readPos, sizeof(std::int32_t));
+        readPos += sizeof(std::int32_t);
+        std::uint16_t nameLength;
+        blob.copyTo(&nameLength, readPos, sizeof(std::uint16_t));
+        readPos += sizeof(std::uint16_t);
+        m_sceneName = juce::String(juce::CharPointer_UTF8(static_cast<const char*>(blob.begin()) + readPos), nameLength);
+        readPos += nameLength;
+    }
+
+    ~SceneStoreMessage() = default;
+
+    /** @brief Returns the id to store the scene under, < 1 for the next free id. */
+    int getSceneId() const { return int(m_sceneId); }
+    /** @brief Returns the scene name, empty for a generated one. */
+    const juce::String& getSceneName() const { return m_sceneName; }
+
+protected:
+    juce::MemoryBlock createSerializedContent(size_t& contentSize) const override
+    {
+        juce::MemoryBlock blob;
+        blob.append(&m_sceneId, sizeof(std::int32_t));
+        auto nameUtf8 = m_sceneName.toUTF8();
+        std::uint16_t nameLength = std::uint16_t(strlen(nameUtf8));
+        blob.append(&nameLength, sizeof(std::uint16_t));
+        blob.append(nameUtf8, nameLength);
+        contentSize = blob.getSize();
+        return blob;
+    }
+
+private:
+    std::int32_t m_sceneId = -1; ///< Id to store the scene under.
+    juce::String m_sceneName; ///< Scene name.
+};
+
+
+/**
+ * @class AudioCallbackProfileMessage
+ * @brief Carries the audio callback timings of Mema, see `AudioCallbackProfiler`.
+ *
+ * @details Sent by `MemaProcessor` once per second to the clients that subscribed to it (or did
+ * not restrict their traffic types at all).  The values are totals since the last reset, a client
+ * derives the values of an interval from two consecutive messages via
+ * `AudioCallbackProfiler::Snapshot::getDifference`.
+ *
+ * **Wire payload:** uint64 callbackCount + uint64 deadlineMissCount + uint64 xrunCount +
+ * float64 deadlineUs + float64 callbackUs + float64 maxCallbackUs + uint16 stageCount +
+ * float64 stageUs × stageCount + uint16 binCount + uint64 binCallbackCount × binCount.
+ */
+class AudioCallbackProfileMessage : public SerializableMessage
+{
+public:
+    AudioCallbackProfileMessage() = default;
+    AudioCallbackProfileMessage(const AudioCallbackProfiler::Snapshot& profile)
+    {
+        m_type = SerializableMessageType::AudioCallbackProfile;
+        m_profile = profile;
+    }
+
+    AudioCallbackProfileMessage(const juce::MemoryBlock& blob)
+    {
+        jassert(SerializableMessageType::AudioCallbackProfile == static_cast<SerializableMessageType>(blob[0]));
+
+        m_type = SerializableMessageType::AudioCallbackProfile;
+
+        auto readPos = int(sizeof(SerializableMessageType));
+
+        blob.copyTo(&m_profile.callbackCount, readPos, sizeof(std::uint64_t));
+        readPos += sizeof(std::uint64_t);
+        blob.copyTo(&m_profile.deadlineMissCount, readPos, sizeof(std::uint64_t));
+        readPos += sizeof(std::uint64_t);
+        blob.copyTo(&m_profile.xrunCount, readPos, sizeof(std::uint64_t));
+        readPos += sizeof(std::uint64_t);
+        blob.copyTo(&m_profile.deadlineUs, readPos, sizeof(double));
+        readPos += sizeof(double);
+        blob.copyTo(&m_profile.callbackUs, readPos, sizeof(double));
+        readPos += sizeof(double);
+        blob.copyTo(&m_profile.maxCallbackUs, readPos, sizeof(double));
+        readPos += sizeof(double);
+
+        // counts are transmitted to stay readable if stages or bins are added later on
+        std::uint16_t stageCount;
+        blob.copyTo(&stageCount, readPos, sizeof(std::uint16_t));
+        readPos += sizeof(std::uint16_t);
+        for (auto i = 0; i < int(stageCount); i++)
+        {
+            if (i < AudioCallbackProfiler::StageCount)
+                blob.copyTo(&m_profile.stageUs[size_t(i)], readPos, sizeof(double));
+            readPos += sizeof(double);
+        }
+        std::uint16_t binCount;
+        blob.copyTo(&binCount, readPos, sizeof(std::uint16_t));
+        readPos += sizeof(std::uint16_t);
+        for (auto i = 0; i < int(binCount); i++)
+        {
+            if (i < AudioCallbackProfiler::s_histogramBinCount)
+                blob.copyTo(&m_profile.histogram[size_t(i)], readPos, sizeof(std::uint64_t));
+            readPos += sizeof(std::uint64_t);
+        }
+    }
+
+    ~AudioCallbackProfileMessage() = default;
+
+    /** @brief Returns the transmitted audio callback timings. */
+    const AudioCallbackProfiler::Snapshot& getProfile() const { return m_profile; }
+
+protected:
+    juce::MemoryBlock createSerializedContent(size_t& contentSize) const override
+    {
+        juce::MemoryBlock blob;
+        blob.append(&m_profile.callbackCount, sizeof(std::uint64_t));
+        blob.append(&m_profile.deadlineMissCount, sizeof(std::uint64_t));
+        blob.append(&m_profile.xrunCount, sizeof(std::uint64_t));
+        blob.append(&m_profile.deadlineUs, sizeof(double));
+        blob.append(&m_profile.callbackUs, sizeof(double));
+        blob.append(&m_profile.maxCallbackUs, sizeof(double));
+        auto stageCount = std::uint16_t(AudioCallbackProfiler::StageCount);
+        blob.append(&stageCount, sizeof(std::uint16_t));
+        blob.append(m_profile.stageUs.data(), sizeof(double) * stageCount);
+        auto binCount = std::uint16_t(AudioCallbackProfiler::s_histogramBinCount);
+        blob.append(&binCount, sizeof(std::uint16_t));
+        blob.append(m_profile.histogram.data(), sizeof(std::uint64_t) * binCount);
+        contentSize = blob.getSize();
+        return blob;
+    }
+
+private:
+    AudioCallbackProfiler::Snapshot m_profile; ///< Audio callback timings since the last reset.
+};
+
 
 #ifdef NIX // DEBUG
 #define RUN_MESSAGE_TESTS
@@ -1316,6 +2055,10 @@ static void runTests()
     auto epmcpy = EnvironmentParametersMessage(epmb);
     auto test9 = epmcpy.getPaletteStyle();
     jassert(test9 == paletteStyle);
+    jassert(epmcpy.hasCapability(EnvironmentParametersMessage::ServerSidePanning));
+    auto epmbLegacy = juce::MemoryBlock(epmb.getData(), epmb.getSize() - sizeof(std::uint32_t));
+    auto epmLegacy = EnvironmentParametersMessage(epmbLegacy);
+    jassert(epmLegacy.getPaletteStyle() == paletteStyle && !epmLegacy.hasCapability(EnvironmentParametersMessage::ServerSidePanning));
 
     // test DataTrafficTypeSelectionMessage
     auto trafficTypes = std::vector<SerializableMessage::SerializableMessageType>({ SerializableMessage::ControlParameters, SerializableMessage::AnalyzerParameters });
@@ -1349,6 +2092,86 @@ static void runTests()
     jassert(test12 == outputMuteStates);
     jassert(test13 == crosspointStates);
     jassert(test14 == crosspointValues);
+
+    // test PluginParameterValuesMessage
+    auto parameterValues = std::vector<std::pair<std::uint16_t, float>>{ { std::uint16_t(0), 0.25f }, { std::uint16_t(7), 1.0f } };
+    auto ppvsm = std::make_unique<PluginParameterValuesMessage>(parameterValues);
+    auto ppvsmb = ppvsm->getSerializedMessage();
+    auto ppvsmcpy = PluginParameterValuesMessage(ppvsmb);
+    auto test15 = ppvsmcpy.getParameterValues();
+    jassert(test15 == parameterValues);
+
+    // test PluginParameterSubscriptionMessage
+    auto parameterIndices = std::vector<std::uint16_t>{ 1, 3, 5 };
+    auto ppsm = std::make_unique<PluginParameterSubscriptionMessage>(parameterIndices);
+    auto ppsmb = ppsm->getSerializedMessage();
+    auto ppsmcpy = PluginParameterSubscriptionMessage(ppsmb);
+    auto test16 = ppsmcpy.getParameterIndices();
+    jassert(test16 == parameterIndices);
+
+    // test PanningLayoutMessage
+    auto layerLayouts = std::map<int, InputPositionPanner::LayerLayout>();
+    layerLayouts[0].pannedOutputs = { { 1, -30.0f }, { 2, 30.0f } };
+    layerLayouts[0].silencedOutputs = { 3 };
+    layerLayouts[1].pannedOutputs = { { 3, 0.0f } };
+    auto plm = std::make_unique<PanningLayoutMessage>(layerLayouts);
+    auto plmb = plm->getSerializedMessage();
+    auto plmcpy = PanningLayoutMessage(plmb);
+    auto test17 = plmcpy.getLayerLayouts();
+    jassert(test17.size() == layerLayouts.size());
+    jassert(test17[0].pannedOutputs.size() == 2 && test17[0].pannedOutputs[1].output == 2 && test17[0].pannedOutputs[1].angle == 30.0f);
+    jassert(test17[0].silencedOutputs == layerLayouts[0].silencedOutputs);
+
+    // test ObjectPositionsMessage
+    auto inputPositions = std::vector<InputPositionPanner::InputPosition>{ { std::uint16_t(1), 0, { 0.5f, -0.25f }, 0.3f }, { std::uint16_t(4), 1, { 0.0f, 0.0f }, 1.0f } };
+    auto opm = std::make_unique<ObjectPositionsMessage>(inputPositions);
+    auto opmb = opm->getSerializedMessage();
+    auto opmcpy = ObjectPositionsMessage(opmb);
+    auto test18 = opmcpy.getInputPositions();
+    jassert(test18.size() == inputPositions.size());
+    jassert(test18[0].input == 1 && test18[0].layer == 0 && test18[0].position == inputPositions[0].position && test18[0].sharpness == 0.3f);
+    jassert(test18[1].input == 4 && test18[1].layer == 1);
+
+    // test SceneListMessage
+    auto sceneList = std::vector<std::pair<std::uint16_t, juce::String>>{ { std::uint16_t(1), "Intro" }, { std::uint16_t(7), juce::String::fromUTF8("B\xc3\xbchne") } };
+    auto slm = std::make_unique<SceneListMessage>(sceneList);
+    auto slmb = slm->getSerializedMessage();
+    auto slmcpy = SceneListMessage(slmb);
+    auto test19 = slmcpy.getSceneList();
+    jassert(test19 == sceneList);
+
+    // test SceneRecallMessage
+    auto srm = std::make_unique<SceneRecallMessage>(std::uint16_t(7), std::uint32_t(1500));
+    auto srmb = srm->getSerializedMessage();
+    auto srmcpy = SceneRecallMessage(srmb);
+    auto test20 = srmcpy.getSceneId();
+    auto test21 = srmcpy.getCrossfadeMs();
+    jassert(test20 == 7);
+    jassert(test21 == 1500);
+
+    // test SceneStoreMessage
+    auto ssm = std::make_unique<SceneStoreMessage>(-1, "Outro");
+    auto ssmb = ssm->getSerializedMessage();
+    auto ssmcpy = SceneStoreMessage(ssmb);
+    auto test22 = ssmcpy.getSceneId();
+    auto test23 = ssmcpy.getSceneName();
+    jassert(test22 == -1);
+    jassert(test23 == "Outro");
+
+    // test AudioCallbackProfileMessage
+    auto profile = AudioCallbackProfiler::Snapshot();
+    profile.callbackCount = 1000;
+    profile.xrunCount = 2;
+    profile.deadlineUs = 5333.3;
+    profile.stageUs[AudioCallbackProfiler::Matrix] = 1234.5;
+    profile.histogram[AudioCallbackProfiler::s_histogramBinCount - 1] = 3;
+    auto acpm = std::make_unique<AudioCallbackProfileMessage>(profile);
+    auto acpmb = acpm->getSerializedMessage();
+    auto acpmcpy = AudioCallbackProfileMessage(acpmb);
+    auto test24 = acpmcpy.getProfile();
+    jassert(test24.callbackCount == 1000 && test24.xrunCount == 2 && test24.deadlineUs == 5333.3);
+    jassert(test24.stageUs[AudioCallbackProfiler::Matrix] == 1234.5);
+    jassert(test24.histogram[AudioCallbackProfiler::s_histogramBinCount - 1] == 3);
 }
 #endif
 
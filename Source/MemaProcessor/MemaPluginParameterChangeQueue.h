@@ -0,0 +1,102 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace Mema
+{
+
+/**
+ * @class PluginParameterChangeQueue
+ * @brief Lock-free single-producer/single-consumer queue of plugin parameter changes.
+ *
+ * @details The message thread (producer) pushes remote or UI originated parameter changes,
+ * the audio thread (consumer) drains them at the start of every block and applies them to the
+ * hosted plugin at their sample offset within that block.  Backed by a fixed size
+ * `juce::AbstractFifo`, so neither side allocates or blocks.
+ */
+class PluginParameterChangeQueue
+{
+public:
+    /** @brief A single queued parameter change. */
+    struct Change
+    {
+        int     index = -1;         ///< Zero-based plugin parameter index.
+        float   value = 0.0f;       ///< Normalised target value in [0, 1].
+        int     sampleOffset = 0;   ///< Sample position within the next processed block where the value shall become active.
+    };
+
+public:
+    explicit PluginParameterChangeQueue(int capacity = 1024) : m_fifo(capacity), m_changes(size_t(capacity)) {};
+    ~PluginParameterChangeQueue() = default;
+
+    /**
+     * @brief Enqueues a parameter change. Producer side only.
+     * @return `false` if the queue is full and the change was dropped.
+     */
+    bool push(int index, float value, int sampleOffset = 0)
+    {
+        auto scope = m_fifo.write(1);
+        if (scope.blockSize1 > 0)
+            m_changes[size_t(scope.startIndex1)] = { index, value, sampleOffset };
+        else if (scope.blockSize2 > 0)
+            m_changes[size_t(scope.startIndex2)] = { index, value, sampleOffset };
+        else
+            return false;
+
+        return true;
+    };
+
+    /**
+     * @brief Moves all pending changes into @p target, appending in arrival order. Consumer side only.
+     * @details @p target is expected to have reserved `getCapacity()` elements upfront, so that
+     *          this does not allocate on the audio thread.
+     * @return The number of changes that were appended.
+     */
+    int popAll(std::vector<Change>& target)
+    {
+        auto numReady = m_fifo.getNumReady();
+        if (numReady <= 0)
+            return 0;
+
+        jassert(target.capacity() >= target.size() + size_t(numReady));
+        auto scope = m_fifo.read(numReady);
+        for (auto i = 0; i < scope.blockSize1; i++)
+            target.push_back(m_changes[size_t(scope.startIndex1 + i)]);
+        for (auto i = 0; i < scope.blockSize2; i++)
+            target.push_back(m_changes[size_t(scope.startIndex2 + i)]);
+
+        return scope.blockSize1 + scope.blockSize2;
+    };
+
+    /** @brief Discards all pending changes. Must only be called while neither producer nor consumer are active. */
+    void reset() { m_fifo.reset(); };
+
+    /** @brief Returns the maximum number of changes that can be pending at once. */
+    int getCapacity() const { return m_fifo.getTotalSize() - 1; };
+
+private:
+    juce::AbstractFifo  m_fifo;     ///< Lock-free read/write index bookkeeping.
+    std::vector<Change> m_changes;  ///< Fixed size ring storage indexed by m_fifo.
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PluginParameterChangeQueue)
+};
+
+} // namespace Mema
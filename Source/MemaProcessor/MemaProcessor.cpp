@@ -18,7 +18,6 @@
 
 #include "MemaProcessor.h"
 
-#include "InterprocessConnection.h"
 #include "MemaCommanders.h"
 #include "MemaServiceData.h"
 #include "../MemaAppConfiguration.h"
@@ -35,74 +34,59 @@ class MemaNetworkClientCommanderWrapper : public MemaInputCommander, public Mema
 public:
 	void setInputMute(std::uint16_t channel, bool muteState, int userId) override
 	{
-		if (m_networkServer && m_networkServer->hasActiveConnections())
-		{
-			std::map<std::uint16_t, bool> inputMuteStates;
-			std::map<std::uint16_t, bool> outputMuteStates;
-			std::map<std::uint16_t, std::map<std::uint16_t, bool>> crosspointStates;
-			std::map<std::uint16_t, std::map<std::uint16_t, float>> crosspointValues;
-
-			inputMuteStates[channel] = muteState;
-
-			auto sendIds = m_networkServer->getActiveConnectionIds();
-			sendIds.erase(std::remove(sendIds.begin(), sendIds.end(), userId), sendIds.end());
-			m_networkServer->enqueueMessage(std::make_unique<ControlParametersMessage>(inputMuteStates, outputMuteStates, crosspointStates, crosspointValues)->getSerializedMessage(), sendIds);
-		}
+		sendControlParameters({ { channel, muteState } }, {}, {}, {}, userId);
 	};
 
 	void setOutputMute(std::uint16_t channel, bool muteState, int userId) override
 	{
-		if (m_networkServer && m_networkServer->hasActiveConnections())
-		{
-			std::map<std::uint16_t, bool> inputMuteStates;
-			std::map<std::uint16_t, bool> outputMuteStates;
-			std::map<std::uint16_t, std::map<std::uint16_t, bool>> crosspointStates;
-			std::map<std::uint16_t, std::map<std::uint16_t, float>> crosspointValues;
-
-			outputMuteStates[channel] = muteState;
-
-			auto sendIds = m_networkServer->getActiveConnectionIds();
-			sendIds.erase(std::remove(sendIds.begin(), sendIds.end(), userId), sendIds.end());
-			m_networkServer->enqueueMessage(std::make_unique<ControlParametersMessage>(inputMuteStates, outputMuteStates, crosspointStates, crosspointValues)->getSerializedMessage(), sendIds);
-		}
+		sendControlParameters({}, { { channel, muteState } }, {}, {}, userId);
 	};
 
 	void setCrosspointEnabledValue(std::uint16_t input, std::uint16_t output, bool enabledState, int userId) override
 	{
-		if (m_networkServer && m_networkServer->hasActiveConnections())
-		{
-			std::map<std::uint16_t, bool> inputMuteStates;
-			std::map<std::uint16_t, bool> outputMuteStates;
-			std::map<std::uint16_t, std::map<std::uint16_t, bool>> crosspointStates;
-			std::map<std::uint16_t, std::map<std::uint16_t, float>> crosspointValues;
-
-			crosspointStates[input][output] = enabledState;
-
-			auto sendIds = m_networkServer->getActiveConnectionIds();
-			sendIds.erase(std::remove(sendIds.begin(), sendIds.end(), userId), sendIds.end());
-			m_networkServer->enqueueMessage(std::make_unique<ControlParametersMessage>(inputMuteStates, outputMuteStates, crosspointStates, crosspointValues)->getSerializedMessage(), sendIds);
-		}
+		sendControlParameters({}, {}, { { input, { { output, enabledState } } } }, {}, userId);
 	};
 
 	void setCrosspointFactorValue(std::uint16_t input, std::uint16_t output, float factor, int userId) override
 	{
-		if (m_networkServer && m_networkServer->hasActiveConnections())
-		{
-			std::map<std::uint16_t, bool> inputMuteStates;
-			std::map<std::uint16_t, bool> outputMuteStates;
-			std::map<std::uint16_t, std::map<std::uint16_t, bool>> crosspointStates;
-			std::map<std::uint16_t, std::map<std::uint16_t, float>> crosspointValues;
+		sendControlParameters({}, {}, {}, { { input, { { output, factor } } } }, userId);
+	};
 
-			crosspointValues[input][output] = factor;
+	void setInputMutes(const std::map<std::uint16_t, bool>& muteStates, int userId) override
+	{
+		if (!muteStates.empty())
+			sendControlParameters(muteStates, {}, {}, {}, userId);
+	};
 
-			auto sendIds = m_networkServer->getActiveConnectionIds();
-			sendIds.erase(std::remove(sendIds.begin(), sendIds.end(), userId), sendIds.end());
-			m_networkServer->enqueueMessage(std::make_unique<ControlParametersMessage>(inputMuteStates, outputMuteStates, crosspointStates, crosspointValues)->getSerializedMessage(), sendIds);
-		}
+	void setOutputMutes(const std::map<std::uint16_t, bool>& muteStates, int userId) override
+	{
+		if (!muteStates.empty())
+			sendControlParameters({}, muteStates, {}, {}, userId);
+	};
+
+	void setCrosspointValues(const std::map<std::uint16_t, std::map<std::uint16_t, bool>>& enabledStates, const std::map<std::uint16_t, std::map<std::uint16_t, float>>& factors, int userId) override
+	{
+		if (!enabledStates.empty() || !factors.empty())
+			sendControlParameters({}, {}, enabledStates, factors, userId);
 	};
 
 	void setPluginParameterInfos(const std::vector<PluginParameterInfo>& parameterInfos, const std::string& name, bool enabled, bool post, int userId = -1) override
 	{
+		// (re)size the coalescing slots to the new parameter set - pending values of a previous plugin are meaningless from here on
+		{
+			const ScopedLock sl(m_pluginParameterValuesLock);
+			auto parameterCount = size_t(0);
+			for (auto const& parameterInfo : parameterInfos)
+				parameterCount = std::max(parameterCount, size_t(parameterInfo.index + 1));
+
+			m_pluginParameterValues.assign(parameterCount, PendingPluginParameterValue());
+			for (auto const& parameterInfo : parameterInfos)
+				if (parameterInfo.index >= 0)
+					m_pluginParameterValues[size_t(parameterInfo.index)].id = parameterInfo.id.toStdString();
+			m_dirtyPluginParameterIndices.clear();
+			m_dirtyPluginParameterIndices.reserve(parameterCount);
+		}
+
 		if (m_networkServer && m_networkServer->hasActiveConnections())
 		{
 			auto sendIds = m_networkServer->getActiveConnectionIds();
@@ -123,15 +107,38 @@ public:
 
 	void setPluginParameterValue(std::uint16_t index, std::string id, float currentValue, int userId = -1) override
 	{
-		if (m_networkServer && m_networkServer->hasActiveConnections())
+		ignoreUnused(id);
+
+		// may be called from any thread (plugins report changes from the audio thread) - only record the
+		// latest value per index here, flushPluginParameterValues sends the coalesced result on the next tick
+		const ScopedLock sl(m_pluginParameterValuesLock);
+		if (index >= m_pluginParameterValues.size())
+			return;
+
+		auto& pending = m_pluginParameterValues[index];
+		pending.value = currentValue;
+		pending.userId = userId;
+		if (!pending.dirty)
 		{
-			DBG(juce::String(__FUNCTION__) << " sending to net: " << int(index) << " > " << currentValue);
-			auto sendIds = m_networkServer->getActiveConnectionIds();
-			sendIds.erase(std::remove(sendIds.begin(), sendIds.end(), userId), sendIds.end());
-			m_networkServer->enqueueMessage(std::make_unique<PluginParameterValueMessage>(index, id, currentValue)->getSerializedMessage(), sendIds);
+			pending.dirty = true;
+			m_dirtyPluginParameterIndices.push_back(index);
 		}
 	}
 
+	/** @brief Restricts the parameter value updates sent to @p connectionId to @p parameterIndices. */
+	void setPluginParameterSubscription(int connectionId, const std::vector<std::uint16_t>& parameterIndices)
+	{
+		const ScopedLock sl(m_pluginParameterValuesLock);
+		m_pluginParameterSubscriptions[connectionId] = std::set<std::uint16_t>(parameterIndices.begin(), parameterIndices.end());
+	}
+
+	/** @brief Drops the parameter selection of @p connectionId, reverting it to receive updates for all parameters. */
+	void clearPluginParameterSubscription(int connectionId)
+	{
+		const ScopedLock sl(m_pluginParameterValuesLock);
+		m_pluginParameterSubscriptions.erase(connectionId);
+	}
+
 	void setIOCount(std::uint16_t inputCount, std::uint16_t outputCount) override
 	{
 		if (m_networkServer && m_networkServer->hasActiveConnections())
@@ -145,22 +152,123 @@ public:
 		m_networkServer = networkServer;
 	}
 
+	/** @brief Provides the traffic types a connection subscribed to, used to pick between batched and individual parameter value messages. */
+	std::function<std::vector<SerializableMessage::SerializableMessageType>(int connectionId)> getTrafficTypesForConnectionId;
+
+	MemaNetworkClientCommanderWrapper()
+	{
+		m_pluginParameterValuesFlusher = std::make_unique<juce::TimedCallback>([=]() { flushPluginParameterValues(); });
+		m_pluginParameterValuesFlusher->startTimer(s_pluginParameterValuesFlushInterval);
+	}
+
+	~MemaNetworkClientCommanderWrapper()
+	{
+		m_pluginParameterValuesFlusher->stopTimer();
+	}
+
 private:
 	void setChannelCount(std::uint16_t channelCount) override { ignoreUnused(channelCount); };
 
+	void sendControlParameters(const std::map<std::uint16_t, bool>& inputMuteStates, const std::map<std::uint16_t, bool>& outputMuteStates,
+		const std::map<std::uint16_t, std::map<std::uint16_t, bool>>& crosspointStates, const std::map<std::uint16_t, std::map<std::uint16_t, float>>& crosspointValues, int userId)
+	{
+		if (m_networkServer && m_networkServer->hasActiveConnections())
+		{
+			auto sendIds = m_networkServer->getActiveConnectionIds();
+			sendIds.erase(std::remove(sendIds.begin(), sendIds.end(), userId), sendIds.end());
+			m_networkServer->enqueueMessage(std::make_unique<ControlParametersMessage>(inputMuteStates, outputMuteStates, crosspointStates, crosspointValues)->getSerializedMessage(), sendIds);
+		}
+	};
+
+	void flushPluginParameterValues()
+	{
+		m_flushedPluginParameterValues.clear();
+		std::map<int, std::set<std::uint16_t>> subscriptions;
+		{
+			const ScopedLock sl(m_pluginParameterValuesLock);
+			for (auto const& index : m_dirtyPluginParameterIndices)
+			{
+				auto& pending = m_pluginParameterValues[index];
+				m_flushedPluginParameterValues.push_back({ index, pending });
+				pending.dirty = false;
+			}
+			m_dirtyPluginParameterIndices.clear();
+
+			if (!m_flushedPluginParameterValues.empty())
+				subscriptions = m_pluginParameterSubscriptions;
+		}
+
+		if (m_flushedPluginParameterValues.empty() || !m_networkServer || !m_networkServer->hasActiveConnections())
+			return;
+
+		for (auto const& connectionId : m_networkServer->getActiveConnectionIds())
+		{
+			auto trafficTypes = getTrafficTypesForConnectionId ? getTrafficTypesForConnectionId(connectionId) : std::vector<SerializableMessage::SerializableMessageType>();
+			auto hasTrafficType = [&trafficTypes](SerializableMessage::SerializableMessageType type) { return trafficTypes.end() != std::find(trafficTypes.begin(), trafficTypes.end(), type); };
+			auto sendBatched = hasTrafficType(SerializableMessage::PluginParameterValues);
+			auto sendIndividual = !sendBatched && (trafficTypes.empty() || hasTrafficType(SerializableMessage::PluginParameterValue));
+			if (!sendBatched && !sendIndividual)
+				continue;
+
+			auto subscriptionIter = subscriptions.find(connectionId);
+			auto isSubscribed = [&](std::uint16_t index) { return subscriptions.end() == subscriptionIter || 0 != subscriptionIter->second.count(index); };
+
+			std::vector<std::pair<std::uint16_t, float>> parameterValues;
+			auto sendIds = std::vector<int>{ connectionId };
+			for (auto const& flushed : m_flushedPluginParameterValues)
+			{
+				// avoid echoing a value back to the client it originated from
+				if (flushed.second.userId == connectionId || !isSubscribed(flushed.first))
+					continue;
+
+				if (sendBatched)
+					parameterValues.push_back({ flushed.first, flushed.second.value });
+				else
+					m_networkServer->enqueueMessage(std::make_unique<PluginParameterValueMessage>(flushed.first, flushed.second.id, flushed.second.value)->getSerializedMessage(), sendIds);
+			}
+
+			if (!parameterValues.empty())
+				m_networkServer->enqueueMessage(std::make_unique<PluginParameterValuesMessage>(parameterValues)->getSerializedMessage(), sendIds);
+		}
+	}
+
 private:
+	/** @brief Coalescing slot holding the latest reported value of one plugin parameter. */
+	struct PendingPluginParameterValue
+	{
+		std::string id;			///< Stable parameter id, needed for clients that receive individual PluginParameterValueMessages.
+		float value = 0.0f;		///< Latest normalised value.
+		int userId = -1;		///< Connection the latest value originated from (-1 = local), used for echo-suppression.
+		bool dirty = false;		///< True while the value waits for the next flush.
+	};
+
 	std::shared_ptr<InterprocessConnectionServerImpl> m_networkServer;
 
+	juce::CriticalSection m_pluginParameterValuesLock;											///< Guards the coalescing slots, dirty list and subscriptions.
+	std::vector<PendingPluginParameterValue> m_pluginParameterValues;							///< Coalescing slots, indexed by plugin parameter index.
+	std::vector<std::uint16_t> m_dirtyPluginParameterIndices;									///< Indices changed since the last flush, in order of first change.
+	std::map<int, std::set<std::uint16_t>> m_pluginParameterSubscriptions;						///< Per-connection parameter selection; connections without entry receive all parameters.
+	std::vector<std::pair<std::uint16_t, PendingPluginParameterValue>> m_flushedPluginParameterValues;	///< Flush scratch list, reused across ticks.
+	std::unique_ptr<juce::TimedCallback> m_pluginParameterValuesFlusher;						///< Periodic callback sending the coalesced parameter values.
+
+	static constexpr int s_pluginParameterValuesFlushInterval = 40; ///< Flush tick interval in ms (25 Hz).
+
 };
 
 //==============================================================================
 MemaProcessor::MemaProcessor(XmlElement* stateXml) :
 	juce::AudioProcessor()
 {
+	m_startupStartMs = juce::Time::getMillisecondCounterHiRes();
+
 #ifdef RUN_MESSAGE_TESTS
 	runTests();
 #endif
 
+	m_stateSnapshotFile = ProcessorStateSnapshot::getDefaultFile();
+	m_stateJournalFile = ProcessorStateJournal::getDefaultFile();
+	m_configurationFileWriter = std::make_unique<AsyncFileWriter>();
+
 	// prepare max sized processing data buffer
 	m_processorChannels = new float* [s_maxChannelCount];
 	for (auto i = 0; i < s_maxChannelCount; i++)
@@ -172,6 +280,9 @@ MemaProcessor::MemaProcessor(XmlElement* stateXml) :
 		}
 	}
 
+	// the audio thread drains the plugin parameter change queue into this list - reserve upfront to not allocate there
+	m_pluginParameterChangesForBlock.reserve(size_t(2 * m_pluginParameterChangeQueue.getCapacity()));
+
 	m_inputDataAnalyzer = std::make_unique<ProcessorDataAnalyzer>();
 	m_inputDataAnalyzer->setUseProcessingTypes(true, false, false);
 	m_outputDataAnalyzer = std::make_unique<ProcessorDataAnalyzer>();
@@ -180,12 +291,9 @@ MemaProcessor::MemaProcessor(XmlElement* stateXml) :
 	m_deviceManager = std::make_unique<AudioDeviceManager>();
 	m_deviceManager->addAudioCallback(this);
     m_deviceManager->addChangeListener(this);
-	
-	if (!setStateXml(stateXml))
-	{
-        setStateXml(nullptr); // call without actual xml config causes default init
-		triggerConfigurationUpdate(false);
-	}
+
+	addDefaultFormatsToManager(m_pluginFormatManager);
+	logStartupPhase("processing buffers and plug-in formats set up");
 
 	// init the announcement of this app instance as discoverable service
 	m_serviceTopologyManager = std::make_unique<JUCEAppBasics::ServiceTopologyManager>(
@@ -204,9 +312,15 @@ MemaProcessor::MemaProcessor(XmlElement* stateXml) :
         {
 			connection->onConnectionLost = [=](int connectionId) { DBG(juce::String(__FUNCTION__) << " connection " << connectionId << " lost");
 				m_trafficTypesPerConnection.erase(connectionId);
+				m_objectPanners.erase(connectionId);
+				if (m_networkCommanderWrapper)
+					m_networkCommanderWrapper->clearPluginParameterSubscription(connectionId);
 			};
 			connection->onConnectionMade = [=](int connectionId ) { DBG(juce::String(__FUNCTION__) << " connection " << connectionId << " made");
 				m_trafficTypesPerConnection[connectionId].clear();
+				m_objectPanners.erase(connectionId);
+				if (m_networkCommanderWrapper)
+					m_networkCommanderWrapper->clearPluginParameterSubscription(connectionId);
 				if (m_networkServer && m_networkServer->hasActiveConnection(connectionId))
 				{
 					auto paletteStyle = JUCEAppBasics::CustomLookAndFeel::PaletteStyle::PS_Dark;
@@ -245,6 +359,7 @@ MemaProcessor::MemaProcessor(XmlElement* stateXml) :
 						}
 						success = success && m_networkServer->enqueueMessage(std::make_unique<PluginParameterInfosMessage>(m_pluginInstance ? m_pluginInstance->getName().toStdString() : "", m_pluginEnabled, m_pluginPost, orderedParams)->getSerializedMessage(), sendIds);
 					}
+					success = success && m_networkServer->enqueueMessage(std::make_unique<SceneListMessage>(m_sceneStore.getSceneList())->getSerializedMessage(), sendIds);
 					if (!success)
 						m_networkServer->cleanupDeadConnections();
 				}
@@ -262,33 +377,58 @@ MemaProcessor::MemaProcessor(XmlElement* stateXml) :
     };
 	m_networkCommanderWrapper = std::make_unique<MemaNetworkClientCommanderWrapper>();
 	m_networkCommanderWrapper->setNetworkConnection(m_networkServer);
+	m_networkCommanderWrapper->getTrafficTypesForConnectionId = [=](int connectionId) {
+		auto trafficTypesIter = m_trafficTypesPerConnection.find(connectionId);
+		if (m_trafficTypesPerConnection.end() != trafficTypesIter)
+			return trafficTypesIter->second;
+		return std::vector<SerializableMessage::SerializableMessageType>();
+	};
 	addInputCommander(static_cast<MemaInputCommander*>(m_networkCommanderWrapper.get()));
 	addOutputCommander(static_cast<MemaOutputCommander*>(m_networkCommanderWrapper.get()));
 	addCrosspointCommander(static_cast<MemaCrosspointCommander*>(m_networkCommanderWrapper.get()));
 	addPluginCommander(static_cast<MemaPluginCommander*>(m_networkCommanderWrapper.get()));
+	logStartupPhase("network server and service announcement up");
+
+	// the last known routing state is restored right away, audio device and plug-in follow asynchronously (see DeferredDeviceInitialisationMessage)
+	if (!setStateXml(stateXml))
+	{
+        setStateXml(nullptr); // call without actual xml config causes default init
+		triggerConfigurationUpdate(false);
+	}
+	logStartupPhase("last known state restored");
 
 	m_timedConfigurationDumper = std::make_unique<juce::TimedCallback>([=]() {
+		// routing changes are appended to the journal right away, the xml config follows at a lower rate
 		if (isTimedConfigurationDumpPending())
 		{
-			auto config = JUCEAppBasics::AppConfigurationBase::getInstance();
-			if (config != nullptr)
-				config->triggerConfigurationDump(false);
+			if (isStateJournalCompactionRequired())
+				writeStateSnapshot();
+			else
+				appendStateJournal();
+			m_xmlConfigurationDumpPending = true;
 			resetTimedConfigurationDumpPending();
 		}
+		if (m_xmlConfigurationDumpPending && juce::Time::getMillisecondCounter() - m_lastXmlConfigurationDumpMs >= s_xmlConfigurationDumpInterval)
+			dumpXmlConfiguration();
 	});
 	m_timedConfigurationDumper->startTimer(100);
+
+	m_audioCallbackProfileSender = std::make_unique<juce::TimedCallback>([=]() { sendAudioCallbackProfileToClients(); });
+	m_audioCallbackProfileSender->startTimer(s_audioCallbackProfileSendInterval);
 }
 
 MemaProcessor::~MemaProcessor()
 {
+	m_metricsEndpoint.reset();
+	m_audioCallbackProfileSender->stopTimer();
 	m_timedConfigurationDumper->stopTimer();
-	if (isTimedConfigurationDumpPending())
+	if (isTimedConfigurationDumpPending() || m_xmlConfigurationDumpPending)
 	{
-		auto config = JUCEAppBasics::AppConfigurationBase::getInstance();
-		if (config != nullptr)
-			config->triggerConfigurationDump(false);
+		writeStateSnapshot();
+		dumpXmlConfiguration();
 		resetTimedConfigurationDumpPending();
 	}
+	m_configurationFileWriter->flush();
 
 	m_networkServer->stop();
 
@@ -372,6 +512,9 @@ std::unique_ptr<juce::XmlElement> MemaProcessor::createStateXml()
 	crosspointGainsElm->addTextElement(cgainstatestr.joinIntoString(";"));
 	stateXml->addChildElement(crosspointGainsElm.release());
 
+	if (!m_sceneStore.isEmpty())
+		stateXml->addChildElement(m_sceneStore.createStateXml().release());
+
 	return stateXml;
 }
 
@@ -402,30 +545,22 @@ bool MemaProcessor::setStateXml(juce::XmlElement* stateXml)
 
         if (deviceConfigChanged)
         {
-            // Hacky bit of device manager initialization:
-            // We first intialize it to be able to get a valid device setup,
-            // then initialize with a dummy xml config to trigger the internal xml structure being reset
-            // and finally apply the original initialized device setup again to have the audio running correctly.
-            // If we did not do so, either the internal xml would not be present as long as the first configuration change was made
-            // and therefor no valid config file could be written by the application or the audio would not be running
-            // on first start and manual config would be required.
-            m_deviceManager->initialiseWithDefaultDevices(s_maxChannelCount, s_maxChannelCount);
-            auto audioDeviceSetup = m_deviceManager->getAudioDeviceSetup();
-            auto result = m_deviceManager->initialise(s_maxChannelCount, s_maxChannelCount, deviceSetupXml, true, {}, &audioDeviceSetup);
-            if (result.isNotEmpty())
+            if (m_deferredStartupPending)
             {
-                // The saved audio device is unavailable; the device manager has already fallen back
-                // to the system default via initialiseWithDefaultDevices above.  Warn the user but
-                // continue restoring plugin and routing state from the config — those are independent
-                // of which audio device is active and must not be discarded just because the
-                // preferred interface is currently unplugged.
-                juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::WarningIcon, juce::JUCEApplication::getInstance()->getApplicationName() + " device init failed", result);
+                // On startup the device is opened once the constructor has returned, routing state is restored for
+                // the channel counts it was saved with until then and clients can already connect.
+                postMessage(new DeferredDeviceInitialisationMessage(deviceSetupXml ? std::make_unique<juce::XmlElement>(*deviceSetupXml) : nullptr));
+                auto savedInputCount = 0;
+                if (auto inputMutesElm = stateXml->getChildByName(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::INPUTMUTES)))
+                    savedInputCount = juce::StringArray::fromTokens(inputMutesElm->getAllSubText(), ";", "").size();
+                auto savedOutputCount = 0;
+                if (auto outputMutesElm = stateXml->getChildByName(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::OUTPUTMUTES)))
+                    savedOutputCount = juce::StringArray::fromTokens(outputMutesElm->getAllSubText(), ";", "").size();
+                if (savedInputCount > 0 && savedOutputCount > 0)
+                    setChannelCounts(std::uint16_t(std::min(savedInputCount, s_maxChannelCount)), std::uint16_t(std::min(savedOutputCount, s_maxChannelCount)));
             }
-#if JUCE_IOS
-            if (audioDeviceSetup.bufferSize < 512)
-                audioDeviceSetup.bufferSize = 512; // temp. workaround for iOS where buffersizes <512 lead to no sample data being delivered?
-            m_deviceManager->setAudioDeviceSetup(audioDeviceSetup, true);
-#endif
+            else
+                initialiseAudioDevice(deviceSetupXml);
             m_lastAppliedDeviceConfigXml = devConfElm ? std::make_unique<juce::XmlElement>(*devConfElm) : nullptr;
         }
 	}
@@ -443,59 +578,19 @@ bool MemaProcessor::setStateXml(juce::XmlElement* stateXml)
 		{
 			auto pluginDescription = juce::PluginDescription();
 			pluginDescription.loadFromXml(*pluginDescriptionXml);
-			setPlugin(pluginDescription);
-			if (m_pluginInstance)
+			if (m_deferredStartupPending)
 			{
-				juce::MemoryOutputStream destDataStream;
-				juce::Base64::convertFromBase64(destDataStream, pluginDescriptionXml->getAllSubText());
-				m_pluginInstance->setStateInformation(destDataStream.getData(), int(destDataStream.getDataSize()));
+				// instantiated after the deferred device initialisation, a config reload until then only replaces what gets applied
+				if (!m_deferredPluginConfigXml)
+					postMessage(new DeferredPluginInstantiationMessage());
+				m_deferredPluginConfigXml = std::make_unique<juce::XmlElement>(*plgConfElm);
 			}
-		}
-
-		auto orderAttr = plgConfElm->getStringAttribute(MemaAppConfiguration::getAttributeName(MemaAppConfiguration::AttributeID::PARAMORDER));
-		if (orderAttr.isNotEmpty())
-		{
-			m_pluginParameterDisplayOrder.clear();
-			juce::StringArray orderStrs;
-			orderStrs.addTokens(orderAttr, ",", "");
-			for (auto const& s : orderStrs)
-				m_pluginParameterDisplayOrder.push_back(s.getIntValue());
-		}
-
-		for (auto* plgParamElm : plgConfElm->getChildWithTagNameIterator(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::PLUGINPARAM)))
-		{
-			if (nullptr != plgParamElm)
+			else
 			{
-				auto index = plgParamElm->getIntAttribute(MemaAppConfiguration::getAttributeName(MemaAppConfiguration::AttributeID::IDX));
-				auto paramString = plgParamElm->getAllSubText();
-				auto paramInfo = PluginParameterInfo::fromString(paramString);
-				paramInfo.isRemoteControllable = (plgParamElm->getIntAttribute(MemaAppConfiguration::getAttributeName(MemaAppConfiguration::AttributeID::CONTROLLABLE)) == 1);
-				jassert(paramInfo.index == index);
-				// update the pluginparameterinfo
-				auto iter = std::find_if(getPluginParameterInfos().begin(), getPluginParameterInfos().end(), [=](const auto& info) { return info.index == index; });
-				if (iter != getPluginParameterInfos().end())
-					iter->initializeFromString(paramString);
-				// set the parameter
-				auto* param = getPluginParameter(index);
-				if (param)
-				{
-					jassert(paramInfo.name == param->getName(100));
-					jassert(paramInfo.label == param->getLabel());
-					//jassert(paramInfo.defaultValue == param->getDefaultValue()); //float rounding issue prevents this from making sense
-					jassert(paramInfo.isAutomatable == param->isAutomatable());
-					jassert(paramInfo.category == param->getCategory());
-					if (auto* rangedParam = dynamic_cast<const juce::RangedAudioParameter*>(param))
-					{
-						auto range = rangedParam->getNormalisableRange();
-						jassert(paramInfo.minValue == range.start);
-						jassert(paramInfo.maxValue == range.end);
-						jassert(paramInfo.stepSize == range.interval);
-						jassert(paramInfo.isDiscrete == range.interval > 0.0f);
-					}
-
-					setPluginParameterRemoteControlInfos(paramInfo.index, paramInfo.isRemoteControllable, paramInfo.type, paramInfo.stepCount);
-					param->setValue(paramInfo.currentValue);
-				}
+				// a config reload with an unchanged plug-in must not re-instantiate it (audio dropouts, lost editor window)
+				if (!m_pluginInstance || !m_pluginInstance->getPluginDescription().isDuplicateOf(pluginDescription))
+					setPlugin(pluginDescription);
+				restorePluginConfig(*plgConfElm);
 			}
 		}
 	}
@@ -601,6 +696,15 @@ bool MemaProcessor::setStateXml(juce::XmlElement* stateXml)
 			}
 		}
 	}
+	// a routing snapshot (and journal) written after the xml config is the more recent state, xml is only the fallback then
+	auto snapshotState = ProcessorStateSnapshot::RoutingState();
+	if (readStateSnapshot(snapshotState))
+	{
+		inputMuteStates = snapshotState.inputMuteStates;
+		outputMuteStates = snapshotState.outputMuteStates;
+		matrixCrosspointStates = snapshotState.crosspointStates;
+		matrixCrosspointValues = snapshotState.crosspointValues;
+	}
 #ifdef DEBUG
 	// sanity check symmetry of crosspoint states
 	auto crosspointStateOutCount = size_t(0);
@@ -636,10 +740,72 @@ bool MemaProcessor::setStateXml(juce::XmlElement* stateXml)
 		m_matrixCrosspointStates = matrixCrosspointStates;
 		m_matrixCrosspointValues = matrixCrosspointValues;
 	}
+	// the state was replaced as a whole, the journal on disk does not lead to it anymore
+	m_stateJournalValid = false;
+	m_pendingStateJournalRecords.clear();
+
+	m_sceneStore.setStateXml(stateXml->getChildByName(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::SCENES)));
 
 	return true;
 }
 
+void MemaProcessor::restorePluginConfig(const juce::XmlElement& pluginConfigXml)
+{
+	auto pluginDescriptionXml = pluginConfigXml.getChildByName("PLUGIN");
+	if (m_pluginInstance && nullptr != pluginDescriptionXml)
+	{
+		juce::MemoryOutputStream destDataStream;
+		juce::Base64::convertFromBase64(destDataStream, pluginDescriptionXml->getAllSubText());
+		m_pluginInstance->setStateInformation(destDataStream.getData(), int(destDataStream.getDataSize()));
+	}
+
+	auto orderAttr = pluginConfigXml.getStringAttribute(MemaAppConfiguration::getAttributeName(MemaAppConfiguration::AttributeID::PARAMORDER));
+	if (orderAttr.isNotEmpty())
+	{
+		m_pluginParameterDisplayOrder.clear();
+		juce::StringArray orderStrs;
+		orderStrs.addTokens(orderAttr, ",", "");
+		for (auto const& s : orderStrs)
+			m_pluginParameterDisplayOrder.push_back(s.getIntValue());
+	}
+
+	for (auto* plgParamElm : pluginConfigXml.getChildWithTagNameIterator(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::PLUGINPARAM)))
+	{
+		if (nullptr != plgParamElm)
+		{
+			auto index = plgParamElm->getIntAttribute(MemaAppConfiguration::getAttributeName(MemaAppConfiguration::AttributeID::IDX));
+			auto paramString = plgParamElm->getAllSubText();
+			auto paramInfo = PluginParameterInfo::fromString(paramString);
+			paramInfo.isRemoteControllable = (plgParamElm->getIntAttribute(MemaAppConfiguration::getAttributeName(MemaAppConfiguration::AttributeID::CONTROLLABLE)) == 1);
+			jassert(paramInfo.index == index);
+			// update the pluginparameterinfo
+			if (auto info = getPluginParameterInfo(index))
+				info->initializeFromString(paramString);
+			// set the parameter
+			auto* param = getPluginParameter(index);
+			if (param)
+			{
+				jassert(paramInfo.name == param->getName(100));
+				jassert(paramInfo.label == param->getLabel());
+				//jassert(paramInfo.defaultValue == param->getDefaultValue()); //float rounding issue prevents this from making sense
+				jassert(paramInfo.isAutomatable == param->isAutomatable());
+				jassert(paramInfo.category == param->getCategory());
+				if (auto* rangedParam = dynamic_cast<const juce::RangedAudioParameter*>(param))
+				{
+					auto range = rangedParam->getNormalisableRange();
+					jassert(paramInfo.minValue == range.start);
+					jassert(paramInfo.maxValue == range.end);
+					jassert(paramInfo.stepSize == range.interval);
+					jassert(paramInfo.isDiscrete == range.interval > 0.0f);
+				}
+
+				setPluginParameterRemoteControlInfos(paramInfo.index, paramInfo.isRemoteControllable, paramInfo.type, paramInfo.stepCount);
+				param->setValue(paramInfo.currentValue);
+			}
+		}
+	}
+}
+
 void MemaProcessor::environmentChanged()
 {
 	auto paletteStyle = JUCEAppBasics::CustomLookAndFeel::PaletteStyle::PS_Dark;
@@ -697,9 +863,12 @@ void MemaProcessor::initializeInputCommander(MemaInputCommander* commander)
 {
 	if (nullptr != commander)
 	{
-        const ScopedLock sl(m_audioDeviceIOCallbackLock);
-        for (auto const& inputMuteStatesKV : m_inputMuteStates)
-            commander->setInputMute(inputMuteStatesKV.first, inputMuteStatesKV.second);
+        auto inputMuteStates = std::map<std::uint16_t, bool>();
+        {
+            const ScopedLock sl(m_audioDeviceIOCallbackLock);
+            inputMuteStates = m_inputMuteStates;
+        }
+        commander->setInputMutes(inputMuteStates);
 	}
 }
 
@@ -731,9 +900,12 @@ void MemaProcessor::initializeOutputCommander(MemaOutputCommander* commander)
 {
 	if (nullptr != commander)
 	{
-        const ScopedLock sl(m_audioDeviceIOCallbackLock);
-        for (auto const& outputMuteStatesKV : m_outputMuteStates)
-            commander->setOutputMute(outputMuteStatesKV.first, outputMuteStatesKV.second);
+        auto outputMuteStates = std::map<std::uint16_t, bool>();
+        {
+            const ScopedLock sl(m_audioDeviceIOCallbackLock);
+            outputMuteStates = m_outputMuteStates;
+        }
+        commander->setOutputMutes(outputMuteStates);
 	}
 }
 
@@ -773,26 +945,7 @@ void MemaProcessor::initializeCrosspointCommander(MemaCrosspointCommander* comma
 			matrixCrosspointStates = m_matrixCrosspointStates;
 			matrixCrosspointValues = m_matrixCrosspointValues;
 		}
-		for (auto const& matrixCrosspointStateKV : matrixCrosspointStates)
-		{
-			for (auto const& matrixCrosspointStateNodeKV : matrixCrosspointStateKV.second)
-			{
-				auto& input = matrixCrosspointStateKV.first;
-				auto& output = matrixCrosspointStateNodeKV.first;
-				auto& enabled = matrixCrosspointStateNodeKV.second;
-				commander->setCrosspointEnabledValue(input, output, enabled);
-			}
-		}
-		for (auto const& matrixCrosspointValKV : matrixCrosspointValues)
-		{
-			for (auto const& matrixCrosspointValNodeKV : matrixCrosspointValKV.second)
-			{
-				auto& input = matrixCrosspointValKV.first;
-				auto& output = matrixCrosspointValNodeKV.first;
-				auto& val = matrixCrosspointValNodeKV.second;
-				commander->setCrosspointFactorValue(input, output, val);
-			}
-		}
+		commander->setCrosspointValues(matrixCrosspointStates, matrixCrosspointValues);
 	}
 }
 
@@ -885,6 +1038,7 @@ void MemaProcessor::setInputMuteState(std::uint16_t inputChannelNumber, bool mut
 		m_inputMuteStates[inputChannelNumber] = muted;
 	}
 
+	addStateJournalRecord({ ProcessorStateJournal::RecordType::InputMute, muted, inputChannelNumber });
 	setTimedConfigurationDumpPending();
 }
 
@@ -924,6 +1078,7 @@ void MemaProcessor::setMatrixCrosspointEnabledValue(std::uint16_t inputNumber, s
 		m_matrixCrosspointStates[inputNumber][outputNumber] = enabled;
 	}
 
+	addStateJournalRecord({ ProcessorStateJournal::RecordType::CrosspointEnabled, enabled, inputNumber, outputNumber });
 	setTimedConfigurationDumpPending();
 }
 
@@ -963,6 +1118,76 @@ void MemaProcessor::setMatrixCrosspointFactorValue(std::uint16_t inputNumber, st
 		m_matrixCrosspointValues[inputNumber][outputNumber] = factor;
 	}
 
+	addStateJournalRecord({ ProcessorStateJournal::RecordType::CrosspointFactor, false, inputNumber, outputNumber, factor });
+	setTimedConfigurationDumpPending();
+}
+
+void MemaProcessor::setObjectPanningLayout(const std::map<int, InputPositionPanner::LayerLayout>& layerLayouts, int layoutId)
+{
+	auto& panner = m_objectPanners[layoutId];
+	if (!panner)
+		panner = std::make_unique<InputPositionPanner>();
+
+	panner->clearLayouts();
+	for (auto const& layerLayoutKV : layerLayouts)
+		panner->setLayout(layerLayoutKV.first, layerLayoutKV.second);
+}
+
+void MemaProcessor::setObjectPositions(const std::vector<InputPositionPanner::InputPosition>& inputPositions, int layoutId, MemaChannelCommander* sender, int userId)
+{
+	auto pannerIter = m_objectPanners.find(layoutId);
+	if (m_objectPanners.end() == pannerIter || !pannerIter->second)
+		return;
+	auto& panner = *pannerIter->second;
+
+	auto numInputs = m_inputChannelCount;
+	auto numOutputs = m_outputChannelCount;
+	m_objectPanningGains.resize(size_t(std::max(0, numInputs * numOutputs)));
+	panner.process(inputPositions, m_objectPanningGains.data(), numInputs, numOutputs);
+
+	// collect every node the batch touches, panned as well as silenced outputs of the input's layer
+	std::vector<std::tuple<std::uint16_t, std::uint16_t, float>> crosspoints;
+	for (auto const& inputPosition : inputPositions)
+	{
+		if (inputPosition.input < 1 || inputPosition.input > numInputs || !panner.hasLayout(inputPosition.layer))
+			continue;
+		auto addCrosspoint = [&](int output) {
+			if (output >= 1 && output <= numOutputs)
+				crosspoints.push_back({ inputPosition.input, std::uint16_t(output), m_objectPanningGains[size_t((inputPosition.input - 1) * numOutputs + (output - 1))] });
+		};
+		for (auto const& output : panner.getPannedOutputs(inputPosition.layer))
+			addCrosspoint(output);
+		for (auto const& output : panner.getSilencedOutputs(inputPosition.layer))
+			addCrosspoint(output);
+	}
+	if (crosspoints.empty())
+		return;
+
+	{
+		// one lock for the whole batch, so the audio callback never renders a partially applied position update
+		const ScopedLock sl(m_audioDeviceIOCallbackLock);
+		for (auto const& crosspoint : crosspoints)
+		{
+			m_matrixCrosspointStates[std::get<0>(crosspoint)][std::get<1>(crosspoint)] = true;
+			m_matrixCrosspointValues[std::get<0>(crosspoint)][std::get<1>(crosspoint)] = std::get<2>(crosspoint);
+		}
+	}
+
+	std::map<std::uint16_t, std::map<std::uint16_t, bool>> crosspointStates;
+	std::map<std::uint16_t, std::map<std::uint16_t, float>> crosspointValues;
+	for (auto const& crosspoint : crosspoints)
+	{
+		crosspointStates[std::get<0>(crosspoint)][std::get<1>(crosspoint)] = true;
+		crosspointValues[std::get<0>(crosspoint)][std::get<1>(crosspoint)] = std::get<2>(crosspoint);
+	}
+	for (auto const& crosspointCommander : m_crosspointCommanders)
+	{
+		if (crosspointCommander != reinterpret_cast<MemaCrosspointCommander*>(sender) || nullptr != reinterpret_cast<MemaNetworkClientCommanderWrapper*>(sender))
+			crosspointCommander->setCrosspointValues(crosspointStates, crosspointValues, userId);
+	}
+
+	for (auto const& crosspoint : crosspoints)
+		addStateJournalRecord({ ProcessorStateJournal::RecordType::Crosspoint, true, std::get<0>(crosspoint), std::get<1>(crosspoint), std::get<2>(crosspoint) });
 	setTimedConfigurationDumpPending();
 }
 
@@ -988,7 +1213,176 @@ void MemaProcessor::setOutputMuteState(std::uint16_t outputChannelNumber, bool m
 		m_outputMuteStates[outputChannelNumber] = muted;
 	}
 
+	addStateJournalRecord({ ProcessorStateJournal::RecordType::OutputMute, muted, outputChannelNumber });
+	setTimedConfigurationDumpPending();
+}
+
+int MemaProcessor::storeScene(int sceneId, const juce::String& name)
+{
+	auto scene = SceneStore::Scene();
+	scene.name = name;
+	{
+		const ScopedLock sl(m_audioDeviceIOCallbackLock);
+		scene.routing.inputMuteStates = m_inputMuteStates;
+		scene.routing.outputMuteStates = m_outputMuteStates;
+		scene.routing.crosspointStates = m_matrixCrosspointStates;
+		scene.routing.crosspointValues = m_matrixCrosspointValues;
+	}
+	for (auto const& parameterInfo : m_pluginParameterInfos)
+		if (parameterInfo.index >= 0)
+			scene.pluginParameterValues[std::uint16_t(parameterInfo.index)] = parameterInfo.currentValue;
+
+	auto storedSceneId = m_sceneStore.storeScene(sceneId, std::move(scene));
+	if (storedSceneId > 0)
+	{
+		sendSceneListToClients();
+		triggerConfigurationUpdate(false);
+	}
+
+	return storedSceneId;
+}
+
+bool MemaProcessor::recallScene(int sceneId, int crossfadeMs)
+{
+	auto scene = m_sceneStore.getScene(sceneId);
+	if (nullptr == scene)
+		return false;
+
+	auto inputCount = m_inputChannelCount;
+	auto outputCount = m_outputChannelCount;
+
+	std::map<std::uint16_t, bool> inputMuteStates;
+	std::map<std::uint16_t, bool> outputMuteStates;
+	std::map<std::uint16_t, std::map<std::uint16_t, bool>> matrixCrosspointStates;
+	std::map<std::uint16_t, std::map<std::uint16_t, float>> matrixCrosspointValues;
+	{
+		const ScopedLock sl(m_audioDeviceIOCallbackLock);
+		inputMuteStates = m_inputMuteStates;
+		outputMuteStates = m_outputMuteStates;
+		matrixCrosspointStates = m_matrixCrosspointStates;
+		matrixCrosspointValues = m_matrixCrosspointValues;
+	}
+
+	auto crossfadeLength = int(std::max(0, crossfadeMs) * getSampleRate() / 1000.0);
+	auto crossfadeFromGains = std::vector<float>();
+	if (crossfadeLength > 0)
+	{
+		crossfadeFromGains.assign(size_t(inputCount) * size_t(outputCount), 0.0f);
+		for (auto in = std::uint16_t(1); in <= inputCount; in++)
+			for (auto out = std::uint16_t(1); out <= outputCount; out++)
+				if (matrixCrosspointStates[in][out])
+					crossfadeFromGains[size_t(in - 1) * size_t(outputCount) + size_t(out - 1)] = matrixCrosspointValues[in][out];
+	}
+
+	// build the recalled state off the audio thread, collecting what changes for the commanders on the way
+	std::map<std::uint16_t, bool> changedInputMuteStates;
+	std::map<std::uint16_t, bool> changedOutputMuteStates;
+	std::map<std::uint16_t, std::map<std::uint16_t, bool>> changedCrosspointStates;
+	std::map<std::uint16_t, std::map<std::uint16_t, float>> changedCrosspointValues;
+	for (auto const& inputMuteStateKV : scene->routing.inputMuteStates)
+	{
+		if (inputMuteStateKV.first < 1 || inputMuteStateKV.first > inputCount)
+			continue;
+		auto& muted = inputMuteStates[inputMuteStateKV.first];
+		if (muted != inputMuteStateKV.second)
+			changedInputMuteStates[inputMuteStateKV.first] = muted = inputMuteStateKV.second;
+	}
+	for (auto const& outputMuteStateKV : scene->routing.outputMuteStates)
+	{
+		if (outputMuteStateKV.first < 1 || outputMuteStateKV.first > outputCount)
+			continue;
+		auto& muted = outputMuteStates[outputMuteStateKV.first];
+		if (muted != outputMuteStateKV.second)
+			changedOutputMuteStates[outputMuteStateKV.first] = muted = outputMuteStateKV.second;
+	}
+	for (auto const& crosspointStatesKV : scene->routing.crosspointStates)
+	{
+		if (crosspointStatesKV.first < 1 || crosspointStatesKV.first > inputCount)
+			continue;
+		for (auto const& crosspointStateKV : crosspointStatesKV.second)
+		{
+			if (crosspointStateKV.first < 1 || crosspointStateKV.first > outputCount)
+				continue;
+			auto& enabled = matrixCrosspointStates[crosspointStatesKV.first][crosspointStateKV.first];
+			if (enabled != crosspointStateKV.second)
+				changedCrosspointStates[crosspointStatesKV.first][crosspointStateKV.first] = enabled = crosspointStateKV.second;
+		}
+	}
+	for (auto const& crosspointValuesKV : scene->routing.crosspointValues)
+	{
+		if (crosspointValuesKV.first < 1 || crosspointValuesKV.first > inputCount)
+			continue;
+		for (auto const& crosspointValueKV : crosspointValuesKV.second)
+		{
+			if (crosspointValueKV.first < 1 || crosspointValueKV.first > outputCount)
+				continue;
+			auto& factor = matrixCrosspointValues[crosspointValuesKV.first][crosspointValueKV.first];
+			if (factor != crosspointValueKV.second)
+				changedCrosspointValues[crosspointValuesKV.first][crosspointValueKV.first] = factor = crosspointValueKV.second;
+		}
+	}
+
+	{
+		// swap the whole scene in at once, the previous state is released with the locals outside the lock
+		const ScopedLock sl(m_audioDeviceIOCallbackLock);
+		auto crossfadeRunning = m_sceneCrossfadePosition < m_sceneCrossfadeLength && m_sceneCrossfadeFromGains.size() == crossfadeFromGains.size();
+		if (crossfadeLength > 0 && crossfadeRunning)
+		{
+			// continue from where the running crossfade currently is instead of jumping to its target
+			auto progress = float(m_sceneCrossfadePosition) / float(m_sceneCrossfadeLength);
+			for (size_t i = 0; i < crossfadeFromGains.size(); i++)
+				crossfadeFromGains[i] = m_sceneCrossfadeFromGains[i] + (crossfadeFromGains[i] - m_sceneCrossfadeFromGains[i]) * progress;
+		}
+		std::swap(m_inputMuteStates, inputMuteStates);
+		std::swap(m_outputMuteStates, outputMuteStates);
+		std::swap(m_matrixCrosspointStates, matrixCrosspointStates);
+		std::swap(m_matrixCrosspointValues, matrixCrosspointValues);
+		std::swap(m_sceneCrossfadeFromGains, crossfadeFromGains);
+		m_sceneCrossfadeOutputCount = outputCount;
+		m_sceneCrossfadeLength = crossfadeLength;
+		m_sceneCrossfadePosition = 0;
+	}
+
+	// every commander (UI as well as remote clients) gets the changed nodes in one call per interface
+	if (!changedInputMuteStates.empty())
+		for (auto const& inputCommander : m_inputCommanders)
+			inputCommander->setInputMutes(changedInputMuteStates);
+	if (!changedOutputMuteStates.empty())
+		for (auto const& outputCommander : m_outputCommanders)
+			outputCommander->setOutputMutes(changedOutputMuteStates);
+	if (!changedCrosspointStates.empty() || !changedCrosspointValues.empty())
+		for (auto const& crosspointCommander : m_crosspointCommanders)
+			crosspointCommander->setCrosspointValues(changedCrosspointStates, changedCrosspointValues);
+
+	for (auto const& parameterValueKV : scene->pluginParameterValues)
+	{
+		auto parameterInfo = getPluginParameterInfo(parameterValueKV.first);
+		if (nullptr != parameterInfo && parameterInfo->currentValue != parameterValueKV.second)
+			setPluginParameterValue(parameterValueKV.first, parameterInfo->id.toStdString(), parameterValueKV.second);
+	}
+
+	// the state was replaced as a whole, the next dumper tick writes a new snapshot instead of journaling every node
+	m_stateJournalValid = false;
+	m_pendingStateJournalRecords.clear();
 	setTimedConfigurationDumpPending();
+
+	return true;
+}
+
+bool MemaProcessor::removeScene(int sceneId)
+{
+	if (!m_sceneStore.removeScene(sceneId))
+		return false;
+
+	sendSceneListToClients();
+	triggerConfigurationUpdate(false);
+
+	return true;
+}
+
+std::vector<std::pair<std::uint16_t, juce::String>> MemaProcessor::getSceneList() const
+{
+	return m_sceneStore.getSceneList();
 }
 
 void MemaProcessor::setChannelCounts(std::uint16_t inputChannelCount, std::uint16_t outputChannelCount)
@@ -1071,56 +1465,75 @@ void MemaProcessor::configurePluginForCurrentPosition()
 
 bool MemaProcessor::setPlugin(const juce::PluginDescription& pluginDescription)
 {
-	juce::AudioPluginFormatManager formatManager;
-	addDefaultFormatsToManager(formatManager);
-	auto registeredFormats = formatManager.getFormats();
+	// an explicitly set plug-in supersedes pending (startup) loads
+	m_pluginLoadRequestId++;
+	m_deferredPluginConfigXml.reset();
+
+	closePluginEditor();
+
+	juce::String errorMessage;
+	auto pluginInstance = m_pluginFormatManager.createPluginInstance(pluginDescription, getSampleRate(), getBlockSize(), errorMessage);
+
+	return applyPluginInstance(std::move(pluginInstance), pluginDescription, errorMessage);
+}
+
+void MemaProcessor::setPluginAsync(const juce::PluginDescription& pluginDescription, std::function<void(bool)> onPluginLoaded)
+{
+	auto requestId = ++m_pluginLoadRequestId;
+	juce::WeakReference<MemaProcessor> weakThis(this);
+	m_pluginFormatManager.createPluginInstanceAsync(pluginDescription, getSampleRate(), getBlockSize(),
+		[weakThis, requestId, pluginDescription, onPluginLoaded](std::unique_ptr<juce::AudioPluginInstance> pluginInstance, const juce::String& errorMessage) {
+			auto processor = weakThis.get();
+			if (nullptr == processor || requestId != processor->m_pluginLoadRequestId)
+				return;
 
-	auto success = false;
-	juce::String errorMessage = "Unsupported plug-in format.";
+			processor->closePluginEditor();
+			auto success = processor->applyPluginInstance(std::move(pluginInstance), pluginDescription, errorMessage);
+			if (onPluginLoaded)
+				onPluginLoaded(success);
+		});
+}
 
-	for (auto const& format : registeredFormats)
+bool MemaProcessor::applyPluginInstance(std::unique_ptr<juce::AudioPluginInstance> pluginInstance, const juce::PluginDescription& pluginDescription, const juce::String& errorMessage)
+{
+	// threadsafe locking in scope to access plugin
 	{
-		if (format->getName() == pluginDescription.pluginFormatName)
+		const ScopedLock sl(m_pluginProcessingLock);
+
+		// Detach listeners from the outgoing plugin instance before replacing it
+		if (m_pluginInstance)
 		{
-			closePluginEditor();
+			for (auto const& param : m_pluginInstance->getParameters())
+				param->removeListener(this);
+		}
 
-			// threadsafe locking in scope to access plugin
-			{
-				const ScopedLock sl(m_pluginProcessingLock);
+		m_pluginParameterInfos.clear();
+		m_pluginParameterDisplayOrder.clear();
 
-				// Detach listeners from the outgoing plugin instance before replacing it
-				if (m_pluginInstance)
-				{
-					for (auto const& param : m_pluginInstance->getParameters())
-						param->removeListener(this);
-				}
+		// queued changes refer to the outgoing plugin's parameters - safe to discard here, since the audio thread only drains under this lock
+		m_pluginParameterChangeQueue.reset();
+		m_pluginParameterChangesForBlock.clear();
 
-				m_pluginParameterInfos.clear();
-				m_pluginParameterDisplayOrder.clear();
+		m_pluginInstance = std::move(pluginInstance);
+		if (m_pluginInstance)
+		{
+			// Size the plugin correctly for its current pre/post position:
+			// pre-matrix → inputChannelCount × inputChannelCount
+			// post-matrix → outputChannelCount × outputChannelCount
+			configurePluginForCurrentPosition();
 
-				m_pluginInstance = format->createInstanceFromDescription(pluginDescription, getSampleRate(), getBlockSize(), errorMessage);
-				if (m_pluginInstance)
-				{
-					// Size the plugin correctly for its current pre/post position:
-					// pre-matrix → inputChannelCount × inputChannelCount
-					// post-matrix → outputChannelCount × outputChannelCount
-					configurePluginForCurrentPosition();
-
-					// Extract parameters here
-					m_pluginParameterInfos.clear();
-					for (auto const& param : m_pluginInstance->getParameters())
-						m_pluginParameterInfos.push_back(PluginParameterInfo::fromAudioProcessorParameter(*param));
-					postMessage(std::make_unique<PluginParameterInfosChangedMessage>().release());
-
-					// Attach listeners to track parameter changes
-					for (auto const& param : m_pluginInstance->getParameters())
-						param->addListener(this);
-				}
-			}
-			success = errorMessage.isEmpty();
-			break;
+			// Extract parameters here
+			m_pluginParameterInfos.clear();
+			for (auto const& param : m_pluginInstance->getParameters())
+				m_pluginParameterInfos.push_back(PluginParameterInfo::fromAudioProcessorParameter(*param));
+			postMessage(std::make_unique<PluginParameterInfosChangedMessage>().release());
+
+			// Attach listeners to track parameter changes
+			for (auto const& param : m_pluginInstance->getParameters())
+				param->addListener(this);
 		}
 	}
+	auto success = m_pluginInstance && errorMessage.isEmpty();
 
 	if (!success)
 		juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::WarningIcon, "Loading error", "Loading of the selected plug-in " + pluginDescription.name + " failed.\n" + errorMessage);
@@ -1196,6 +1609,8 @@ void MemaProcessor::clearPlugin()
 		m_pluginInstance.reset();
 		m_pluginParameterInfos.clear();
 		m_pluginParameterDisplayOrder.clear();
+		m_pluginParameterChangeQueue.reset();
+		m_pluginParameterChangesForBlock.clear();
 	}
 
 	postMessage(std::make_unique<PluginParameterInfosChangedMessage>().release());
@@ -1235,6 +1650,16 @@ std::vector<PluginParameterInfo>& MemaProcessor::getPluginParameterInfos()
 	return m_pluginParameterInfos;
 }
 
+PluginParameterInfo* MemaProcessor::getPluginParameterInfo(int parameterIndex)
+{
+	if (parameterIndex < 0 || parameterIndex >= int(m_pluginParameterInfos.size()))
+		return nullptr;
+
+	// infos are extracted in plugin parameter order, therefor the index is the position
+	jassert(m_pluginParameterInfos[parameterIndex].index == parameterIndex);
+	return &m_pluginParameterInfos[parameterIndex];
+}
+
 void MemaProcessor::setPluginParameterRemoteControlInfos(int parameterIndex, bool remoteControllable, ParameterControlType type, int steps)
 {
 	if (parameterIndex >= 0 && parameterIndex < m_pluginParameterInfos.size())
@@ -1303,10 +1728,9 @@ void MemaProcessor::setPluginParameterValue(std::uint16_t parameterIndex, std::s
 	if (!m_pluginInstance)
 		return;
 
-	auto& parameters = m_pluginInstance->getParameters();
-	auto idxInRange = parameterIndex >= 0 && parameterIndex < parameters.size();
-	jassert(idxInRange);
-	if (!idxInRange)
+	auto parameterInfo = getPluginParameterInfo(parameterIndex);
+	jassert(nullptr != parameterInfo);
+	if (nullptr == parameterInfo)
 		return;
 
 	for (auto const& pluginCommander : m_pluginCommanders)
@@ -1315,18 +1739,111 @@ void MemaProcessor::setPluginParameterValue(std::uint16_t parameterIndex, std::s
 			pluginCommander->setPluginParameterValue(parameterIndex, id, normalizedValue, userId);
 	}
 
-
+	// Hand the value over to the audio thread, which applies it at block start with the sample offset derived here.
+	// Only if audio is not running (nothing drains the queue) or the queue overflows, the value is applied right away.
+	auto sampleOffset = getPluginParameterChangeSampleOffset();
+	if (sampleOffset < 0 || !m_pluginParameterChangeQueue.push(parameterIndex, normalizedValue, sampleOffset))
 	{
 		const ScopedLock sl(m_pluginProcessingLock);
+		applyPluginParameterChange({ int(parameterIndex), normalizedValue, 0 });
+	}
 
-		parameters[parameterIndex]->setValue(normalizedValue);
+	// Update cached value
+	parameterInfo->currentValue = normalizedValue;
 
-		// Update cached value
-		if (parameterIndex < m_pluginParameterInfos.size())
-			m_pluginParameterInfos[parameterIndex].currentValue = normalizedValue;
+	setTimedConfigurationDumpPending();
+}
+
+int MemaProcessor::getPluginParameterChangeSampleOffset() const
+{
+	auto lastBlockStartTicks = m_lastBlockStartTicks.load();
+	auto sampleRate = getSampleRate();
+	auto blockSize = getBlockSize();
+	if (0 == lastBlockStartTicks || sampleRate <= 0.0 || blockSize <= 0)
+		return -1;
+
+	auto secondsSinceBlockStart = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - lastBlockStartTicks);
+	auto blockDurationSeconds = blockSize / sampleRate;
+	// no block for several block durations means the device is stalled - nothing would drain the queue in time
+	if (secondsSinceBlockStart > 4 * blockDurationSeconds)
+		return -1;
+
+	return juce::jlimit(0, blockSize - 1, int(secondsSinceBlockStart * sampleRate));
+}
+
+void MemaProcessor::processPluginBlock(juce::AudioBuffer<float>& pluginBuffer, juce::MidiBuffer& midiMessages)
+{
+	// Must be called under m_pluginProcessingLock.
+	jassert(m_pluginInstance);
+
+	auto numSamples = pluginBuffer.getNumSamples();
+	if (m_pluginParameterChangesForBlock.empty())
+	{
+		m_pluginInstance->processBlock(pluginBuffer, midiMessages);
+		return;
 	}
 
-	setTimedConfigurationDumpPending();
+	// every sub-block gets only its own MIDI events, shifted to its start, and its output is collected at block positions
+	m_pluginBlockMidiOutput.clear();
+	auto processSubBlock = [&](int subBlockStart, int subBlockLength) {
+		juce::AudioBuffer<float> subBuffer(pluginBuffer.getArrayOfWritePointers(), pluginBuffer.getNumChannels(), subBlockStart, subBlockLength);
+		m_pluginSubBlockMidi.clear();
+		m_pluginSubBlockMidi.addEvents(midiMessages, subBlockStart, subBlockLength, -subBlockStart);
+		m_pluginInstance->processBlock(subBuffer, m_pluginSubBlockMidi);
+		m_pluginBlockMidiOutput.addEvents(m_pluginSubBlockMidi, 0, subBlockLength, subBlockStart);
+	};
+
+	auto startSample = 0;
+	auto changeIdx = size_t(0);
+	while (changeIdx < m_pluginParameterChangesForBlock.size())
+	{
+		// quantise the sub-block boundaries to not call the plugin with arbitrarily small blocks
+		auto changeOffset = juce::jlimit(0, numSamples, m_pluginParameterChangesForBlock[changeIdx].sampleOffset);
+		changeOffset -= changeOffset % s_pluginParameterChangeGranularity;
+		if (changeOffset > startSample)
+		{
+			processSubBlock(startSample, changeOffset - startSample);
+			startSample = changeOffset;
+		}
+
+		// apply every change that falls onto the current boundary (or, if out of order, before it)
+		while (changeIdx < m_pluginParameterChangesForBlock.size())
+		{
+			auto& change = m_pluginParameterChangesForBlock[changeIdx];
+			auto offset = juce::jlimit(0, numSamples, change.sampleOffset);
+			if (offset - (offset % s_pluginParameterChangeGranularity) > startSample)
+				break;
+			applyPluginParameterChange(change);
+			changeIdx++;
+		}
+	}
+	m_pluginParameterChangesForBlock.clear();
+
+	if (startSample < numSamples)
+		processSubBlock(startSample, numSamples - startSample);
+
+	// copied rather than swapped, the preallocated buffer must not move into the caller's per-callback one
+	midiMessages.clear();
+	midiMessages.addEvents(m_pluginBlockMidiOutput, 0, numSamples, 0);
+}
+
+void MemaProcessor::applyPendingPluginParameterChanges()
+{
+	// Must be called under m_pluginProcessingLock.
+	for (auto const& change : m_pluginParameterChangesForBlock)
+		applyPluginParameterChange(change);
+	m_pluginParameterChangesForBlock.clear();
+}
+
+void MemaProcessor::applyPluginParameterChange(const PluginParameterChangeQueue::Change& change)
+{
+	// Must be called under m_pluginProcessingLock.
+	if (!m_pluginInstance)
+		return;
+
+	auto& parameters = m_pluginInstance->getParameters();
+	if (change.index >= 0 && change.index < parameters.size())
+		parameters[change.index]->setValue(change.value);
 }
 
 juce::AudioProcessorParameter* MemaProcessor::getPluginParameter(int parameterIndex) const
@@ -1360,6 +1877,111 @@ std::map<int, std::pair<double, bool>> MemaProcessor::getNetworkHealth()
 		return {};
 }
 
+std::vector<InterprocessConnectionServerImpl::ConnectionTelemetry> MemaProcessor::getNetworkTelemetry() const
+{
+	if (m_networkServer)
+		return m_networkServer->getTelemetry();
+	else
+		return {};
+}
+
+juce::String MemaProcessor::getMetricsText() const
+{
+	juce::String text;
+	auto addFamily = [&text](const char* name, const char* type, const char* help) {
+		text << "# HELP " << name << " " << help << "\n# TYPE " << name << " " << type << "\n";
+	};
+	auto addSample = [&text](const char* name, const juce::String& labels, double value) {
+		text << name << (labels.isEmpty() ? juce::String() : "{" + labels + "}") << " " << juce::String(value, 6).trimCharactersAtEnd("0").trimCharactersAtEnd(".") << "\n";
+	};
+	auto connectionLabel = [](int connectionId) { return "connection=\"" + juce::String(connectionId) + "\""; };
+
+	auto telemetry = getNetworkTelemetry();
+
+	addFamily("mema_client_connected_seconds", "gauge", "Time since the client connection was accepted.");
+	for (auto const& connection : telemetry)
+		addSample("mema_client_connected_seconds", connectionLabel(connection.connectionId), connection.connectedSeconds);
+	addFamily("mema_client_queue_messages", "gauge", "Messages waiting in the send queue of the client.");
+	for (auto const& connection : telemetry)
+		addSample("mema_client_queue_messages", connectionLabel(connection.connectionId), double(connection.queuedMessages));
+
+	// per message type counters, types that were never sent nor dropped are left out
+	auto addTypeFamily = [&](const char* name, const char* help, std::function<std::uint64_t(const InterprocessConnectionServerImpl::ConnectionTelemetry::TypeCounters&)> getValue) {
+		addFamily(name, "counter", help);
+		for (auto const& connection : telemetry)
+		{
+			for (auto typeIdx = 0; typeIdx < InterprocessConnectionServerImpl::s_messageTypeSlotCount; typeIdx++)
+			{
+				auto const& typeCounters = connection.types[size_t(typeIdx)];
+				if (0 == typeCounters.sentMessages && 0 == typeCounters.droppedMessages)
+					continue;
+				auto typeName = SerializableMessage::getTypeName(SerializableMessage::SerializableMessageType(typeIdx));
+				addSample(name, connectionLabel(connection.connectionId) + ",type=\"" + typeName + "\"", double(getValue(typeCounters)));
+			}
+		}
+	};
+	addTypeFamily("mema_client_sent_messages_total", "Messages written to the client socket.", [](const auto& c) { return c.sentMessages; });
+	addTypeFamily("mema_client_sent_bytes_total", "Bytes written to the client socket, excluding the connection framing.", [](const auto& c) { return c.sentBytes; });
+	addTypeFamily("mema_client_dropped_messages_total", "Messages discarded from the full send queue of the client.", [](const auto& c) { return c.droppedMessages; });
+
+	addFamily("mema_client_send_failures_total", "counter", "Socket writes to the client that failed.");
+	for (auto const& connection : telemetry)
+		addSample("mema_client_send_failures_total", connectionLabel(connection.connectionId), double(connection.sendFailures));
+	addFamily("mema_client_send_latency_seconds", "summary", "Time from queueing a message until its socket write completed.");
+	for (auto const& connection : telemetry)
+	{
+		addSample("mema_client_send_latency_seconds_sum", connectionLabel(connection.connectionId), connection.sendLatencySumUs * 1.0e-6);
+		addSample("mema_client_send_latency_seconds_count", connectionLabel(connection.connectionId), double(connection.getSentMessages()));
+	}
+	addFamily("mema_client_send_latency_max_seconds", "gauge", "Longest send latency since the client connected.");
+	for (auto const& connection : telemetry)
+		addSample("mema_client_send_latency_max_seconds", connectionLabel(connection.connectionId), connection.sendLatencyMaxUs * 1.0e-6);
+	addFamily("mema_client_write_stalls_total", "counter", "Socket writes to the client that took longer than 1 ms.");
+	for (auto const& connection : telemetry)
+		addSample("mema_client_write_stalls_total", connectionLabel(connection.connectionId), double(connection.writeStallCount));
+	addFamily("mema_client_write_stall_seconds_total", "counter", "Time spent in socket writes to the client that took longer than 1 ms.");
+	for (auto const& connection : telemetry)
+		addSample("mema_client_write_stall_seconds_total", connectionLabel(connection.connectionId), connection.writeStallSumUs * 1.0e-6);
+	addFamily("mema_client_write_max_seconds", "gauge", "Longest socket write to the client since it connected.");
+	for (auto const& connection : telemetry)
+		addSample("mema_client_write_max_seconds", connectionLabel(connection.connectionId), connection.writeMaxUs * 1.0e-6);
+
+	// the audio callback counters restart when the profile is reset, which scrapers treat as counter reset
+	auto profile = getAudioCallbackProfile();
+	addFamily("mema_audio_callbacks_total", "counter", "Audio callbacks since the last profile reset.");
+	addSample("mema_audio_callbacks_total", {}, double(profile.callbackCount));
+	addFamily("mema_audio_deadline_misses_total", "counter", "Audio callbacks that took longer than their deadline.");
+	addSample("mema_audio_deadline_misses_total", {}, double(profile.deadlineMissCount));
+	addFamily("mema_audio_xruns_total", "counter", "Audio callbacks that started more than 1.5 deadlines after the previous one.");
+	addSample("mema_audio_xruns_total", {}, double(profile.xrunCount));
+	addFamily("mema_audio_callback_seconds_total", "counter", "Time spent in the audio callback.");
+	addSample("mema_audio_callback_seconds_total", {}, profile.callbackUs * 1.0e-6);
+	addFamily("mema_audio_stage_seconds_total", "counter", "Time spent in the audio callback per processing stage.");
+	for (auto stage = 0; stage < AudioCallbackProfiler::StageCount; stage++)
+		addSample("mema_audio_stage_seconds_total", "stage=\"" + AudioCallbackProfiler::getStageName(AudioCallbackProfiler::Stage(stage)).toLowerCase().replaceCharacter(' ', '_') + "\"", profile.stageUs[size_t(stage)] * 1.0e-6);
+	addFamily("mema_audio_deadline_seconds", "gauge", "Deadline of the most recent audio callback.");
+	addSample("mema_audio_deadline_seconds", {}, profile.deadlineUs * 1.0e-6);
+
+	return text;
+}
+
+bool MemaProcessor::startMetricsEndpoint(int port)
+{
+	if (!m_metricsEndpoint)
+		m_metricsEndpoint = std::make_unique<MetricsEndpoint>([this]() { return getMetricsText(); });
+	return m_metricsEndpoint->start(port);
+}
+
+AudioCallbackProfiler::Snapshot MemaProcessor::getAudioCallbackProfile() const
+{
+	return m_audioCallbackProfiler.getSnapshot();
+}
+
+void MemaProcessor::resetAudioCallbackProfile()
+{
+	m_audioCallbackProfiler.reset();
+}
+
 JUCEAppBasics::SessionServiceTopology MemaProcessor::getDiscoveredServicesTopology()
 {
 	if (m_serviceTopologyManager)
@@ -1386,6 +2008,9 @@ void MemaProcessor::prepareToPlay(double sampleRate, int maximumExpectedSamplesP
 		// channel count. Calling prepareToPlay directly risks the AU reinitializing with its
 		// default layout (e.g. stereo), causing a preparedChannels mismatch assertion.
 		configurePluginForCurrentPosition();
+
+		m_pluginSubBlockMidi.ensureSize(size_t(s_pluginMidiBufferSize));
+		m_pluginBlockMidiOutput.ensureSize(size_t(s_pluginMidiBufferSize));
 	}
 
 	if (m_inputDataAnalyzer)
@@ -1426,6 +2051,16 @@ void MemaProcessor::processBlock(AudioBuffer<float>& buffer, MidiBuffer& midiMes
 	if (m_inputChannelCount > m_inputMuteStates.size())
 		reinitRequired = true;
 
+	// collect the plugin parameter changes that arrived since the last block
+	{
+		const ScopedLock sl(m_pluginProcessingLock);
+		m_pluginParameterChangeQueue.popAll(m_pluginParameterChangesForBlock);
+		// without plugin processing in this block there is no timeline to place the changes on - apply them right away
+		if (!m_pluginInstance || !m_pluginEnabled)
+			applyPendingPluginParameterChanges();
+	}
+	m_audioCallbackProfiler.endStage(AudioCallbackProfiler::PrePlugin);
+
 	for (std::uint16_t input = 1; input <= m_inputChannelCount; input++)
 	{
 		if (m_inputMuteStates.count(input) != 0 && m_inputMuteStates.at(input))
@@ -1434,8 +2069,10 @@ void MemaProcessor::processBlock(AudioBuffer<float>& buffer, MidiBuffer& midiMes
 			buffer.clear(channelIdx, 0, buffer.getNumSamples());
 		}
 	}
+	m_audioCallbackProfiler.endStage(AudioCallbackProfiler::Mutes);
 
 	postMessage(std::make_unique<AudioInputBufferMessage>(buffer).release());
+	m_audioCallbackProfiler.endStage(AudioCallbackProfiler::Metering);
 
 	// threadsafe locking in scope to access plugin - processing only takes place if NOT set to post matrix
 	{
@@ -1446,13 +2083,18 @@ void MemaProcessor::processBlock(AudioBuffer<float>& buffer, MidiBuffer& midiMes
 			// This may be narrower than m_inputChannelCount when the plugin only
 			// accepted a layout smaller than the device input count.
 			juce::AudioBuffer<float> pluginBuffer(buffer.getArrayOfWritePointers(), m_pluginConfiguredChannelCount, buffer.getNumSamples());
-			m_pluginInstance->processBlock(pluginBuffer, midiMessages);
+			processPluginBlock(pluginBuffer, midiMessages);
 		}
 	}
+	m_audioCallbackProfiler.endStage(AudioCallbackProfiler::PrePlugin);
 
 	// process data in buffer to be what shall be used as output
 	juce::AudioBuffer<float> processedBuffer;
 	processedBuffer.setSize(m_outputChannelCount, buffer.getNumSamples(), false, true, true);
+	// a running scene crossfade ramps every node from its gain at recall time towards the current value
+	auto sceneCrossfadeActive = m_sceneCrossfadePosition < m_sceneCrossfadeLength;
+	auto sceneCrossfadeStart = sceneCrossfadeActive ? float(m_sceneCrossfadePosition) / float(m_sceneCrossfadeLength) : 1.0f;
+	auto sceneCrossfadeEnd = sceneCrossfadeActive ? float(std::min(m_sceneCrossfadePosition + buffer.getNumSamples(), m_sceneCrossfadeLength)) / float(m_sceneCrossfadeLength) : 1.0f;
 	for (std::uint16_t inputIdx = 0; inputIdx < m_inputChannelCount; inputIdx++)
 	{
 		for (std::uint16_t outputIdx = 0; outputIdx < m_outputChannelCount; outputIdx++)
@@ -1464,12 +2106,23 @@ void MemaProcessor::processBlock(AudioBuffer<float>& buffer, MidiBuffer& midiMes
 					auto& enabled = m_matrixCrosspointStates.at(inputIdx + 1).at(outputIdx + 1);
 					auto& factor = m_matrixCrosspointValues.at(inputIdx + 1).at(outputIdx + 1);
 					auto gain = !enabled ? 0.0f : factor;
-					processedBuffer.addFrom(outputIdx, 0, buffer.getReadPointer(inputIdx), buffer.getNumSamples(), gain);
+					auto crossfadeGainIdx = size_t(inputIdx) * size_t(m_sceneCrossfadeOutputCount) + size_t(outputIdx);
+					if (sceneCrossfadeActive && outputIdx < m_sceneCrossfadeOutputCount && crossfadeGainIdx < m_sceneCrossfadeFromGains.size())
+					{
+						auto fromGain = m_sceneCrossfadeFromGains[crossfadeGainIdx];
+						processedBuffer.addFromWithRamp(outputIdx, 0, buffer.getReadPointer(inputIdx), buffer.getNumSamples(),
+							fromGain + (gain - fromGain) * sceneCrossfadeStart, fromGain + (gain - fromGain) * sceneCrossfadeEnd);
+					}
+					else
+						processedBuffer.addFrom(outputIdx, 0, buffer.getReadPointer(inputIdx), buffer.getNumSamples(), gain);
 				}
 			}
 		}
 	}
+	if (sceneCrossfadeActive)
+		m_sceneCrossfadePosition = std::min(m_sceneCrossfadePosition + buffer.getNumSamples(), m_sceneCrossfadeLength);
 	buffer.makeCopyOf(processedBuffer, true);
+	m_audioCallbackProfiler.endStage(AudioCallbackProfiler::Matrix);
 
 	if (m_outputChannelCount > m_outputMuteStates.size())
 		reinitRequired = true;
@@ -1483,9 +2136,10 @@ void MemaProcessor::processBlock(AudioBuffer<float>& buffer, MidiBuffer& midiMes
 			// This may be narrower than m_outputChannelCount when the plugin only
 			// accepted a layout smaller than the device output count.
 			juce::AudioBuffer<float> pluginBuffer(buffer.getArrayOfWritePointers(), m_pluginConfiguredChannelCount, buffer.getNumSamples());
-			m_pluginInstance->processBlock(pluginBuffer, midiMessages);
+			processPluginBlock(pluginBuffer, midiMessages);
 		}
 	}
+	m_audioCallbackProfiler.endStage(AudioCallbackProfiler::PostPlugin);
 
 	for (std::uint16_t output = 1; output <= m_outputChannelCount; output++)
 	{
@@ -1495,11 +2149,13 @@ void MemaProcessor::processBlock(AudioBuffer<float>& buffer, MidiBuffer& midiMes
 			buffer.clear(channelIdx, 0, buffer.getNumSamples());
 		}
 	}
+	m_audioCallbackProfiler.endStage(AudioCallbackProfiler::Mutes);
 
 	postMessage(std::make_unique<AudioOutputBufferMessage>(buffer).release());
 
 	if (reinitRequired)
 		postMessage(std::make_unique<ReinitIOCountMessage>(m_inputChannelCount, m_outputChannelCount).release());
+	m_audioCallbackProfiler.endStage(AudioCallbackProfiler::Metering);
 }
 
 void MemaProcessor::handleMessage(const Message& message)
@@ -1558,34 +2214,71 @@ void MemaProcessor::handleMessage(const Message& message)
 
 		tId = m->getType();
 	}
+	else if (auto const acpm = dynamic_cast<const AudioCallbackProfileMessage*>(&message))
+	{
+		if (-1 != origId)
+			return; // profiles only flow Mema -> clients, never relay one received from a connection
+
+		serializedMessageMemoryBlock = acpm->getSerializedMessage();
+
+		tId = acpm->getType();
+	}
 	else if (auto const cpm = dynamic_cast<const Mema::ControlParametersMessage*>(&message))
 	{
 		DBG(juce::String(__FUNCTION__) << " i:" << cpm->getInputMuteStates().size() << " o:" << cpm->getOutputMuteStates().size() << " c:" << cpm->getCrosspointStates().size());
+		// Applied as one batch, commanders (incl. the relay to other clients) get one bulk update per interface.
+		{
+			const ScopedLock sl(m_audioDeviceIOCallbackLock);
+			for (auto const& inputMuteState : cpm->getInputMuteStates())
+				m_inputMuteStates[inputMuteState.first] = inputMuteState.second;
+			for (auto const& outputMuteState : cpm->getOutputMuteStates())
+				m_outputMuteStates[outputMuteState.first] = outputMuteState.second;
+			for (auto const& crosspointStateKV : cpm->getCrosspointStates())
+				for (auto const& crosspointOStateKV : crosspointStateKV.second)
+					m_matrixCrosspointStates[crosspointStateKV.first][crosspointOStateKV.first] = crosspointOStateKV.second;
+			for (auto const& crosspointValueKV : cpm->getCrosspointValues())
+				for (auto const& crosspointOValueKV : crosspointValueKV.second)
+					m_matrixCrosspointValues[crosspointValueKV.first][crosspointOValueKV.first] = crosspointOValueKV.second;
+		}
+		if (!cpm->getInputMuteStates().empty())
+			for (auto const& inputCommander : m_inputCommanders)
+				inputCommander->setInputMutes(cpm->getInputMuteStates());
+		if (!cpm->getOutputMuteStates().empty())
+			for (auto const& outputCommander : m_outputCommanders)
+				outputCommander->setOutputMutes(cpm->getOutputMuteStates());
+		if (!cpm->getCrosspointStates().empty() || !cpm->getCrosspointValues().empty())
+			for (auto const& crosspointCommander : m_crosspointCommanders)
+				crosspointCommander->setCrosspointValues(cpm->getCrosspointStates(), cpm->getCrosspointValues(), origId);
+
 		for (auto const& inputMuteState : cpm->getInputMuteStates())
-			setInputMuteState(inputMuteState.first, inputMuteState.second, static_cast<MemaInputCommander*>(m_networkCommanderWrapper.get()));
+			addStateJournalRecord({ ProcessorStateJournal::RecordType::InputMute, inputMuteState.second, inputMuteState.first });
 		for (auto const& outputMuteState : cpm->getOutputMuteStates())
-			setOutputMuteState(outputMuteState.first, outputMuteState.second, static_cast<MemaOutputCommander*>(m_networkCommanderWrapper.get()));
+			addStateJournalRecord({ ProcessorStateJournal::RecordType::OutputMute, outputMuteState.second, outputMuteState.first });
 		for (auto const& crosspointStateKV : cpm->getCrosspointStates())
-		{
-			auto& inputNumber = crosspointStateKV.first;
 			for (auto const& crosspointOStateKV : crosspointStateKV.second)
-			{
-				auto& outputNumber = crosspointOStateKV.first;
-				setMatrixCrosspointEnabledValue(inputNumber, outputNumber, crosspointOStateKV.second, static_cast<MemaCrosspointCommander*>(m_networkCommanderWrapper.get()), origId);
-			}
-		}
+				addStateJournalRecord({ ProcessorStateJournal::RecordType::CrosspointEnabled, crosspointOStateKV.second, crosspointStateKV.first, crosspointOStateKV.first });
 		for (auto const& crosspointValueKV : cpm->getCrosspointValues())
-		{
-			auto& inputNumber = crosspointValueKV.first;
 			for (auto const& crosspointOValueKV : crosspointValueKV.second)
-			{
-				auto& outputNumber = crosspointOValueKV.first;
-				setMatrixCrosspointFactorValue(inputNumber, outputNumber, crosspointOValueKV.second, static_cast<MemaCrosspointCommander*>(m_networkCommanderWrapper.get()), origId);
-			}
-		}
+				addStateJournalRecord({ ProcessorStateJournal::RecordType::CrosspointFactor, false, crosspointValueKV.first, crosspointOValueKV.first, crosspointOValueKV.second });
+		setTimedConfigurationDumpPending();
 
 		tId = cpm->getType();
 	}
+	else if (auto const plm = dynamic_cast<const Mema::PanningLayoutMessage*>(&message))
+	{
+		DBG(juce::String(__FUNCTION__) << " layers:" << int(plm->getLayerLayouts().size()));
+
+		setObjectPanningLayout(plm->getLayerLayouts(), origId);
+
+		tId = plm->getType();
+	}
+	else if (auto const opm = dynamic_cast<const Mema::ObjectPositionsMessage*>(&message))
+	{
+		// Resulting crosspoints are relayed to other clients by the network commander wrapper, so no fallthrough resend here.
+		setObjectPositions(opm->getInputPositions(), origId, static_cast<MemaCrosspointCommander*>(m_networkCommanderWrapper.get()), origId);
+
+		tId = opm->getType();
+	}
 	else if (auto const dtsm = dynamic_cast<const Mema::DataTrafficTypeSelectionMessage*>(&message))
 	{
 		if (!dtsm->hasUserId())
@@ -1609,12 +2302,51 @@ void MemaProcessor::handleMessage(const Message& message)
 	{
 		DBG(juce::String(__FUNCTION__) << " ppvIdx:" << int(ppvm->getParameterIndex()) << " > " << ppvm->getCurrentValue());
 
+		// Relaying to other clients is done coalesced by the network commander wrapper, so no fallthrough resend here.
 		setPluginParameterValue(ppvm->getParameterIndex(), ppvm->getParameterId().toStdString(), ppvm->getCurrentValue(), static_cast<MemaPluginCommander*>(m_networkCommanderWrapper.get()), origId);
 
-		serializedMessageMemoryBlock = ppvm->getSerializedMessage();
-
 		tId = ppvm->getType();
 	}
+	else if (auto const ppvsm = dynamic_cast<const PluginParameterValuesMessage*>(&message))
+	{
+		DBG(juce::String(__FUNCTION__) << " ppvCnt:" << int(ppvsm->getParameterValues().size()));
+
+		for (auto const& parameterValue : ppvsm->getParameterValues())
+		{
+			auto parameterInfo = getPluginParameterInfo(parameterValue.first);
+			if (parameterInfo)
+				setPluginParameterValue(parameterValue.first, parameterInfo->id.toStdString(), parameterValue.second, static_cast<MemaPluginCommander*>(m_networkCommanderWrapper.get()), origId);
+		}
+
+		tId = ppvsm->getType();
+	}
+	else if (auto const ppsm = dynamic_cast<const PluginParameterSubscriptionMessage*>(&message))
+	{
+		if (!ppsm->hasUserId())
+			DBG("Incoming PluginParameterSubscriptionMessage cannot be associated with a connection");
+		else if (m_networkCommanderWrapper)
+			m_networkCommanderWrapper->setPluginParameterSubscription(origId, ppsm->getParameterIndices());
+
+		tId = ppsm->getType();
+	}
+	else if (auto const srm = dynamic_cast<const SceneRecallMessage*>(&message))
+	{
+		DBG(juce::String(__FUNCTION__) << " scene:" << int(srm->getSceneId()) << " crossfade:" << int(srm->getCrossfadeMs()) << "ms");
+
+		// The recalled state is sent to all clients (including the requesting one) by recallScene, so no fallthrough resend here.
+		recallScene(srm->getSceneId(), int(std::min(srm->getCrossfadeMs(), std::uint32_t(std::numeric_limits<int>::max()))));
+
+		tId = srm->getType();
+	}
+	else if (auto const ssm = dynamic_cast<const SceneStoreMessage*>(&message))
+	{
+		DBG(juce::String(__FUNCTION__) << " scene:" << ssm->getSceneId() << " name:" << ssm->getSceneName());
+
+		// The updated scene list is sent to all clients by storeScene, so no fallthrough resend here.
+		storeScene(ssm->getSceneId(), ssm->getSceneName());
+
+		tId = ssm->getType();
+	}
 	else if (auto const pesm = dynamic_cast<const PluginProcessingStateMessage*>(&message))
 	{
 		DBG(juce::String(__FUNCTION__) << " pluginEnabled:" << int(pesm->isEnabled()) << " pluginPost:" << int(pesm->isPost()));
@@ -1665,6 +2397,33 @@ void MemaProcessor::handleMessage(const Message& message)
 
 		return; // ...abort further handling below here therefor
 	}
+	else if (auto const ddim = dynamic_cast<const DeferredDeviceInitialisationMessage*>(&message))
+	{
+		initialiseAudioDevice(ddim->getDeviceSetupXml());
+		m_deferredStartupPending = false;
+		auto device = m_deviceManager->getCurrentAudioDevice();
+		logStartupPhase(nullptr != device && device->isPlaying() ? "audio running on " + device->getName() : juce::String("audio device not running"), !m_deferredPluginConfigXml);
+
+		return; // internal message, nothing to relay
+	}
+	else if (dynamic_cast<const DeferredPluginInstantiationMessage*>(&message))
+	{
+		m_deferredStartupPending = false;
+		if (!m_deferredPluginConfigXml)
+			return; // superseded by an explicitly set plug-in
+
+		auto pluginConfigXml = std::shared_ptr<juce::XmlElement>(m_deferredPluginConfigXml.release());
+		auto pluginDescription = juce::PluginDescription();
+		if (auto pluginDescriptionXml = pluginConfigXml->getChildByName("PLUGIN"))
+			pluginDescription.loadFromXml(*pluginDescriptionXml);
+		setPluginAsync(pluginDescription, [=](bool success) {
+			if (success)
+				restorePluginConfig(*pluginConfigXml);
+			logStartupPhase("plug-in " + pluginDescription.name + (success ? " instantiated" : " failed to load"), true);
+		});
+
+		return; // internal message, nothing to relay
+	}
 
 	std::vector<int> sendIds;
 	for (auto const& cId : m_trafficTypesPerConnection)
@@ -1685,16 +2444,14 @@ void MemaProcessor::handleMessage(const Message& message)
 
 void MemaProcessor::parameterValueChanged(int parameterIndex, float newValue)
 {
-	auto iter = std::find_if(getPluginParameterInfos().begin(), getPluginParameterInfos().end(), [=](const auto& info) { return info.index == parameterIndex; });
-	if (iter != getPluginParameterInfos().end())
+	if (auto parameterInfo = getPluginParameterInfo(parameterIndex))
 	{
 		// Update commanders (UIs and Remotes)
 		for (auto const& pluginCommander : m_pluginCommanders)
-			pluginCommander->setPluginParameterValue(static_cast<std::uint16_t>(parameterIndex), iter->id.toStdString(), newValue);
+			pluginCommander->setPluginParameterValue(static_cast<std::uint16_t>(parameterIndex), parameterInfo->id.toStdString(), newValue);
 
 		// Update cached value
-		if (parameterIndex < m_pluginParameterInfos.size())
-			m_pluginParameterInfos[parameterIndex].currentValue = newValue;
+		parameterInfo->currentValue = newValue;
 	}
 }
 
@@ -1714,12 +2471,170 @@ void MemaProcessor::sendMessageToClients(const MemoryBlock& messageMemoryBlock,
 			if (!deadConnectionIds.empty())
 			{
 				for (auto const& dcId : deadConnectionIds)
+				{
 					m_trafficTypesPerConnection.erase(dcId);
+					m_objectPanners.erase(dcId);
+				}
 			}
 		}
 	}
 }
 
+void MemaProcessor::sendSceneListToClients()
+{
+	if (m_networkServer && m_networkServer->hasActiveConnections())
+		sendMessageToClients(std::make_unique<SceneListMessage>(m_sceneStore.getSceneList())->getSerializedMessage(), m_networkServer->getActiveConnectionIds());
+}
+
+void MemaProcessor::sendAudioCallbackProfileToClients()
+{
+	// the subscription filter is applied when handleMessage relays it
+	if (m_networkServer && m_networkServer->hasActiveConnections())
+		postMessage(std::make_unique<AudioCallbackProfileMessage>(m_audioCallbackProfiler.getSnapshot()).release());
+}
+
+void MemaProcessor::writeStateSnapshot()
+{
+	auto state = ProcessorStateSnapshot::RoutingState();
+	{
+		const ScopedLock sl(m_audioDeviceIOCallbackLock);
+		state.inputMuteStates = m_inputMuteStates;
+		state.outputMuteStates = m_outputMuteStates;
+		state.crosspointStates = m_matrixCrosspointStates;
+		state.crosspointValues = m_matrixCrosspointValues;
+	}
+
+	// the snapshot already contains all pending changes, a fresh journal continues it.
+	// The snapshot is queued first, the writer keeps queue order, and the journal is only
+	// restarted once the new snapshot is in place - otherwise the old journal is kept, as it
+	// still continues the old snapshot on disk.
+	auto snapshot = ProcessorStateSnapshot::serialize(m_inputChannelCount, m_outputChannelCount, state);
+	auto snapshotChecksum = ProcessorStateSnapshot::getPayloadChecksum(snapshot);
+	auto journalHeader = std::make_shared<juce::MemoryBlock>(ProcessorStateJournal::createHeader(m_inputChannelCount, m_outputChannelCount, snapshotChecksum));
+	m_configurationFileWriter->write(m_stateSnapshotFile, std::move(snapshot));
+	m_configurationFileWriter->write(m_stateJournalFile, [snapshotFile = m_stateSnapshotFile, snapshotChecksum, journalHeader](juce::OutputStream& stream) {
+		auto snapshotOnDisk = juce::MemoryBlock();
+		if (!snapshotFile.loadFileAsData(snapshotOnDisk) || ProcessorStateSnapshot::getPayloadChecksum(snapshotOnDisk) != snapshotChecksum)
+			return false;
+		return stream.write(journalHeader->getData(), journalHeader->getSize());
+	});
+
+	m_pendingStateJournalRecords.clear();
+	m_stateJournalRecordCount = 0;
+	m_stateJournalInputCount = m_inputChannelCount;
+	m_stateJournalOutputCount = m_outputChannelCount;
+	m_stateJournalValid = true;
+}
+
+void MemaProcessor::addStateJournalRecord(const ProcessorStateJournal::Record& record)
+{
+	// no need to collect records that the next compaction would discard anyway
+	if (m_stateJournalValid)
+		m_pendingStateJournalRecords.push_back(record);
+}
+
+void MemaProcessor::appendStateJournal()
+{
+	if (m_pendingStateJournalRecords.empty())
+		return;
+
+	m_configurationFileWriter->append(m_stateJournalFile, ProcessorStateJournal::serializeRecords(m_pendingStateJournalRecords));
+	m_stateJournalRecordCount += int(m_pendingStateJournalRecords.size());
+	m_pendingStateJournalRecords.clear();
+}
+
+bool MemaProcessor::isStateJournalCompactionRequired()
+{
+	return !m_stateJournalValid
+		|| m_stateJournalInputCount != m_inputChannelCount
+		|| m_stateJournalOutputCount != m_outputChannelCount
+		|| m_stateJournalRecordCount + int(m_pendingStateJournalRecords.size()) > s_stateJournalCompactionRecordCount;
+}
+
+bool MemaProcessor::readStateSnapshot(ProcessorStateSnapshot::RoutingState& state)
+{
+	if (!m_stateSnapshotFile.existsAsFile())
+		return false;
+
+	auto stateTime = m_stateSnapshotFile.getLastModificationTime();
+	if (m_stateJournalFile.existsAsFile())
+		stateTime = std::max(stateTime, m_stateJournalFile.getLastModificationTime());
+	auto configFile = juce::File(JUCEAppBasics::AppConfigurationBase::getDefaultConfigFilePath());
+	if (configFile.existsAsFile() && configFile.getLastModificationTime() > stateTime)
+		return false;
+
+	auto snapshotChecksum = std::uint32_t(0);
+	if (!ProcessorStateSnapshot::readFromFile(m_stateSnapshotFile, m_inputChannelCount, m_outputChannelCount, state, &snapshotChecksum))
+		return false;
+
+	// a journal of a different snapshot is simply ignored, its changes are older than the snapshot then
+	ProcessorStateJournal::replayFromFile(m_stateJournalFile, m_inputChannelCount, m_outputChannelCount, snapshotChecksum, state);
+
+	return true;
+}
+
+void MemaProcessor::initialiseAudioDevice(const juce::XmlElement* deviceSetupXml)
+{
+	auto result = juce::String();
+	if (nullptr != deviceSetupXml)
+	{
+		// A saved setup is opened directly, that also takes it as the device manager's internal xml.
+		// Only if it is unavailable, the device manager falls back to the system default device.
+		result = m_deviceManager->initialise(s_maxChannelCount, s_maxChannelCount, deviceSetupXml, true);
+	}
+	else
+	{
+		// Hacky bit of device manager initialization:
+		// We first intialize it to be able to get a valid device setup,
+		// then initialize with a dummy xml config to trigger the internal xml structure being reset
+		// and finally apply the original initialized device setup again to have the audio running correctly.
+		// If we did not do so, either the internal xml would not be present as long as the first configuration change was made
+		// and therefor no valid config file could be written by the application or the audio would not be running
+		// on first start and manual config would be required.
+		m_deviceManager->initialiseWithDefaultDevices(s_maxChannelCount, s_maxChannelCount);
+		auto audioDeviceSetup = m_deviceManager->getAudioDeviceSetup();
+		result = m_deviceManager->initialise(s_maxChannelCount, s_maxChannelCount, nullptr, true, {}, &audioDeviceSetup);
+	}
+	if (result.isNotEmpty())
+	{
+		// The saved audio device is unavailable; the device manager has already fallen back
+		// to the system default.  Warn the user but continue with plugin and routing state
+		// from the config — those are independent of which audio device is active and must
+		// not be discarded just because the preferred interface is currently unplugged.
+		juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::WarningIcon, juce::JUCEApplication::getInstance()->getApplicationName() + " device init failed", result);
+	}
+#if JUCE_IOS
+	auto audioDeviceSetup = m_deviceManager->getAudioDeviceSetup();
+	if (audioDeviceSetup.bufferSize < 512)
+		audioDeviceSetup.bufferSize = 512; // temp. workaround for iOS where buffersizes <512 lead to no sample data being delivered?
+	m_deviceManager->setAudioDeviceSetup(audioDeviceSetup, true);
+#endif
+}
+
+void MemaProcessor::logStartupPhase(const juce::String& phase, bool isLastPhase)
+{
+	if (!m_startupPhaseLogActive)
+		return;
+
+	juce::Logger::writeToLog("Startup " + juce::String(juce::Time::getMillisecondCounterHiRes() - m_startupStartMs, 1) + " ms: " + phase);
+
+	if (isLastPhase)
+		m_startupPhaseLogActive = false;
+}
+
+void MemaProcessor::dumpXmlConfiguration()
+{
+	// only the processor part is collected here on the message thread, xml serialisation and disk i/o happen on the writer thread
+	auto config = JUCEAppBasics::AppConfigurationBase::getInstance();
+	if (config != nullptr)
+	{
+		config->setConfigState(createStateXml(), MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::PROCESSORCONFIG));
+		m_configurationFileWriter->write(juce::File(JUCEAppBasics::AppConfigurationBase::getDefaultConfigFilePath()), config->getConfigState(), true);
+	}
+	m_xmlConfigurationDumpPending = false;
+	m_lastXmlConfigurationDumpMs = juce::Time::getMillisecondCounter();
+}
+
 double MemaProcessor::getTailLengthSeconds() const
 {
 	/*dbg*/return 0.0;
@@ -1792,9 +2707,15 @@ void MemaProcessor::audioDeviceIOCallbackWithContext(const float* const* inputCh
 	float* const* outputChannelData, int numOutputChannels, int numSamples, const AudioIODeviceCallbackContext& context)
 {
     ignoreUnused(context);
+
+	auto blockStartTicks = juce::Time::getHighResolutionTicks();
+	m_lastBlockStartTicks.store(blockStartTicks);
     
 	const juce::ScopedLock sl(m_audioDeviceIOCallbackLock);
 
+	m_audioCallbackProfiler.beginCallback(blockStartTicks, numSamples, getSampleRate());
+	m_audioCallbackProfiler.endStage(AudioCallbackProfiler::LockWait);
+
 	if (m_inputChannelCount != numInputChannels || m_outputChannelCount != numOutputChannels)
 	{
 		m_inputChannelCount = numInputChannels;
@@ -1807,6 +2728,7 @@ void MemaProcessor::audioDeviceIOCallbackWithContext(const float* const* inputCh
 	if (s_maxChannelCount < maxActiveChannels)
 	{
 		jassertfalse;
+		m_audioCallbackProfiler.endCallback();
 		return;
 	}
 
@@ -1815,6 +2737,7 @@ void MemaProcessor::audioDeviceIOCallbackWithContext(const float* const* inputCh
 	{
 		memcpy(m_processorChannels[i], inputChannelData[i], (size_t)numSamples * sizeof(float));
 	}
+	m_audioCallbackProfiler.endStage(AudioCallbackProfiler::InputCopy);
 
 	// from juce doxygen: buffer must be the size of max(inCh, outCh) and feeds the input data into the method and is returned with output data
 	juce::AudioBuffer<float> audioBufferToProcess(m_processorChannels, maxActiveChannels, numSamples);
@@ -1830,7 +2753,9 @@ void MemaProcessor::audioDeviceIOCallbackWithContext(const float* const* inputCh
 	{
 		memcpy(outputChannelData[i], processedData[i], (size_t)processedSampleCount * sizeof(float));
 	}
+	m_audioCallbackProfiler.endStage(AudioCallbackProfiler::OutputCopy);
 
+	m_audioCallbackProfiler.endCallback();
 }
 
 void MemaProcessor::audioDeviceAboutToStart(AudioIODevice* device)
@@ -1853,6 +2778,9 @@ void MemaProcessor::audioDeviceAboutToStart(AudioIODevice* device)
 
 void MemaProcessor::audioDeviceStopped()
 {
+	m_lastBlockStartTicks.store(0);
+	m_audioCallbackProfiler.deviceStopped();
+
 	releaseResources();
 }
 
@@ -1877,28 +2805,33 @@ void MemaProcessor::initializeCtrlValues(int inputCount, int outputCount)
 		matrixCrosspointStates = m_matrixCrosspointStates;
 	}
 
+	// complete the copies to the current channel counts, so every commander gets the whole state in one call
 	auto inputChannelCount = std::uint16_t((inputCount > s_minInputsCount) ? inputCount : s_minInputsCount);
-	for (std::uint16_t channel = 1; channel <= inputChannelCount; channel++)
-		for (auto& inputCommander : m_inputCommanders)
-			inputCommander->setInputMute(channel, inputMuteStates[channel]);
-
 	auto outputChannelCount = std::uint16_t((outputCount > s_minOutputsCount) ? outputCount : s_minOutputsCount);
+	std::map<std::uint16_t, bool> ctrlInputMuteStates;
+	for (std::uint16_t channel = 1; channel <= inputChannelCount; channel++)
+		ctrlInputMuteStates[channel] = inputMuteStates[channel];
+	std::map<std::uint16_t, bool> ctrlOutputMuteStates;
 	for (std::uint16_t channel = 1; channel <= outputChannelCount; channel++)
-		for (auto& outputCommander : m_outputCommanders)
-			outputCommander->setOutputMute(channel, outputMuteStates[channel]);
-
+		ctrlOutputMuteStates[channel] = outputMuteStates[channel];
+	std::map<std::uint16_t, std::map<std::uint16_t, bool>> ctrlCrosspointStates;
+	std::map<std::uint16_t, std::map<std::uint16_t, float>> ctrlCrosspointValues;
 	for (std::uint16_t in = 1; in <= inputChannelCount; in++)
 	{
 		for (std::uint16_t out = 1; out <= outputChannelCount; out++)
 		{
-			for (auto& crosspointCommander : m_crosspointCommanders)
-			{
-				crosspointCommander->setCrosspointEnabledValue(in, out, matrixCrosspointStates[in][out]);
-				crosspointCommander->setCrosspointFactorValue(in, out, matrixCrosspointValues[in][out]);
-			}
+			ctrlCrosspointStates[in][out] = matrixCrosspointStates[in][out];
+			ctrlCrosspointValues[in][out] = matrixCrosspointValues[in][out];
 		}
 	}
 
+	for (auto& inputCommander : m_inputCommanders)
+		inputCommander->setInputMutes(ctrlInputMuteStates);
+	for (auto& outputCommander : m_outputCommanders)
+		outputCommander->setOutputMutes(ctrlOutputMuteStates);
+	for (auto& crosspointCommander : m_crosspointCommanders)
+		crosspointCommander->setCrosspointValues(ctrlCrosspointStates, ctrlCrosspointValues);
+
 	juce::Array<juce::AudioProcessorParameter*> pluginParameters;
 	juce::String pluginName;
 	if (m_pluginInstance)
@@ -1915,30 +2848,47 @@ void MemaProcessor::initializeCtrlValues(int inputCount, int outputCount)
 
 void MemaProcessor::initializeCtrlValuesToUnity(int inputCount, int outputCount)
 {
-	{
-		const ScopedLock sl(m_audioDeviceIOCallbackLock);
-		m_inputMuteStates.clear();
-		m_outputMuteStates.clear();
-		m_matrixCrosspointStates.clear();
-		m_matrixCrosspointValues.clear();
-	}
+	std::map<std::uint16_t, bool> inputMuteStates;
+	std::map<std::uint16_t, bool> outputMuteStates;
+	std::map<std::uint16_t, std::map<std::uint16_t, bool>> matrixCrosspointStates;
+	std::map<std::uint16_t, std::map<std::uint16_t, float>> matrixCrosspointValues;
 
 	auto inputChannelCount = (inputCount > s_minInputsCount) ? inputCount : s_minInputsCount;
 	for (std::uint16_t channel = 1; channel <= inputChannelCount; channel++)
-		setInputMuteState(channel, false);
+		inputMuteStates[channel] = false;
     
     auto outputChannelCount = (outputCount > s_minOutputsCount) ? outputCount : s_minOutputsCount;
     for (std::uint16_t channel = 1; channel <= outputChannelCount; channel++)
-        setOutputMuteState(channel, false);
+        outputMuteStates[channel] = false;
 
     for (std::uint16_t in = 1; in <= inputChannelCount; in++)
 	{
 		for (std::uint16_t out = 1; out <= outputChannelCount; out++)
 		{
-			setMatrixCrosspointEnabledValue(in, out, in == out);
-			setMatrixCrosspointFactorValue(in, out, 1.0f);
+			matrixCrosspointStates[in][out] = (in == out);
+			matrixCrosspointValues[in][out] = 1.0f;
 		}
 	}
+
+	{
+		const ScopedLock sl(m_audioDeviceIOCallbackLock);
+		m_inputMuteStates = inputMuteStates;
+		m_outputMuteStates = outputMuteStates;
+		m_matrixCrosspointStates = matrixCrosspointStates;
+		m_matrixCrosspointValues = matrixCrosspointValues;
+	}
+
+	for (auto const& inputCommander : m_inputCommanders)
+		inputCommander->setInputMutes(inputMuteStates);
+	for (auto const& outputCommander : m_outputCommanders)
+		outputCommander->setOutputMutes(outputMuteStates);
+	for (auto const& crosspointCommander : m_crosspointCommanders)
+		crosspointCommander->setCrosspointValues(matrixCrosspointStates, matrixCrosspointValues);
+
+	// the state was replaced as a whole, the next dumper tick writes a new snapshot instead of journaling every node
+	m_stateJournalValid = false;
+	m_pendingStateJournalRecords.clear();
+	setTimedConfigurationDumpPending();
 }
 
 void MemaProcessor::initializeCtrlValuesToUnity()
@@ -23,6 +23,15 @@
 #include "MemaMessages.h"
 #include "ProcessorDataAnalyzer.h"
 #include "MemaPluginParameterInfo.h"
+#include "MemaPluginParameterChangeQueue.h"
+#include "InputPositionPanner.h"
+#include "ProcessorStateSnapshot.h"
+#include "ProcessorStateJournal.h"
+#include "AsyncFileWriter.h"
+#include "AudioCallbackProfiler.h"
+#include "InterprocessConnection.h"
+#include "MetricsEndpoint.h"
+#include "MemaSceneStore.h"
 #include "../MemaProcessorEditor/MemaProcessorEditor.h"
 #include "../MemaAppConfiguration.h"
 
@@ -95,6 +104,42 @@ public:
     virtual ~PluginParameterInfosChangedMessage() = default;
 };
 
+//==============================================================================
+/**
+ * @class DeferredDeviceInitialisationMessage
+ * @brief Internal JUCE message that opens the audio device once the processor construction has returned.
+ *
+ * @details Posted by `MemaProcessor::setStateXml()` during startup, so the network server and the
+ * last known routing state are up before the (potentially slow) audio device open blocks the
+ * message thread.  Carries a copy of the `<DEVICESETUP>` element to open, if any.
+ */
+class DeferredDeviceInitialisationMessage : public juce::Message
+{
+public:
+    explicit DeferredDeviceInitialisationMessage(std::unique_ptr<juce::XmlElement> deviceSetupXml) : m_deviceSetupXml(std::move(deviceSetupXml)) {};
+    virtual ~DeferredDeviceInitialisationMessage() = default;
+
+    const juce::XmlElement* getDeviceSetupXml() const { return m_deviceSetupXml.get(); };
+
+private:
+    std::unique_ptr<juce::XmlElement> m_deviceSetupXml;
+};
+
+/**
+ * @class DeferredPluginInstantiationMessage
+ * @brief Internal JUCE message that instantiates the plug-in of the startup configuration.
+ *
+ * @details Posted after `DeferredDeviceInitialisationMessage`, so the plug-in is created for the sample
+ * rate and block size of the opened device.  The plug-in config to apply is kept by the processor
+ * itself, a config reload before this message is handled only replaces it.
+ */
+class DeferredPluginInstantiationMessage : public juce::Message
+{
+public:
+    DeferredPluginInstantiationMessage() = default;
+    virtual ~DeferredPluginInstantiationMessage() = default;
+};
+
 /**
  * @class MemaProcessor
  * @brief Core audio processor — owns the AudioDeviceManager, routing matrix, plugin host, and IPC server.
@@ -142,6 +187,8 @@ public:
  * - Plugin processing: additionally protected by `m_pluginProcessingLock`.
  * - Network / message dispatch: `handleMessage()` runs on the JUCE message thread.
  * - Plugin parameter changes: `parameterValueChanged()` runs on whichever thread the plugin calls it from; posted to the message thread.
+ * - Plugin parameter automation: `setPluginParameterValue()` pushes into the lock-free `m_pluginParameterChangeQueue`,
+ *   which the audio thread drains at block start and applies at the respective sample offsets.
  *
  * @see MemaMessages.h — all TCP message types.
  * @see ProcessorDataAnalyzer — level/spectrum analysis fed by the audio callback.
@@ -157,6 +204,9 @@ class MemaProcessor : public juce::AudioProcessor,
 public:
     /**
      * @brief Constructs the processor, optionally restoring state from XML.
+     * @details Network server, service announcement and the last known routing state are up when the
+     *          constructor returns, the audio device is opened and the plug-in instantiated right after,
+     *          from the message loop.  Startup phase timings are written to the log.
      * @param stateXml Pointer to a previously serialised `<PROCESSORCONFIG>` XML element,
      *                 or `nullptr` to start with default (unity gain) crosspoint values.
      */
@@ -279,6 +329,51 @@ public:
      */
     void setMatrixCrosspointFactorValue(std::uint16_t inputNumber, std::uint16_t outputNumber, float factor, MemaChannelCommander* sender = nullptr, int userId = -1);
 
+    /**
+     * @brief Sets the output speaker layout object positions of @p layoutId are panned across.
+     * @param layerLayouts Panned and silenced outputs per layer, replacing all previous layers of @p layoutId.
+     * @param layoutId     Connection-id of the client the layout belongs to (-1 = local).
+     */
+    void setObjectPanningLayout(const std::map<int, InputPositionPanner::LayerLayout>& layerLayouts, int layoutId = -1);
+    /**
+     * @brief Pans a batch of input object positions to crosspoint gains on the server.
+     * @details All positions are evaluated in one pass by the `InputPositionPanner` of @p layoutId, the
+     *          resulting crosspoint states and gains of all affected nodes are then written under a single
+     *          `m_audioDeviceIOCallbackLock` acquisition, so the whole batch takes effect in the same audio block.
+     *          Positions on layers without layout are ignored.
+     * @param inputPositions Latest position per moved input.
+     * @param layoutId       Layout to pan with, see setObjectPanningLayout.
+     * @param sender         Commander that triggered the change, or `nullptr`.
+     * @param userId         Originating TCP client connection-id for echo-suppression (-1 = local).
+     */
+    void setObjectPositions(const std::vector<InputPositionPanner::InputPosition>& inputPositions, int layoutId = -1, MemaChannelCommander* sender = nullptr, int userId = -1);
+
+    //==============================================================================
+    /**
+     * @brief Stores the current mutes, crosspoints and plug-in parameter values as scene.
+     * @param sceneId Id to store the scene under, replacing an existing one; a value < 1 overwrites the scene
+     *                of the same name if there is one, otherwise picks the next free id.
+     * @param name    Scene name, an empty name is replaced by "Scene <id>".
+     * @return The id the scene was stored under, -1 if the scene store is full or the name is taken by another scene.
+     */
+    int storeScene(int sceneId, const juce::String& name);
+    /**
+     * @brief Recalls a stored scene.
+     * @details The new mutes and crosspoint maps are built off the audio thread and swapped in under a single
+     *          `m_audioDeviceIOCallbackLock` acquisition, so the whole scene takes effect in the same audio block.
+     *          With @p crossfadeMs > 0 the crosspoint gains are ramped from their current to the scene values in
+     *          `processBlock`, mutes always switch instantly.  Channels the scene does not cover keep their state.
+     *          Commanders, including the connected clients, receive the changed nodes through one bulk call per interface.
+     * @param sceneId     Id of the scene to recall.
+     * @param crossfadeMs Crossfade time in milliseconds, 0 for an instant switch.
+     * @return False if there is no scene with @p sceneId.
+     */
+    bool recallScene(int sceneId, int crossfadeMs = 0);
+    /** @brief Removes a stored scene. @return False if there is no scene with @p sceneId. */
+    bool removeScene(int sceneId);
+    /** @brief Returns id and name of all stored scenes, ordered by id. */
+    std::vector<std::pair<std::uint16_t, juce::String>> getSceneList() const;
+
     /**
      * @brief Returns the current normalised value of a hosted plugin parameter.
      * @param pluginParameterIndex Zero-based parameter index within the plugin's parameter list.
@@ -287,6 +382,10 @@ public:
     float getPluginParameterValue(std::uint16_t pluginParameterIndex) const;
     /**
      * @brief Sets a hosted plugin parameter to a normalised value.
+     * @details The value is not applied synchronously but handed over to the audio thread through the
+     *          lock-free `m_pluginParameterChangeQueue`.  The audio thread applies it at the start of the next
+     *          block, at a sample offset that mirrors the arrival time relative to the previous block start.
+     *          If no audio is currently being processed, the value is applied directly.
      * @param pluginParameterIndex Zero-based parameter index.
      * @param id                   Stable string ID used for cross-session safety.
      * @param normalizedValue      Normalised value in [0, 1].
@@ -330,6 +429,14 @@ public:
      * @return `true` on success, `false` if the plugin could not be loaded.
      */
     bool setPlugin(const juce::PluginDescription& pluginDescription);
+    /**
+     * @brief Loads a plugin like setPlugin, but through the asynchronous instantiation of its format.
+     * @details Formats that support it are created off the message thread, others are created synchronously.
+     *          A setPlugin or setPluginAsync call made before the instance arrives supersedes the request.
+     * @param pluginDescription The JUCE plugin description.
+     * @param onPluginLoaded    Invoked on the message thread with the load result, not invoked if the request was superseded.
+     */
+    void setPluginAsync(const juce::PluginDescription& pluginDescription, std::function<void(bool)> onPluginLoaded = nullptr);
     /** @brief Returns the JUCE description of the currently loaded plugin. */
     juce::PluginDescription getPluginDescription();
     /** @brief Enables or disables plugin processing without unloading the plugin instance. @param enabled Pass `true` to enable, `false` to bypass. */
@@ -353,6 +460,13 @@ public:
     // Parameter management
     /** @brief Returns a mutable reference to the loaded plugin's parameter descriptor list. @return An empty vector if no plugin is loaded. */
     std::vector<PluginParameterInfo>& getPluginParameterInfos();
+    /**
+     * @brief Constant time lookup of a single parameter descriptor.
+     * @details The descriptor list is built in the plugin's parameter order, so the parameter index doubles as the vector position.
+     * @param parameterIndex Zero-based parameter index.
+     * @return `nullptr` if no plugin is loaded or the index is out of range.
+     */
+    PluginParameterInfo* getPluginParameterInfo(int parameterIndex);
     /**
      * @brief Marks a plugin parameter as remotely controllable (or not) and sets its control widget type.
      * @param pluginParameterIndex Zero-based parameter index.
@@ -388,6 +502,20 @@ public:
      *         Used by `MemaUIComponent` to update the network health bar.
      */
     std::map<int, std::pair<double, bool>> getNetworkHealth();
+    /** @brief Returns the send statistics per connected client and message type, see InterprocessConnectionServerImpl::getTelemetry. Safe to call from any thread. */
+    std::vector<InterprocessConnectionServerImpl::ConnectionTelemetry> getNetworkTelemetry() const;
+
+    //==============================================================================
+    /** @brief Returns the network telemetry and audio callback timings in the Prometheus text exposition format. Safe to call from any thread. */
+    juce::String getMetricsText() const;
+    /** @brief Starts serving getMetricsText on http://127.0.0.1:@p port/metrics, returns false if the port cannot be bound. */
+    bool startMetricsEndpoint(int port);
+
+    //==============================================================================
+    /** @brief Returns the audio callback timings since the last reset, see AudioCallbackProfiler. */
+    AudioCallbackProfiler::Snapshot getAudioCallbackProfile() const;
+    /** @brief Clears the audio callback timings, effective with the next audio callback. */
+    void resetAudioCallbackProfile();
 
     //==============================================================================
     /** @brief Returns the most recent multicast service topology snapshot from `ServiceTopologyManager`. */
@@ -470,8 +598,13 @@ public:
      * @brief Dispatches JUCE messages posted to the message thread.
      * @details Handles:
      * - `ControlParametersMessage` — applies remote mute/crosspoint changes from Mema.Re.
+     * - `PanningLayoutMessage` — stores the speaker layout the sending client pans across.
+     * - `ObjectPositionsMessage` — pans the received object positions to crosspoints, see setObjectPositions.
      * - `PluginParameterValueMessage` — applies a single remote plugin parameter change.
+     * - `PluginParameterValuesMessage` — applies a batch of remote plugin parameter changes.
+     * - `PluginParameterSubscriptionMessage` — restricts the parameter value updates relayed to the sending client.
      * - `PluginParameterInfosChangedMessage` — broadcasts updated parameter descriptors to clients.
+     * - `SceneRecallMessage` / `SceneStoreMessage` — recall or store a scene, see recallScene and storeScene.
      * @param message The message to handle.
      */
     void handleMessage(const Message& message) override;
@@ -525,9 +658,13 @@ public:
     static constexpr int s_minOutputsCount = 1;     ///< Minimum number of output channels (always at least 1).
 
     //==============================================================================
-    /** @brief Returns `true` when a deferred XML configuration dump has been scheduled. */
+    /** @brief Returns `true` when a deferred configuration dump has been scheduled. */
     bool isTimedConfigurationDumpPending() { return m_timedConfigurationDumpPending; };
-    /** @brief Schedules a deferred XML configuration dump (called on state change to avoid excessive disk I/O). */
+    /**
+     * @brief Schedules a deferred configuration dump (called on state change to avoid excessive disk I/O).
+     * @details Routing changes are appended to the binary state journal on the next dumper tick, the full
+     *          XML configuration follows at most every `s_xmlConfigurationDumpInterval` milliseconds.
+     */
     void setTimedConfigurationDumpPending() { m_timedConfigurationDumpPending = true; };
     /** @brief Clears the deferred dump flag after the dump has been performed. */
     void resetTimedConfigurationDumpPending() { m_timedConfigurationDumpPending = false; };
@@ -544,6 +681,41 @@ protected:
 private:
     //==============================================================================
     void sendMessageToClients(const MemoryBlock& messageMemoryBlock, const std::vector<int>& sendIds);
+    /** @brief Sends the current scene list to all connected clients. */
+    void sendSceneListToClients();
+    /** @brief Posts the current audio callback timings, relayed to the clients that subscribed to them. */
+    void sendAudioCallbackProfileToClients();
+
+    //==============================================================================
+    /** @brief Queues the current mutes and crosspoints to be written to `m_stateSnapshotFile` and starts a new journal for it (compaction). */
+    void writeStateSnapshot();
+    /** @brief Collects @p record to be appended to the state journal on the next dumper tick. */
+    void addStateJournalRecord(const ProcessorStateJournal::Record& record);
+    /** @brief Queues the collected journal records to be appended to `m_stateJournalFile`. */
+    void appendStateJournal();
+    /** @brief Returns true if the journal cannot (or should no longer) be continued and a new snapshot has to be written instead. */
+    bool isStateJournalCompactionRequired();
+    /**
+     * @brief Reads the routing state from `m_stateSnapshotFile` into @p state and replays `m_stateJournalFile` on top of it.
+     * @return False if there is no valid snapshot for the current channel counts, or if the XML config file was written after snapshot and journal.
+     */
+    bool readStateSnapshot(ProcessorStateSnapshot::RoutingState& state);
+    /** @brief Updates the processor part of the app configuration and queues the full XML configuration to be written in the background. */
+    void dumpXmlConfiguration();
+
+    //==============================================================================
+    /**
+     * @brief Opens the audio device.
+     * @details A saved @p deviceSetupXml is opened directly, falling back to the default device if that fails.
+     *          Without a saved setup the default devices are initialised, which also creates the device manager's internal xml.
+     */
+    void initialiseAudioDevice(const juce::XmlElement* deviceSetupXml);
+    /** @brief Replaces the hosted plugin by @p pluginInstance (may be null if loading failed) and reports the result. */
+    bool applyPluginInstance(std::unique_ptr<juce::AudioPluginInstance> pluginInstance, const juce::PluginDescription& pluginDescription, const juce::String& errorMessage);
+    /** @brief Applies plugin state, parameter display order and parameter values of a `<PLUGINCONFIG>` element to the hosted plugin. */
+    void restorePluginConfig(const juce::XmlElement& pluginConfigXml);
+    /** @brief Logs @p phase with the time since construction, until @p isLastPhase ends the startup log. */
+    void logStartupPhase(const juce::String& phase, bool isLastPhase = false);
 
     //==============================================================================
     /**
@@ -555,6 +727,26 @@ private:
      */
     void configurePluginForCurrentPosition();
 
+    //==============================================================================
+    /**
+     * @brief Runs the hosted plugin on the given buffer, applying the parameter changes drained for this block.
+     * @details The block is split into sub-blocks at the (granularity-quantised) sample offsets of the pending
+     *          changes, so that each change becomes effective at its position within the block.  Every
+     *          sub-block only receives the MIDI events within its range, relative to its own start, the
+     *          MIDI the plugin produces is collected back into @p midiMessages at block positions.
+     * @note Must be called under m_pluginProcessingLock on the audio thread.
+     */
+    void processPluginBlock(juce::AudioBuffer<float>& pluginBuffer, juce::MidiBuffer& midiMessages);
+    /** @brief Applies all pending changes in m_pluginParameterChangesForBlock at once. @note Must be called under m_pluginProcessingLock. */
+    void applyPendingPluginParameterChanges();
+    /** @brief Applies a single drained parameter change to the hosted plugin. @note Must be called under m_pluginProcessingLock. */
+    void applyPluginParameterChange(const PluginParameterChangeQueue::Change& change);
+    /**
+     * @brief Derives the sample offset for a parameter change arriving now, relative to the most recent audio block start.
+     * @return The offset in [0, blockSize), or -1 if the audio callback is currently not running.
+     */
+    int getPluginParameterChangeSampleOffset() const;
+
     //==============================================================================
     juce::String    m_Name; ///< Processor name string returned by getName().
 
@@ -588,21 +780,49 @@ private:
     std::map<std::uint16_t, std::map<std::uint16_t, bool>>  m_matrixCrosspointStates; ///< Crosspoint enable matrix [in][out] → bool.
     std::map<std::uint16_t, std::map<std::uint16_t, float>>  m_matrixCrosspointValues; ///< Crosspoint linear gain matrix [in][out] → float.
 
+    //==============================================================================
+    SceneStore          m_sceneStore; ///< Stored scenes, persisted with the processor config.
+    std::vector<float>  m_sceneCrossfadeFromGains; ///< Row-major inputs x outputs effective gains a scene crossfade starts from.
+    int                 m_sceneCrossfadeOutputCount = 0; ///< Output count m_sceneCrossfadeFromGains was taken for.
+    int                 m_sceneCrossfadeLength = 0; ///< Length of the running scene crossfade in samples (0 = none).
+    int                 m_sceneCrossfadePosition = 0; ///< Samples of the running scene crossfade already rendered.
+
+    //==============================================================================
+    std::map<int, std::unique_ptr<InputPositionPanner>>  m_objectPanners; ///< Server-side panning engine per layout-id (client connection-id, -1 = local).
+    std::vector<float>                                   m_objectPanningGains; ///< Row-major inputs x outputs gain scratch written by the object panners.
+
     //==============================================================================
     std::unique_ptr<MemaProcessorEditor>  m_processorEditor; ///< The MemaProcessorEditor shown inside MemaUIComponent.
 
     //==============================================================================
     juce::CriticalSection                                           m_pluginProcessingLock; ///< Mutex protecting plugin load/unload from the audio thread.
+    juce::AudioPluginFormatManager                                  m_pluginFormatManager; ///< Registered plugin formats, set up once and kept for asynchronous instantiation.
     std::unique_ptr<juce::AudioPluginInstance>                      m_pluginInstance; ///< The hosted AudioPluginInstance (null if no plugin is loaded).
+    int                                                             m_pluginLoadRequestId = 0; ///< Incremented per plugin load, an asynchronously created instance is dropped if it no longer matches.
+    std::unique_ptr<juce::XmlElement>                               m_deferredPluginConfigXml; ///< `<PLUGINCONFIG>` of the startup configuration, waiting for DeferredPluginInstantiationMessage.
     bool                                                            m_pluginEnabled = false; ///< Whether plugin processing is active (false = bypass).
     bool                                                            m_pluginPost = false; ///< True = plugin inserted post-matrix; false = pre-matrix.
     int                                                             m_pluginConfiguredChannelCount{ 0 }; ///< Actual channel count the plugin was prepared with after bus layout negotiation.
     std::unique_ptr<ResizeableWindowWithTitleBarAndCloseCallback>   m_pluginEditorWindow; ///< Floating window hosting the plugin's editor UI.
     std::vector<PluginParameterInfo>                                m_pluginParameterInfos; ///< Cached parameter descriptor list for the loaded plugin.
     std::vector<int>                                                m_pluginParameterDisplayOrder; ///< User-defined display order: each element is a parameter index. Empty = natural order.
+    PluginParameterChangeQueue                                      m_pluginParameterChangeQueue; ///< Lock-free queue carrying parameter changes from the message thread to the audio thread.
+    std::vector<PluginParameterChangeQueue::Change>                 m_pluginParameterChangesForBlock; ///< Preallocated audio thread list of the changes drained for the current block.
+    juce::MidiBuffer                                                m_pluginSubBlockMidi; ///< Preallocated MIDI events of the current plugin sub-block, see processPluginBlock.
+    juce::MidiBuffer                                                m_pluginBlockMidiOutput; ///< Preallocated MIDI output of all plugin sub-blocks of the current block.
+    static constexpr int                                            s_pluginMidiBufferSize = 4096; ///< Bytes preallocated for the plugin sub-block MIDI buffers.
+    std::atomic<juce::int64>                                        m_lastBlockStartTicks{ 0 }; ///< High resolution tick count of the most recent audio block start (0 = audio not running).
+    static constexpr int                                            s_pluginParameterChangeGranularity = 32; ///< Sub-block granularity in samples used when splitting plugin processing at parameter change offsets.
+    AudioCallbackProfiler                                           m_audioCallbackProfiler; ///< Per-stage timings, deadline histogram and xrun count of the audio callback.
+    std::unique_ptr<juce::TimedCallback>                            m_audioCallbackProfileSender; ///< Periodic callback sending the audio callback timings to clients.
+    static constexpr int                                            s_audioCallbackProfileSendInterval = 1000; ///< Interval in ms between AudioCallbackProfileMessages.
+    std::unique_ptr<MetricsEndpoint>                                m_metricsEndpoint; ///< Optional local Prometheus endpoint, see startMetricsEndpoint.
 
     //==============================================================================
     std::unique_ptr<juce::XmlElement> m_lastAppliedDeviceConfigXml; ///< Snapshot of the DEVCONFIG XML from the most recent successful audio device initialisation. Used to suppress redundant re-inits when only non-audio settings change.
+    bool    m_deferredStartupPending = true; ///< True until the deferred device initialisation ran, see DeferredDeviceInitialisationMessage.
+    double  m_startupStartMs = 0.0; ///< High resolution millisecond counter at construction, reference for the startup phase log.
+    bool    m_startupPhaseLogActive = true; ///< True while startup phases are logged.
 
     //==============================================================================
     std::unique_ptr<JUCEAppBasics::ServiceTopologyManager>  m_serviceTopologyManager; ///< Manages multicast service announcements so Mema.Mo/Re can discover this instance.
@@ -612,7 +832,20 @@ private:
 
     std::unique_ptr<juce::TimedCallback>   m_timedConfigurationDumper; ///< Periodic callback that flushes pending XML configuration dumps to disk.
     bool    m_timedConfigurationDumpPending = false; ///< True when a configuration dump has been scheduled but not yet written.
-
+    bool    m_xmlConfigurationDumpPending = false; ///< True when the routing snapshot is ahead of the XML configuration on disk.
+    juce::uint32    m_lastXmlConfigurationDumpMs = 0; ///< Millisecond counter of the last XML configuration dump.
+    static constexpr juce::uint32 s_xmlConfigurationDumpInterval = 5000; ///< Minimum interval in ms between timed XML configuration dumps.
+    juce::File  m_stateSnapshotFile; ///< Binary routing state snapshot used for fast autosave and restore, see ProcessorStateSnapshot.
+    juce::File  m_stateJournalFile; ///< Append-only journal of the routing changes since the last snapshot, see ProcessorStateJournal.
+    std::vector<ProcessorStateJournal::Record> m_pendingStateJournalRecords; ///< Routing changes not yet queued for the journal.
+    bool    m_stateJournalValid = false; ///< True while snapshot plus journal on disk lead to the current routing state.
+    int     m_stateJournalRecordCount = 0; ///< Number of records in the journal since the last compaction.
+    int     m_stateJournalInputCount = 0; ///< Input count the current journal was started for.
+    int     m_stateJournalOutputCount = 0; ///< Output count the current journal was started for.
+    static constexpr int s_stateJournalCompactionRecordCount = 16384; ///< Journal length (256 kB) after which it is compacted into a new snapshot.
+    std::unique_ptr<AsyncFileWriter>   m_configurationFileWriter; ///< Background writer for the routing snapshot and the timed XML configuration dumps.
+
+    JUCE_DECLARE_WEAK_REFERENCEABLE(MemaProcessor)
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MemaProcessor)
 };
 
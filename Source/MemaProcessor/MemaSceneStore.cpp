@@ -0,0 +1,205 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "MemaSceneStore.h"
+
+#include "../MemaAppConfiguration.h"
+
+namespace Mema
+{
+
+//==============================================================================
+int SceneStore::storeScene(int sceneId, Scene scene)
+{
+    // storing without id under a taken name overwrites that scene in place, so ids held by clients stay valid
+    if (sceneId < 1 && scene.name.isNotEmpty())
+        sceneId = getSceneId(scene.name);
+    if (sceneId < 1)
+    {
+        sceneId = m_scenes.empty() ? 1 : m_scenes.rbegin()->first + 1;
+        if (sceneId > s_maxSceneId)
+        {
+            // highest id is taken, fall back to the first gap
+            sceneId = 1;
+            while (sceneId <= s_maxSceneId && 0 != m_scenes.count(sceneId))
+                sceneId++;
+        }
+    }
+    if (sceneId > s_maxSceneId)
+        return -1;
+
+    if (scene.name.isEmpty())
+        scene.name = "Scene " + juce::String(sceneId);
+
+    // a name refers to exactly one scene, a name taken by another scene is rejected instead of replacing that one
+    auto nameIter = m_sceneIdsByName.find(scene.name);
+    if (m_sceneIdsByName.end() != nameIter && nameIter->second != sceneId)
+        return -1;
+    auto sceneIter = m_scenes.find(sceneId);
+    if (m_scenes.end() != sceneIter)
+        m_sceneIdsByName.erase(sceneIter->second.name);
+
+    m_sceneIdsByName[scene.name] = sceneId;
+    m_scenes[sceneId] = std::move(scene);
+
+    return sceneId;
+}
+
+bool SceneStore::removeScene(int sceneId)
+{
+    auto sceneIter = m_scenes.find(sceneId);
+    if (m_scenes.end() == sceneIter)
+        return false;
+
+    m_sceneIdsByName.erase(sceneIter->second.name);
+    m_scenes.erase(sceneIter);
+    return true;
+}
+
+void SceneStore::clear()
+{
+    m_scenes.clear();
+    m_sceneIdsByName.clear();
+}
+
+//==============================================================================
+const SceneStore::Scene* SceneStore::getScene(int sceneId) const
+{
+    auto sceneIter = m_scenes.find(sceneId);
+    return m_scenes.end() != sceneIter ? &sceneIter->second : nullptr;
+}
+
+int SceneStore::getSceneId(const juce::String& name) const
+{
+    auto nameIter = m_sceneIdsByName.find(name);
+    return m_sceneIdsByName.end() != nameIter ? nameIter->second : -1;
+}
+
+std::vector<std::pair<std::uint16_t, juce::String>> SceneStore::getSceneList() const
+{
+    std::vector<std::pair<std::uint16_t, juce::String>> sceneList;
+    sceneList.reserve(m_scenes.size());
+    for (auto const& sceneKV : m_scenes)
+        sceneList.push_back({ std::uint16_t(sceneKV.first), sceneKV.second.name });
+    return sceneList;
+}
+
+//==============================================================================
+std::unique_ptr<juce::XmlElement> SceneStore::createStateXml() const
+{
+    auto scenesElm = std::make_unique<juce::XmlElement>(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::SCENES));
+    for (auto const& sceneKV : m_scenes)
+    {
+        auto const& scene = sceneKV.second;
+        auto sceneElm = std::make_unique<juce::XmlElement>(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::SCENE));
+        sceneElm->setAttribute(MemaAppConfiguration::getAttributeName(MemaAppConfiguration::AttributeID::ID), sceneKV.first);
+        sceneElm->setAttribute(MemaAppConfiguration::getAttributeName(MemaAppConfiguration::AttributeID::NAME), scene.name);
+
+        juce::StringArray imutestatestr;
+        for (auto const& mutestate : scene.routing.inputMuteStates)
+            imutestatestr.add(juce::String(mutestate.first) + "," + juce::String(mutestate.second ? 1 : 0));
+        sceneElm->createNewChildElement(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::INPUTMUTES))->addTextElement(imutestatestr.joinIntoString(";"));
+
+        juce::StringArray omutestatestr;
+        for (auto const& mutestate : scene.routing.outputMuteStates)
+            omutestatestr.add(juce::String(mutestate.first) + "," + juce::String(mutestate.second ? 1 : 0));
+        sceneElm->createNewChildElement(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::OUTPUTMUTES))->addTextElement(omutestatestr.joinIntoString(";"));
+
+        juce::StringArray cgainstatestr;
+        for (auto const& insKV : scene.routing.crosspointStates)
+        {
+            auto valuesIter = scene.routing.crosspointValues.find(insKV.first);
+            for (auto const& outsKV : insKV.second)
+            {
+                auto value = 0.0f;
+                if (scene.routing.crosspointValues.end() != valuesIter && 0 != valuesIter->second.count(outsKV.first))
+                    value = valuesIter->second.at(outsKV.first);
+                cgainstatestr.add(juce::String(insKV.first) + "," + juce::String(outsKV.first) + "," + juce::String(outsKV.second ? 1 : 0) + "," + juce::String(value)); // "in,out,enabled,gain;"
+            }
+        }
+        sceneElm->createNewChildElement(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::CROSSPOINTGAINS))->addTextElement(cgainstatestr.joinIntoString(";"));
+
+        juce::StringArray paramvaluestr;
+        for (auto const& parameterValue : scene.pluginParameterValues)
+            paramvaluestr.add(juce::String(parameterValue.first) + "," + juce::String(parameterValue.second)); // "idx,value;"
+        sceneElm->createNewChildElement(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::PLUGINPARAMVALUES))->addTextElement(paramvaluestr.joinIntoString(";"));
+
+        scenesElm->addChildElement(sceneElm.release());
+    }
+
+    return scenesElm;
+}
+
+bool SceneStore::setStateXml(const juce::XmlElement* stateXml)
+{
+    clear();
+
+    if (nullptr == stateXml)
+        return true;
+    if (stateXml->getTagName() != MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::SCENES))
+    {
+        jassertfalse;
+        return false;
+    }
+
+    // helper to split "a,b;c,d;..." texts of a scene child element into their comma separated tokens
+    auto forEachEntry = [](const juce::XmlElement* elm, int tokenCount, const std::function<void(const juce::StringArray&)>& entryHandler) {
+        if (nullptr == elm)
+            return;
+        juce::StringArray entryStrList;
+        entryStrList.addTokens(elm->getAllSubText(), ";", "");
+        for (auto const& entryStr : entryStrList)
+        {
+            juce::StringArray entryStrSplit;
+            entryStrSplit.addTokens(entryStr, ",", "");
+            if (tokenCount == entryStrSplit.size())
+                entryHandler(entryStrSplit);
+        }
+    };
+
+    for (auto* sceneElm : stateXml->getChildWithTagNameIterator(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::SCENE)))
+    {
+        auto sceneId = sceneElm->getIntAttribute(MemaAppConfiguration::getAttributeName(MemaAppConfiguration::AttributeID::ID), -1);
+        if (sceneId < 1 || sceneId > s_maxSceneId)
+            continue;
+
+        auto scene = Scene();
+        scene.name = sceneElm->getStringAttribute(MemaAppConfiguration::getAttributeName(MemaAppConfiguration::AttributeID::NAME));
+        forEachEntry(sceneElm->getChildByName(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::INPUTMUTES)), 2, [&scene](const juce::StringArray& entry) {
+            scene.routing.inputMuteStates[std::uint16_t(entry[0].getIntValue())] = (1 == entry[1].getIntValue());
+        });
+        forEachEntry(sceneElm->getChildByName(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::OUTPUTMUTES)), 2, [&scene](const juce::StringArray& entry) {
+            scene.routing.outputMuteStates[std::uint16_t(entry[0].getIntValue())] = (1 == entry[1].getIntValue());
+        });
+        forEachEntry(sceneElm->getChildByName(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::CROSSPOINTGAINS)), 4, [&scene](const juce::StringArray& entry) {
+            auto in = std::uint16_t(entry[0].getIntValue());
+            auto out = std::uint16_t(entry[1].getIntValue());
+            scene.routing.crosspointStates[in][out] = (1 == entry[2].getIntValue());
+            scene.routing.crosspointValues[in][out] = entry[3].getFloatValue();
+        });
+        forEachEntry(sceneElm->getChildByName(MemaAppConfiguration::getTagName(MemaAppConfiguration::TagID::PLUGINPARAMVALUES)), 2, [&scene](const juce::StringArray& entry) {
+            scene.pluginParameterValues[std::uint16_t(entry[0].getIntValue())] = entry[1].getFloatValue();
+        });
+
+        storeScene(sceneId, std::move(scene));
+    }
+
+    return true;
+}
+
+} // namespace Mema
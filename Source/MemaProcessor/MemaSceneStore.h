@@ -0,0 +1,90 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#include "ProcessorStateSnapshot.h"
+
+namespace Mema
+{
+
+/**
+ * @class SceneStore
+ * @brief Stored scenes of the processor, each a complete set of mutes, crosspoints and plug-in parameter values.
+ *
+ * @details Scenes are kept by numeric id (1..65535) with a secondary name index, so a recall by id or by
+ * name is a single map lookup.  The store only holds the data, applying a scene to the audio path is
+ * done by MemaProcessor::recallScene.  The store is persisted as part of the processor XML config.
+ */
+class SceneStore
+{
+public:
+    /** @brief One stored scene. */
+    struct Scene
+    {
+        juce::String                            name;
+        ProcessorStateSnapshot::RoutingState    routing;                ///< Mutes and crosspoints, 1-based channel numbers.
+        std::map<std::uint16_t, float>          pluginParameterValues;  ///< Normalised value per plug-in parameter index.
+    };
+
+    static constexpr int s_maxSceneId = std::numeric_limits<std::uint16_t>::max();
+
+public:
+    SceneStore() = default;
+    ~SceneStore() = default;
+
+    //==============================================================================
+    /**
+     * @brief Stores @p scene under @p sceneId, replacing a scene with the same id.
+     * @param sceneId   Id to store the scene under, a value < 1 picks the id of the scene with the same
+     *                  name if there is one, otherwise the next free id.
+     * @return The id the scene was stored under, -1 if the store is full or the name is taken by another scene.
+     */
+    int storeScene(int sceneId, Scene scene);
+    /** @brief Removes the scene with @p sceneId, returns false if there is none. */
+    bool removeScene(int sceneId);
+    /** @brief Removes all scenes. */
+    void clear();
+
+    //==============================================================================
+    /** @brief Returns the scene with @p sceneId or nullptr. The pointer is valid until the store is modified. */
+    const Scene* getScene(int sceneId) const;
+    /** @brief Returns the id of the scene named @p name, -1 if there is none. */
+    int getSceneId(const juce::String& name) const;
+    /** @brief Returns id and name of all scenes, ordered by id. */
+    std::vector<std::pair<std::uint16_t, juce::String>> getSceneList() const;
+    /** @brief Returns true if no scene is stored. */
+    bool isEmpty() const { return m_scenes.empty(); };
+
+    //==============================================================================
+    /** @brief Creates the SCENES config element, in the same text formats as the live processor state. */
+    std::unique_ptr<juce::XmlElement> createStateXml() const;
+    /** @brief Replaces all scenes with the ones in the SCENES config element @p stateXml, nullptr clears the store. */
+    bool setStateXml(const juce::XmlElement* stateXml);
+
+private:
+    //==============================================================================
+    std::map<int, Scene>            m_scenes;           ///< Scenes by id.
+    std::map<juce::String, int>     m_sceneIdsByName;   ///< Secondary index, scene name to id.
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SceneStore)
+};
+
+} // namespace Mema
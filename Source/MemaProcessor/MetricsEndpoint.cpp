@@ -0,0 +1,127 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "MetricsEndpoint.h"
+
+namespace Mema
+{
+
+//==============================================================================
+MetricsEndpoint::MetricsEndpoint(MetricsProvider metricsProvider)
+    : juce::Thread("MemaMetricsEndpoint"), m_metricsProvider(std::move(metricsProvider))
+{
+}
+
+MetricsEndpoint::~MetricsEndpoint()
+{
+    stop();
+}
+
+//==============================================================================
+bool MetricsEndpoint::start(int port)
+{
+    stop();
+
+    auto listener = std::make_unique<juce::StreamingSocket>();
+    if (!listener->createListener(port, "127.0.0.1"))
+    {
+        DBG(juce::String(__FUNCTION__) << " failed to listen on port " << port);
+        return false;
+    }
+
+    m_listener = std::move(listener);
+    m_port = port;
+    startThread(juce::Thread::Priority::background);
+    return true;
+}
+
+void MetricsEndpoint::stop()
+{
+    stopThread(s_pollInterval + s_requestTimeout);
+
+    if (m_listener)
+        m_listener->close();
+    m_listener.reset();
+    m_port = -1;
+}
+
+//==============================================================================
+void MetricsEndpoint::run()
+{
+    while (!threadShouldExit())
+    {
+        // poll instead of blocking in accept, so the thread notices when it shall exit
+        if (1 != m_listener->waitUntilReady(true, s_pollInterval))
+            continue;
+
+        auto connection = std::unique_ptr<juce::StreamingSocket>(m_listener->waitForNextConnection());
+        if (connection)
+            handleConnection(*connection);
+    }
+}
+
+void MetricsEndpoint::handleConnection(juce::StreamingSocket& connection)
+{
+    auto request = juce::MemoryBlock();
+    auto buffer = std::array<char, 1024>();
+    while (!threadShouldExit() && request.getSize() < size_t(s_maxRequestSize))
+    {
+        if (1 != connection.waitUntilReady(true, s_requestTimeout))
+            return;
+        auto bytesRead = connection.read(buffer.data(), int(buffer.size()), false);
+        if (bytesRead <= 0)
+            return;
+        request.append(buffer.data(), size_t(bytesRead));
+        if (request.toString().contains("\r\n\r\n"))
+            break;
+    }
+    if (threadShouldExit())
+        return;
+
+    auto requestLine = juce::StringArray::fromTokens(request.toString().upToFirstOccurrenceOf("\r\n", false, false), " ", "");
+    auto isGet = requestLine.size() >= 2 && "GET" == requestLine[0];
+    auto path = requestLine[1].upToFirstOccurrenceOf("?", false, false);
+
+    auto status = juce::String("200 OK");
+    auto body = juce::String();
+    if (!request.toString().contains("\r\n\r\n"))
+        status = "431 Request Header Fields Too Large";
+    else if (!isGet)
+        status = "405 Method Not Allowed";
+    else if ("/metrics" != path)
+        status = "404 Not Found";
+    else if (m_metricsProvider)
+        body = m_metricsProvider();
+
+    auto bodyUtf8 = body.toUTF8();
+    auto bodySize = bodyUtf8.sizeInBytes() - 1;
+    auto header = "HTTP/1.1 " + status + "\r\n"
+        + "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+        + "Content-Length: " + juce::String(juce::int64(bodySize)) + "\r\n"
+        + "Connection: close\r\n\r\n";
+
+    // a client that stops reading must not stall the endpoint thread in a blocking write
+    if (1 == connection.waitUntilReady(false, s_requestTimeout)
+        && header.length() == connection.write(header.toRawUTF8(), header.length())
+        && bodySize > 0
+        && 1 == connection.waitUntilReady(false, s_requestTimeout))
+        connection.write(bodyUtf8.getAddress(), int(bodySize));
+    connection.close();
+}
+
+} // namespace Mema
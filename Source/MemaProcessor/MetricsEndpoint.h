@@ -0,0 +1,74 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace Mema
+{
+
+/**
+ * @class MetricsEndpoint
+ * @brief Minimal HTTP endpoint serving metrics in the Prometheus text exposition format.
+ *
+ * @details Listens on the loopback interface only, every `GET /metrics` request is answered with
+ * the text returned by the metrics provider, which is called on the endpoint thread and therefore
+ * must be thread-safe.  Connections are handled one at a time and closed after the response, which
+ * is all a scraper needs.  Any other request is answered with 404.
+ */
+class MetricsEndpoint : private juce::Thread
+{
+public:
+    /** @brief Returns the complete metrics text, called on the endpoint thread for every scrape. */
+    using MetricsProvider = std::function<juce::String()>;
+
+public:
+    explicit MetricsEndpoint(MetricsProvider metricsProvider);
+    ~MetricsEndpoint() override;
+
+    //==============================================================================
+    /** @brief Starts listening on 127.0.0.1:@p port, returns false if the port cannot be bound. */
+    bool start(int port);
+    /** @brief Stops listening and waits for a scrape in progress to finish. */
+    void stop();
+
+    /** @brief Returns the port listened on, or -1 if not running. */
+    int getPort() const { return m_port; };
+
+private:
+    //==============================================================================
+    void run() override;
+
+    //==============================================================================
+    /** @brief Reads the request from @p connection and writes the response. */
+    void handleConnection(juce::StreamingSocket& connection);
+
+    //==============================================================================
+    static constexpr int s_pollInterval = 250;     ///< Interval in ms in which the listener checks for the thread to exit.
+    static constexpr int s_requestTimeout = 2000;  ///< Time in ms a client has to send its request header or accept the response.
+    static constexpr int s_maxRequestSize = 8192;  ///< Request headers beyond this size are answered with 431.
+
+    MetricsProvider                         m_metricsProvider;
+    std::unique_ptr<juce::StreamingSocket>  m_listener;
+    int                                     m_port = -1;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MetricsEndpoint)
+};
+
+} // namespace Mema
@@ -62,8 +62,10 @@ void ProcessorDataAnalyzer::initializeParameters(double sampleRate, int bufferSi
 	m_sampleRate = static_cast<unsigned long>(sampleRate);
 	m_samplesPerCentiSecond = static_cast<int>(sampleRate * 0.01f);
 	m_bufferSize = bufferSize;
-	m_missingSamplesForCentiSecond = static_cast<int>(m_samplesPerCentiSecond + 0.5f);
+	m_missingSamplesForCentiSecond = m_samplesPerCentiSecond;
 	m_centiSecondBuffer.setSize(2, m_missingSamplesForCentiSecond, false, true, false);
+	juce::FloatVectorOperations::clear(m_levelPeakAccumulators.data(), static_cast<int>(m_levelPeakAccumulators.size()));
+	juce::FloatVectorOperations::clear(m_levelSumOfSquaresAccumulators.data(), static_cast<int>(m_levelSumOfSquaresAccumulators.size()));
 }
 
 void ProcessorDataAnalyzer::clearParameters()
@@ -96,7 +98,7 @@ void ProcessorDataAnalyzer::removeListener(Listener* listener)
 
 void ProcessorDataAnalyzer::analyzeData(const juce::AudioBuffer<float>& buffer)
 {
-    if (!IsInitialized())
+    if (!IsInitialized() || m_samplesPerCentiSecond <= 0)
         return;
 
     int numChannels = buffer.getNumChannels();
@@ -106,6 +108,15 @@ void ProcessorDataAnalyzer::analyzeData(const juce::AudioBuffer<float>& buffer)
     if (m_sampleRate != m_centiSecondBuffer.GetSampleRate())
         m_centiSecondBuffer.SetSampleRate(m_sampleRate);
 
+    // Ensure per-channel level arrays and accumulators are sized correctly
+    if (isLevelProcessingUsed() && static_cast<unsigned long>(numChannels) != m_level.GetChannelCount())
+        m_level.SetChannelCount(numChannels);
+    if (isLevelProcessingUsed() && static_cast<size_t>(numChannels) != m_levelPeakAccumulators.size())
+    {
+        m_levelPeakAccumulators.resize(numChannels, 0.0f);
+        m_levelSumOfSquaresAccumulators.resize(numChannels, 0.0f);
+    }
+
     // Ensure per-channel FFT buffers are sized correctly
     if (isSepctrumProcessingUsed() && m_FFTdata.size() != numChannels)
     {
@@ -114,66 +125,147 @@ void ProcessorDataAnalyzer::analyzeData(const juce::AudioBuffer<float>& buffer)
         for (auto& channelFFTdata : m_FFTdata)
             channelFFTdata.resize(fftSize * 2, 0.0f);
     }
+    if (isSepctrumProcessingUsed() && static_cast<unsigned long>(numChannels) != m_spectrum.GetChannelCount())
+        m_spectrum.SetChannelCount(numChannels);
 
     int availableSamples = buffer.getNumSamples();
     int readPos = 0;
 
-    while (availableSamples >= m_missingSamplesForCentiSecond)
+    // Walk the buffer in segments that end at centisecond boundaries - level and spectrum
+    // processing read straight from the incoming buffer, only the broadcasted signal data is copied.
+    while (availableSamples > 0)
     {
+        int segmentLength = std::min(availableSamples, m_missingSamplesForCentiSecond);
         int writePos = m_samplesPerCentiSecond - m_missingSamplesForCentiSecond;
 
-        for (int i = 0; i < numChannels; ++i)
+        if (isBufferProcessingUsed())
         {
-            if (isBufferProcessingUsed())
-            {
-                // Generate signal buffer data
-                m_centiSecondBuffer.copyFrom(i, writePos, buffer.getReadPointer(i) + readPos, m_missingSamplesForCentiSecond);
-            }
-
-            if (isLevelProcessingUsed())
-            {
-                // Generate level data
-                auto peak = m_centiSecondBuffer.getMagnitude(i, 0, m_samplesPerCentiSecond);
-                auto rms = m_centiSecondBuffer.getRMSLevel(i, 0, m_samplesPerCentiSecond);
-                auto hold = std::max(peak, m_level.GetLevel(i + 1).hold);
-                m_level.SetLevel(i + 1, ProcessorLevelData::LevelVal(peak, rms, hold, static_cast<float>(getGlobalMindB())));
-            }
-
-            if (isSepctrumProcessingUsed())
-            {
-                // Generate spectrum data - all channels always process their audio data
-                // The FFT buffer accumulates samples for all channels
-                processSpectrumForChannel(i, m_centiSecondBuffer.getReadPointer(i), m_samplesPerCentiSecond);
-            }
+            // Generate signal buffer data
+            for (int i = 0; i < numChannels; ++i)
+                m_centiSecondBuffer.copyFrom(i, writePos, buffer.getReadPointer(i) + readPos, segmentLength);
         }
 
         if (isLevelProcessingUsed())
+        {
+            // Accumulate level data
+            accumulateLevels(buffer.getArrayOfReadPointers(), numChannels, readPos, segmentLength, m_levelPeakAccumulators.data(), m_levelSumOfSquaresAccumulators.data());
+        }
+
+        if (isSepctrumProcessingUsed())
+        {
+            // Generate spectrum data - all channels always process their audio data
+            // The FFT buffer accumulates samples for all channels
+            for (int i = 0; i < numChannels; ++i)
+                processSpectrumForChannel(i, buffer.getReadPointer(i) + readPos, segmentLength);
+        }
+
+        readPos += segmentLength;
+        availableSamples -= segmentLength;
+        m_missingSamplesForCentiSecond -= segmentLength;
+
+        if (m_missingSamplesForCentiSecond > 0)
+            break;
+
+        if (isLevelProcessingUsed() && finishCentiSecondLevels(numChannels))
             BroadcastData(&m_level);
 
         if (isBufferProcessingUsed())
             BroadcastData(&m_centiSecondBuffer);
 
-        if (isSepctrumProcessingUsed())
+        // spectrum frames are produced per FFT hop, not per centisecond - only broadcast when new bands were committed
+        if (isSepctrumProcessingUsed() && m_spectrum.GetGeneration() != m_lastBroadcastSpectrumGeneration)
+        {
+            m_lastBroadcastSpectrumGeneration = m_spectrum.GetGeneration();
             BroadcastData(&m_spectrum);
+        }
 
-
-        readPos += m_missingSamplesForCentiSecond;
-        availableSamples -= m_missingSamplesForCentiSecond;
         m_missingSamplesForCentiSecond = m_samplesPerCentiSecond;
     }
+}
 
-    // Handle remaining samples
-    if (availableSamples > 0)
+void ProcessorDataAnalyzer::accumulateLevels(const float* const* channels, int numChannels, int startSample, int numSamples, float* peaks, float* sumsOfSquares)
+{
+    for (int i = 0; i < numChannels; ++i)
     {
-        int writePos = m_samplesPerCentiSecond - m_missingSamplesForCentiSecond;
-        for (int i = 0; i < numChannels; ++i)
+        auto samples = channels[i] + startSample;
+        auto peak = peaks[i];
+        auto sumOfSquares = sumsOfSquares[i];
+        int j = 0;
+
+#if JUCE_USE_SIMD
+        using SIMDFloat = juce::dsp::SIMDRegister<float>;
+
+        // scalar head until the read position is register aligned
+        for (; j < numSamples && !SIMDFloat::isSIMDAligned(samples + j); ++j)
+        {
+            peak = std::max(peak, std::abs(samples[j]));
+            sumOfSquares += samples[j] * samples[j];
+        }
+
+        // both reductions in one pass over aligned registers
+        auto peakRegister = SIMDFloat::expand(0.0f);
+        auto sumOfSquaresRegister = SIMDFloat::expand(0.0f);
+        for (; j + int(SIMDFloat::SIMDNumElements) <= numSamples; j += int(SIMDFloat::SIMDNumElements))
         {
-            m_centiSecondBuffer.copyFrom(i, writePos, buffer.getReadPointer(i) + readPos, availableSamples);
+            auto sampleRegister = SIMDFloat::fromRawArray(samples + j);
+            peakRegister = SIMDFloat::max(peakRegister, SIMDFloat::abs(sampleRegister));
+            sumOfSquaresRegister += sampleRegister * sampleRegister;
         }
-        m_missingSamplesForCentiSecond -= availableSamples;
+        for (size_t k = 0; k < SIMDFloat::SIMDNumElements; ++k)
+            peak = std::max(peak, peakRegister.get(k));
+        sumOfSquares += sumOfSquaresRegister.sum();
+#endif
+
+        // scalar tail
+        for (; j < numSamples; ++j)
+        {
+            peak = std::max(peak, std::abs(samples[j]));
+            sumOfSquares += samples[j] * samples[j];
+        }
+
+        peaks[i] = peak;
+        sumsOfSquares[i] = sumOfSquares;
     }
 }
 
+bool ProcessorDataAnalyzer::finishCentiSecondLevels(int numChannels)
+{
+    // turn the sums of squares into rms values in place
+    auto rmsValues = m_levelSumOfSquaresAccumulators.data();
+    juce::FloatVectorOperations::multiply(rmsValues, 1.0f / static_cast<float>(m_samplesPerCentiSecond), numChannels);
+    for (int i = 0; i < numChannels; ++i)
+        rmsValues[i] = std::sqrt(rmsValues[i]);
+
+    // only touch (and later broadcast) the level data if anything actually changed, e.g. not while the input is silent,
+    // a hold flush clears the levels without broadcast, so the first centisecond after it is always published
+    auto peakValues = m_levelPeakAccumulators.data();
+    auto currentPeakLevels = m_level.GetLevels(ProcessorLevelData::Peak);
+    auto currentRmsLevels = m_level.GetLevels(ProcessorLevelData::Rms);
+    auto currentHoldLevels = m_level.GetLevels(ProcessorLevelData::Hold);
+    auto changed = m_level.GetGeneration() != m_lastBroadcastLevelGeneration;
+    for (int i = 0; i < numChannels && !changed; ++i)
+        changed = currentPeakLevels[i] != peakValues[i] || currentRmsLevels[i] != rmsValues[i] || currentHoldLevels[i] < peakValues[i];
+
+    if (changed)
+    {
+        m_level.SetMinusInfdB(static_cast<float>(getGlobalMindB()));
+        auto peakLevels = m_level.GetLevelsWritePointer(ProcessorLevelData::Peak);
+        auto rmsLevels = m_level.GetLevelsWritePointer(ProcessorLevelData::Rms);
+        auto holdLevels = m_level.GetLevelsWritePointer(ProcessorLevelData::Hold);
+
+        juce::FloatVectorOperations::copy(peakLevels, peakValues, numChannels);
+        juce::FloatVectorOperations::copy(rmsLevels, rmsValues, numChannels);
+        juce::FloatVectorOperations::max(holdLevels, holdLevels, peakLevels, numChannels);
+
+        m_lastBroadcastLevelGeneration = m_level.GetGeneration();
+    }
+
+    juce::FloatVectorOperations::clear(m_levelPeakAccumulators.data(), numChannels);
+    juce::FloatVectorOperations::clear(m_levelSumOfSquaresAccumulators.data(), numChannels);
+
+    return changed;
+}
+
 void ProcessorDataAnalyzer::processSpectrumForChannel(int channelIndex, const float* channelData, int numSamples)
 {
     int samplesProcessed = 0;
@@ -225,19 +317,18 @@ void ProcessorDataAnalyzer::performFFTAndUpdateSpectrum(int channelIndex)
     // Perform FFT
     m_fwdFFT.performFrequencyOnlyForwardTransform(fftData);
 
-    // Get spectrum bands for this channel
-    ProcessorSpectrumData::SpectrumBands spectrumBands = m_spectrum.GetSpectrum(channelIndex);
-    spectrumBands.mindB = static_cast<float>(getGlobalMindB());
-    spectrumBands.maxdB = static_cast<float>(getGlobalMaxdB());
+    // Update this channel's spectrum bands in place in the shared store
+    auto bandsPeak = m_spectrum.GetPeakWritePointer(channelIndex);
+    auto bandsHold = m_spectrum.GetHoldWritePointer(channelIndex);
+    const float mindB = static_cast<float>(getGlobalMindB());
+    const float maxdB = static_cast<float>(getGlobalMaxdB());
 
     const float nyquistFreq = m_sampleRate * 0.5f;
 
     const float minDisplayFreq = 20.0f;
     const float maxDisplayFreq = std::min(20000.0f, nyquistFreq);
 
-    spectrumBands.minFreq = minDisplayFreq;
-    spectrumBands.maxFreq = maxDisplayFreq;
-    spectrumBands.freqRes = (maxDisplayFreq - minDisplayFreq) / ProcessorSpectrumData::SpectrumBands::count;
+    m_spectrum.SetSpectrumRange(channelIndex, mindB, maxdB, minDisplayFreq, maxDisplayFreq, (maxDisplayFreq - minDisplayFreq) / ProcessorSpectrumData::SpectrumView::count);
 
     const int usableFFTBins = fftSize / 2;
     const float binFrequency = m_sampleRate / static_cast<float>(fftSize);
@@ -249,9 +340,9 @@ void ProcessorDataAnalyzer::performFFTAndUpdateSpectrum(int channelIndex)
     const float smoothingFactor = 0.6f;
 
     // Pre-calculate log values for efficiency
-    const float invBandCount = 1.0f / ProcessorSpectrumData::SpectrumBands::count;
+    const float invBandCount = 1.0f / ProcessorSpectrumData::SpectrumView::count;
 
-    for (int bandIndex = 0; bandIndex < ProcessorSpectrumData::SpectrumBands::count; ++bandIndex)
+    for (int bandIndex = 0; bandIndex < ProcessorSpectrumData::SpectrumView::count; ++bandIndex)
     {
         // Optimized logarithmic frequency calculation
         float t = bandIndex * invBandCount;
@@ -282,11 +373,11 @@ void ProcessorDataAnalyzer::performFFTAndUpdateSpectrum(int channelIndex)
         rmsValue = std::max(rmsValue, minMagnitude);
 
         float leveldB = juce::Decibels::gainToDecibels(rmsValue);
-        leveldB = juce::jlimit(spectrumBands.mindB, spectrumBands.maxdB, leveldB);
-        float normalizedLevel = juce::jmap(leveldB, spectrumBands.mindB, spectrumBands.maxdB, 0.0f, 1.0f);
+        leveldB = juce::jlimit(mindB, maxdB, leveldB);
+        float normalizedLevel = juce::jmap(leveldB, mindB, maxdB, 0.0f, 1.0f);
 
         // Light smoothing with overlap
-        float previousLevel = spectrumBands.bandsPeak[bandIndex];
+        float previousLevel = bandsPeak[bandIndex];
         float smoothedLevel;
 
         if (normalizedLevel > previousLevel)
@@ -300,11 +391,11 @@ void ProcessorDataAnalyzer::performFFTAndUpdateSpectrum(int channelIndex)
             smoothedLevel = smoothingFactor * previousLevel + (1.0f - smoothingFactor) * normalizedLevel;
         }
 
-        spectrumBands.bandsPeak[bandIndex] = smoothedLevel;
-        spectrumBands.bandsHold[bandIndex] = std::max(smoothedLevel, spectrumBands.bandsHold[bandIndex]);
+        bandsPeak[bandIndex] = smoothedLevel;
+        bandsHold[bandIndex] = std::max(smoothedLevel, bandsHold[bandIndex]);
     }
 
-    m_spectrum.SetSpectrum(channelIndex, spectrumBands);
+    m_spectrum.CommitSpectrum(channelIndex);
     juce::FloatVectorOperations::clear(fftData, fftSize * 2);
 }
 
@@ -323,25 +414,10 @@ void ProcessorDataAnalyzer::timerCallback()
 void ProcessorDataAnalyzer::FlushHold()
 {
 	// clear level hold values
-	auto channelCount = static_cast<int>(m_level.GetChannelCount());
-	for (auto i = 0; i < channelCount; ++i)
-	{
-		m_level.SetLevel(i + 1, ProcessorLevelData::LevelVal(0.0f, 0.0f, 0.0f, static_cast<float>(getGlobalMindB())));
-	}
-
-	// clear spectrum hold values	auto channelCount = m_level.GetChannelCount();
-	channelCount = static_cast<int>(m_spectrum.GetChannelCount());
-	for (auto i = 0; i < channelCount; ++i)
-	{
-		ProcessorSpectrumData::SpectrumBands spectrumBands = m_spectrum.GetSpectrum(i);
-		for (auto j = 0; j < ProcessorSpectrumData::SpectrumBands::count; ++j)
-		{
-			spectrumBands.bandsPeak[j] = 0.0f;
-			spectrumBands.bandsHold[j] = 0.0f;
-		}
-
-		m_spectrum.SetSpectrum(i, spectrumBands);
-	}
+	m_level.ClearLevels();
+
+	// clear spectrum hold values
+	m_spectrum.ClearSpectrums();
 }
 
 } // namespace Mema
\ No newline at end of file
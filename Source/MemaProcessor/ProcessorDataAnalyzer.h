@@ -106,6 +106,16 @@ private:
     void processSpectrumForChannel(int channelIndex, const float* channelData, int numSamples);
     void performFFTAndUpdateSpectrum(int channelIndex);
 
+    //==============================================================================
+    /**
+     * @brief Multi-channel level kernel - folds a sample range of all channels into running peak and sum-of-squares accumulators.
+     * @details Single SIMD pass per channel computing both reductions, reading straight from the
+     *          incoming buffer so that blocks straddling centisecond boundaries need no intermediate copy.
+     */
+    static void accumulateLevels(const float* const* channels, int numChannels, int startSample, int numSamples, float* peaks, float* sumsOfSquares);
+    /** @brief Publishes the accumulated centisecond levels. @return False if they equal the previously published ones and the levels were not cleared since, so the broadcast can be skipped. */
+    bool finishCentiSecondLevels(int numChannels);
+
     //==============================================================================
     ProcessorAudioSignalData    m_centiSecondBuffer;
     ProcessorLevelData          m_level;
@@ -135,6 +145,11 @@ private:
     dsp::WindowingFunction<float>               m_windowF;
     std::vector<std::vector<float>>             m_FFTdata; // [channel][fftSize * 2]
     std::vector<int>                            m_FFTdataPos; // [channel]
+    std::uint64_t                               m_lastBroadcastSpectrumGeneration = 0;
+
+    std::vector<float>                          m_levelPeakAccumulators; // [channel] running peak of the current centisecond
+    std::vector<float>                          m_levelSumOfSquaresAccumulators; // [channel] running sum of squares of the current centisecond
+    std::uint64_t                               m_lastBroadcastLevelGeneration = 0;
 
     int                                         m_holdTimeMs;
 
@@ -31,17 +31,104 @@ ProcessorLevelData::~ProcessorLevelData()
 
 }
 
+void ProcessorLevelData::SetLevel(unsigned long channel, float peak, float rms, float hold)
+{
+    if (channel < 1)
+        return;
+
+    if (channel > GetChannelCount())
+        SetChannelCount(channel);
+
+    m_levels[Peak][channel - 1] = peak;
+    m_levels[Rms][channel - 1] = rms;
+    m_levels[Hold][channel - 1] = hold;
+
+    for (auto& dirty : m_levelFactorsdBDirty)
+        dirty = true;
+}
+
 void ProcessorLevelData::SetLevel(unsigned long channel, ProcessorLevelData::LevelVal level)
 {
-    m_levelMap[channel] = level;
+    SetMinusInfdB(level.minusInfdb);
+    SetLevel(channel, level.peak, level.rms, level.hold);
 }
 
 ProcessorLevelData::LevelVal ProcessorLevelData::GetLevel(unsigned long channel)
 {
-    if(m_levelMap.count(channel))
-        return m_levelMap.at(channel);
+    if (channel >= 1 && channel <= GetChannelCount())
+        return ProcessorLevelData::LevelVal(m_levels[Peak][channel - 1], m_levels[Rms][channel - 1], m_levels[Hold][channel - 1], m_minusInfdB);
     else
-        return ProcessorLevelData::LevelVal(0, 0, 0);
+        return ProcessorLevelData::LevelVal(0, 0, 0, m_minusInfdB);
+}
+
+const float* ProcessorLevelData::GetLevels(LevelType type) const
+{
+    return m_levels[type].data();
+}
+
+float* ProcessorLevelData::GetLevelsWritePointer(LevelType type)
+{
+    m_levelFactorsdBDirty[type] = true;
+    return m_levels[type].data();
+}
+
+const float* ProcessorLevelData::GetLevelFactorsdB(LevelType type)
+{
+    if (m_levelFactorsdBDirty[type])
+        UpdateLevelFactorsdB(type);
+
+    return m_levelFactorsdB[type].data();
+}
+
+void ProcessorLevelData::UpdateLevelFactorsdB(LevelType type)
+{
+    auto& levels = m_levels[type];
+    auto& factors = m_levelFactorsdB[type];
+    auto count = static_cast<int>(levels.size());
+    factors.resize(levels.size());
+
+    if (count > 0)
+    {
+        // factor = (dB - minusInf) / -minusInf = 1 + 20 * log10(max(gain, gainAtMinusInf)) / -minusInf
+        auto gainFloor = juce::Decibels::decibelsToGain(m_minusInfdB, m_minusInfdB - 1.0f);
+        juce::FloatVectorOperations::max(factors.data(), levels.data(), gainFloor, count);
+        for (auto& factor : factors)
+            factor = std::log10(factor);
+        juce::FloatVectorOperations::multiply(factors.data(), 20.0f / (-1.0f * m_minusInfdB), count);
+        juce::FloatVectorOperations::add(factors.data(), 1.0f, count);
+    }
+
+    m_levelFactorsdBDirty[type] = false;
+}
+
+void ProcessorLevelData::ClearLevels()
+{
+    for (auto i = 0; i < LevelTypeCount; i++)
+    {
+        juce::FloatVectorOperations::clear(m_levels[i].data(), static_cast<int>(m_levels[i].size()));
+        m_levelFactorsdBDirty[i] = true;
+    }
+    m_generation++;
+}
+
+std::uint64_t ProcessorLevelData::GetGeneration() const
+{
+    return m_generation;
+}
+
+void ProcessorLevelData::SetMinusInfdB(float minusInfdB)
+{
+    if (m_minusInfdB == minusInfdB)
+        return;
+
+    m_minusInfdB = minusInfdB;
+    for (auto& dirty : m_levelFactorsdBDirty)
+        dirty = true;
+}
+
+float ProcessorLevelData::GetMinusInfdB() const
+{
+    return m_minusInfdB;
 }
 
 void ProcessorLevelData::SetChannelCount(unsigned long count)
@@ -49,16 +136,17 @@ void ProcessorLevelData::SetChannelCount(unsigned long count)
     if(GetChannelCount()==count)
         return;
     
-    for(unsigned long i=1; i<=count; i++)
+    for (auto i = 0; i < LevelTypeCount; i++)
     {
-        if (!m_levelMap.count(i))
-            m_levelMap[i] = LevelVal(0, 0, 0);
+        m_levels[i].resize(count, 0.0f);
+        m_levelFactorsdBDirty[i] = true;
     }
+    m_generation++;
 }
 
 unsigned long ProcessorLevelData::GetChannelCount()
 {
-    return static_cast<unsigned long>(m_levelMap.size());
+    return static_cast<unsigned long>(m_levels[Peak].size());
 }
 
-}
\ No newline at end of file
+}
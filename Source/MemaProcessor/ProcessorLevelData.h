@@ -23,10 +23,28 @@
 namespace Mema
 {
 
-/** @class ProcessorLevelData @brief Level-metering data object carrying peak, RMS, and hold values for each channel. */
+/**
+ * @class ProcessorLevelData
+ * @brief Level-metering data object carrying peak, RMS, and hold values for each channel.
+ *
+ * @details Values are kept as structure-of-arrays — one contiguous float array per level type,
+ * indexed by zero-based channel — so the analyzer can write and the meters can read all channels
+ * in one linear pass.  The normalised dB factors used by the meters are derived lazily: they are
+ * only recalculated (vectorised, for all channels at once) when a consumer asks for them after
+ * the linear values changed.
+ */
 class ProcessorLevelData : public AbstractProcessorData
 {
 public:
+    /** @brief Selects one of the per-channel level arrays. */
+    enum LevelType
+    {
+        Peak = 0,   ///< Linear peak level.
+        Rms,        ///< Linear RMS level.
+        Hold,       ///< Linear hold level.
+        LevelTypeCount
+    };
+
     /** @brief Per-channel level values in both linear and dB domains. */
     struct LevelVal
     {
@@ -77,14 +95,43 @@ public:
     ProcessorLevelData();
     ~ProcessorLevelData();
     
+    /** @brief Sets the linear levels of a 1-based @p channel, growing the arrays if required. */
+    void SetLevel(unsigned long channel, float peak, float rms, float hold);
+    /** @brief Sets the linear levels of a 1-based @p channel from a LevelVal (its minusInfdb becomes the data object's -inf floor). */
     void SetLevel(unsigned long channel, LevelVal level);
+    /** @brief Returns a LevelVal snapshot of a 1-based @p channel, with dB values computed for that channel only. */
     LevelVal GetLevel(unsigned long channel);
+
+    /** @brief Returns the contiguous linear level array of @p type, indexed by zero-based channel. */
+    const float* GetLevels(LevelType type) const;
+    /** @brief Returns the writable linear level array of @p type and marks the derived dB factors outdated. */
+    float* GetLevelsWritePointer(LevelType type);
+    /**
+     * @brief Returns the normalised dB factors (0 at -inf floor, 1 at 0 dBFS) of @p type, indexed by zero-based channel.
+     * @details Recalculated for all channels at once, only if the linear values changed since the last call.
+     */
+    const float* GetLevelFactorsdB(LevelType type);
+    /** @brief Resets all linear levels of all channels to zero. */
+    void ClearLevels();
+    /** @brief Returns the generation, advanced by every clear or channel count change (not by regular level writes). */
+    std::uint64_t GetGeneration() const;
+
+    /** @brief Sets the dB value treated as -infinity when deriving dB factors. */
+    void SetMinusInfdB(float minusInfdB);
+    /** @brief Returns the dB value treated as -infinity when deriving dB factors. */
+    float GetMinusInfdB() const;
     
     void SetChannelCount(unsigned long count) override;
     unsigned long GetChannelCount() override;
     
 private:
-    std::map<unsigned long, LevelVal>    m_levelMap;
+    void UpdateLevelFactorsdB(LevelType type);
+
+    std::vector<float>  m_levels[LevelTypeCount];           ///< Linear levels per type, indexed by zero-based channel.
+    std::vector<float>  m_levelFactorsdB[LevelTypeCount];   ///< Lazily derived normalised dB factors per type.
+    bool                m_levelFactorsdBDirty[LevelTypeCount] = { true, true, true }; ///< True while m_levelFactorsdB lags behind m_levels.
+    float               m_minusInfdB = -100.0f;             ///< dB value treated as -infinity.
+    std::uint64_t       m_generation = 0;                   ///< Clear and channel count change counter.
 };
 
 }
@@ -31,17 +31,66 @@ ProcessorSpectrumData::~ProcessorSpectrumData()
 
 }
 
-void ProcessorSpectrumData::SetSpectrum(unsigned long channel, ProcessorSpectrumData::SpectrumBands spectrum)
+ProcessorSpectrumData::SpectrumView ProcessorSpectrumData::GetSpectrumView(unsigned long channel) const
 {
-    m_spectrumsMap[channel] = spectrum;
+    auto view = SpectrumView();
+    if (channel >= m_channelCount)
+        return view;
+
+    auto offset = channel * SpectrumView::count;
+    view.bandsPeak = m_bandsPeak.data() + offset;
+    view.bandsHold = m_bandsHold.data() + offset;
+    view.mindB = m_ranges[channel].mindB;
+    view.maxdB = m_ranges[channel].maxdB;
+    view.minFreq = m_ranges[channel].minFreq;
+    view.maxFreq = m_ranges[channel].maxFreq;
+    view.freqRes = m_ranges[channel].freqRes;
+    view.generation = m_channelGenerations[channel];
+
+    return view;
 }
 
-const ProcessorSpectrumData::SpectrumBands& ProcessorSpectrumData::GetSpectrum(unsigned long channel)
+std::uint64_t ProcessorSpectrumData::GetGeneration() const
 {
-    if(m_spectrumsMap.count(channel) == 0)
-        m_spectrumsMap.insert(std::pair<unsigned long, SpectrumBands>(channel, ProcessorSpectrumData::SpectrumBands{}));
+    return m_generation;
+}
 
-    return m_spectrumsMap.at(channel);
+float* ProcessorSpectrumData::GetPeakWritePointer(unsigned long channel)
+{
+    jassert(channel < m_channelCount);
+    return m_bandsPeak.data() + channel * SpectrumView::count;
+}
+
+float* ProcessorSpectrumData::GetHoldWritePointer(unsigned long channel)
+{
+    jassert(channel < m_channelCount);
+    return m_bandsHold.data() + channel * SpectrumView::count;
+}
+
+void ProcessorSpectrumData::SetSpectrumRange(unsigned long channel, float mindB, float maxdB, float minFreq, float maxFreq, float freqRes)
+{
+    if (channel >= m_channelCount)
+        return;
+
+    m_ranges[channel] = { mindB, maxdB, minFreq, maxFreq, freqRes };
+}
+
+void ProcessorSpectrumData::CommitSpectrum(unsigned long channel)
+{
+    if (channel >= m_channelCount)
+        return;
+
+    m_channelGenerations[channel]++;
+    m_generation++;
+}
+
+void ProcessorSpectrumData::ClearSpectrums()
+{
+    juce::FloatVectorOperations::clear(m_bandsPeak.data(), static_cast<int>(m_bandsPeak.size()));
+    juce::FloatVectorOperations::clear(m_bandsHold.data(), static_cast<int>(m_bandsHold.size()));
+    for (auto& channelGeneration : m_channelGenerations)
+        channelGeneration++;
+    m_generation++;
 }
 
 void ProcessorSpectrumData::SetChannelCount(unsigned long count)
@@ -49,16 +98,17 @@ void ProcessorSpectrumData::SetChannelCount(unsigned long count)
     if(GetChannelCount()==count)
         return;
     
-    for(unsigned long i=1; i<=count; i++)
-    {
-        if(!m_spectrumsMap.count(i))
-            m_spectrumsMap[i] = SpectrumBands();
-    }
+    m_channelCount = count;
+    m_bandsPeak.resize(count * SpectrumView::count, 0.0f);
+    m_bandsHold.resize(count * SpectrumView::count, 0.0f);
+    m_ranges.resize(count);
+    m_channelGenerations.resize(count, 0);
+    m_generation++;
 }
 
 unsigned long ProcessorSpectrumData::GetChannelCount()
 {
-    return static_cast<unsigned long>(m_spectrumsMap.size());
+    return m_channelCount;
 }
 
-}
\ No newline at end of file
+}
@@ -22,54 +22,81 @@
 namespace Mema
 {
 
-/** @class ProcessorSpectrumData @brief Frequency-spectrum data object carrying FFT magnitude bins for each channel. */
+/**
+ * @class ProcessorSpectrumData
+ * @brief Frequency-spectrum data object carrying FFT magnitude bands for each channel.
+ *
+ * @details All channels share one contiguous peak and one contiguous hold store
+ * (`channelCount × SpectrumView::count` floats each).  The analyzer writes the bands of a channel
+ * in place and commits them, which advances that channel's generation counter and the overall
+ * generation.  Listeners read through lightweight `SpectrumView`s pointing into the store and
+ * can skip re-plotting when the generation did not change since their last read.
+ *
+ * Channel indices are zero-based.
+ */
 class ProcessorSpectrumData : public AbstractProcessorData
 {
 public:
-    /** @brief FFT output for a single channel — 512 frequency bins with peak and hold values. */
-    struct SpectrumBands
+    /** @brief Read-only view on the spectrum of a single channel — 512 frequency bands with peak and hold values. */
+    struct SpectrumView
     {
         enum {
             count = 512
         };
 
-        SpectrumBands()
-        {
-            for (int i = 0; i < count; ++i)
-            {
-                bandsPeak[i] = 0.0f;
-                bandsHold[i] = 0.0f;
-            }
+        const float*    bandsPeak = nullptr;    ///< Normalised peak value per band, points into the shared store.
+        const float*    bandsHold = nullptr;    ///< Normalised hold value per band, points into the shared store.
+        float           mindB = 0.0f;
+        float           maxdB = 0.0f;
+        float           minFreq = 20.0f;
+        float           maxFreq = 20000.0f;
+        float           freqRes = 0.0f;
+        std::uint64_t   generation = 0;         ///< Commit count of this channel, changes whenever the bands were updated.
 
-            mindB = 0.0f;
-            maxdB = 0.0f;
-            minFreq = 20.0f;
-            maxFreq = 20000.0f;
-            freqRes = static_cast<float>((maxFreq - minFreq) / ProcessorSpectrumData::SpectrumBands::count);
-        };
-        
-        float   bandsPeak[count];
-        float   bandsHold[count];
-        float   mindB;
-        float   maxdB;
-        float   minFreq;
-        float   maxFreq;
-        float   freqRes;
+        bool isValid() const { return nullptr != bandsPeak && nullptr != bandsHold; };
     };
     
 public:
     ProcessorSpectrumData();
     ~ProcessorSpectrumData();
     
-    void SetSpectrum(unsigned long channel, SpectrumBands spectrum);
-    const SpectrumBands& GetSpectrum(unsigned long channel);
+    /** @brief Returns a view on the spectrum of @p channel, or an invalid view if the channel does not exist. Valid until the channel count changes. */
+    SpectrumView GetSpectrumView(unsigned long channel) const;
+    /** @brief Returns the overall generation, advanced by every commit or clear on any channel. */
+    std::uint64_t GetGeneration() const;
+
+    /** @brief Returns the writable peak bands of @p channel (SpectrumView::count floats). */
+    float* GetPeakWritePointer(unsigned long channel);
+    /** @brief Returns the writable hold bands of @p channel (SpectrumView::count floats). */
+    float* GetHoldWritePointer(unsigned long channel);
+    /** @brief Sets the dB and frequency range the bands of @p channel refer to. */
+    void SetSpectrumRange(unsigned long channel, float mindB, float maxdB, float minFreq, float maxFreq, float freqRes);
+    /** @brief Publishes the bands written to @p channel by advancing its generation. */
+    void CommitSpectrum(unsigned long channel);
+    /** @brief Resets peak and hold bands of all channels to zero. */
+    void ClearSpectrums();
     
     void SetChannelCount(unsigned long count) override;
     unsigned long GetChannelCount() override;
     
 private:
-    std::map<unsigned long, SpectrumBands>    m_spectrumsMap;
+    /** @brief Per-channel metadata accompanying the shared band stores. */
+    struct SpectrumRange
+    {
+        float   mindB = 0.0f;
+        float   maxdB = 0.0f;
+        float   minFreq = 20.0f;
+        float   maxFreq = 20000.0f;
+        float   freqRes = 0.0f;
+    };
+
+    unsigned long                   m_channelCount = 0;
+    std::vector<float>              m_bandsPeak;            ///< Contiguous peak bands, channel-major.
+    std::vector<float>              m_bandsHold;            ///< Contiguous hold bands, channel-major.
+    std::vector<SpectrumRange>      m_ranges;               ///< Per-channel dB and frequency range.
+    std::vector<std::uint64_t>      m_channelGenerations;   ///< Per-channel commit counter.
+    std::uint64_t                   m_generation = 0;       ///< Overall commit counter.
 
 };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,149 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ProcessorStateJournal.h"
+
+namespace Mema
+{
+
+static_assert(16 == sizeof(ProcessorStateJournal::Header), "journal header layout must not depend on the compiler");
+
+//==============================================================================
+juce::MemoryBlock ProcessorStateJournal::createHeader(int inputCount, int outputCount, std::uint32_t baseChecksum)
+{
+    jassert(inputCount >= 0 && inputCount <= std::numeric_limits<std::uint16_t>::max());
+    jassert(outputCount >= 0 && outputCount <= std::numeric_limits<std::uint16_t>::max());
+
+    auto header = Header();
+    header.inputCount = std::uint16_t(inputCount);
+    header.outputCount = std::uint16_t(outputCount);
+    header.baseChecksum = baseChecksum;
+
+    return juce::MemoryBlock(&header, sizeof(Header));
+}
+
+juce::MemoryBlock ProcessorStateJournal::serializeRecords(const std::vector<Record>& records)
+{
+    auto data = juce::MemoryBlock(records.size() * s_recordSize, true);
+    auto* recordData = static_cast<std::uint8_t*>(data.getData());
+    for (auto const& record : records)
+    {
+        // type, state, channel, output, reserved, value, crc - little-endian like the snapshot
+        recordData[0] = std::uint8_t(record.type);
+        recordData[1] = record.state ? 1 : 0;
+        std::memcpy(recordData + 2, &record.channel, sizeof(std::uint16_t));
+        std::memcpy(recordData + 4, &record.output, sizeof(std::uint16_t));
+        std::memcpy(recordData + 8, &record.value, sizeof(float));
+        auto checksum = ProcessorStateSnapshot::calculateChecksum(recordData, s_recordSize - sizeof(std::uint32_t));
+        std::memcpy(recordData + 12, &checksum, sizeof(std::uint32_t));
+        recordData += s_recordSize;
+    }
+
+    return data;
+}
+
+//==============================================================================
+int ProcessorStateJournal::replay(const void* data, size_t size, int inputCount, int outputCount, std::uint32_t baseChecksum, ProcessorStateSnapshot::RoutingState& state)
+{
+#if JUCE_BIG_ENDIAN
+    juce::ignoreUnused(data, size, inputCount, outputCount, baseChecksum, state);
+    jassertfalse; // journals are little-endian only, fall back to the snapshot
+    return -1;
+#else
+    if (nullptr == data || size < sizeof(Header))
+        return -1;
+
+    auto header = Header();
+    std::memcpy(&header, data, sizeof(Header));
+    if (s_magic != header.magic || s_version != header.version || sizeof(Header) != header.headerSize)
+        return -1;
+    if (inputCount != header.inputCount || outputCount != header.outputCount || baseChecksum != header.baseChecksum)
+        return -1;
+
+    auto replayedCount = 0;
+    auto* recordData = static_cast<const std::uint8_t*>(data) + sizeof(Header);
+    auto recordCount = (size - sizeof(Header)) / s_recordSize;
+    for (size_t i = 0; i < recordCount; i++, recordData += s_recordSize)
+    {
+        std::uint32_t checksum;
+        std::memcpy(&checksum, recordData + 12, sizeof(std::uint32_t));
+        if (ProcessorStateSnapshot::calculateChecksum(recordData, s_recordSize - sizeof(std::uint32_t)) != checksum)
+            break; // torn tail, nothing after it can be trusted
+
+        auto recordState = 0 != recordData[1];
+        std::uint16_t channel, output;
+        float value;
+        std::memcpy(&channel, recordData + 2, sizeof(std::uint16_t));
+        std::memcpy(&output, recordData + 4, sizeof(std::uint16_t));
+        std::memcpy(&value, recordData + 8, sizeof(float));
+
+        auto isValidInput = channel >= 1 && channel <= inputCount;
+        auto isValidCrosspoint = isValidInput && output >= 1 && output <= outputCount;
+        switch (RecordType(recordData[0]))
+        {
+        case RecordType::InputMute:
+            if (isValidInput)
+                state.inputMuteStates[channel] = recordState;
+            break;
+        case RecordType::OutputMute:
+            if (channel >= 1 && channel <= outputCount)
+                state.outputMuteStates[channel] = recordState;
+            break;
+        case RecordType::CrosspointEnabled:
+            if (isValidCrosspoint)
+                state.crosspointStates[channel][output] = recordState;
+            break;
+        case RecordType::CrosspointFactor:
+            if (isValidCrosspoint)
+                state.crosspointValues[channel][output] = value;
+            break;
+        case RecordType::Crosspoint:
+            if (isValidCrosspoint)
+            {
+                state.crosspointStates[channel][output] = recordState;
+                state.crosspointValues[channel][output] = value;
+            }
+            break;
+        default:
+            jassertfalse; // written by a newer version with the same journal version?
+            break;
+        }
+        replayedCount++;
+    }
+
+    return replayedCount;
+#endif
+}
+
+int ProcessorStateJournal::replayFromFile(const juce::File& file, int inputCount, int outputCount, std::uint32_t baseChecksum, ProcessorStateSnapshot::RoutingState& state)
+{
+    if (!file.existsAsFile())
+        return -1;
+
+    juce::MemoryMappedFile mappedFile(file, juce::MemoryMappedFile::readOnly);
+    return replay(mappedFile.getData(), mappedFile.getSize(), inputCount, outputCount, baseChecksum, state);
+}
+
+//==============================================================================
+juce::File ProcessorStateJournal::getDefaultFile()
+{
+    auto snapshotFile = ProcessorStateSnapshot::getDefaultFile();
+    return snapshotFile.getSiblingFile(snapshotFile.getFileNameWithoutExtension() + ".journal");
+}
+
+} // namespace Mema
@@ -0,0 +1,104 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#include "ProcessorStateSnapshot.h"
+
+namespace Mema
+{
+
+/**
+ * @class ProcessorStateJournal
+ * @brief Append-only journal of routing changes on top of a ProcessorStateSnapshot.
+ *
+ * @details Instead of rewriting the whole snapshot on every mute or crosspoint change, each change is
+ * appended as one fixed size record.  The journal header carries the payload checksum of the snapshot
+ * it continues, so a journal is only ever replayed on exactly that snapshot.  Compaction is done by
+ * writing a new snapshot and starting a new journal for it.
+ *
+ * | Offset         | Content                                                         |
+ * |----------------|-----------------------------------------------------------------|
+ * | 0              | Header (magic, version, channel counts, base snapshot checksum) |
+ * | headerSize     | Record × n, 16 bytes each, with a CRC-32 per record             |
+ *
+ * Replay stops at the first record that fails its checksum, so a record torn by a crash only costs
+ * that record and everything after it.
+ */
+class ProcessorStateJournal
+{
+public:
+    static constexpr std::uint32_t s_magic = 0x4c4e4a4d; ///< "MJNL" when read as little-endian bytes.
+    static constexpr std::uint16_t s_version = 1;
+
+    /** @brief Fixed size journal header, all fields little-endian. */
+    struct Header
+    {
+        std::uint32_t magic = s_magic;
+        std::uint16_t version = s_version;
+        std::uint16_t headerSize = sizeof(Header);
+        std::uint16_t inputCount = 0;
+        std::uint16_t outputCount = 0;
+        std::uint32_t baseChecksum = 0;
+    };
+
+    /** @brief Kind of change a record describes. */
+    enum class RecordType : std::uint8_t
+    {
+        InputMute = 1,
+        OutputMute,
+        CrosspointEnabled,
+        CrosspointFactor,
+        Crosspoint,         ///< Enabled state and factor in one record.
+    };
+
+    /** @brief One routing change, 1-based channel numbers. */
+    struct Record
+    {
+        RecordType      type = RecordType::InputMute;
+        bool            state = false;  ///< Mute or crosspoint enabled state.
+        std::uint16_t   channel = 0;    ///< Input for mutes and crosspoints, output for output mutes.
+        std::uint16_t   output = 0;     ///< Output for crosspoints.
+        float           value = 0.0f;   ///< Crosspoint factor.
+    };
+
+    static constexpr size_t s_recordSize = 16;
+
+public:
+    //==============================================================================
+    /** @brief Creates the header of a new journal continuing the snapshot with @p baseChecksum. */
+    static juce::MemoryBlock createHeader(int inputCount, int outputCount, std::uint32_t baseChecksum);
+    /** @brief Serialises @p records back to back, ready to be appended to a journal. */
+    static juce::MemoryBlock serializeRecords(const std::vector<Record>& records);
+
+    /**
+     * @brief Applies the records of the journal in @p data to @p state.
+     * @return The number of replayed records, -1 if the journal is invalid or does not continue the snapshot with @p baseChecksum.
+     */
+    static int replay(const void* data, size_t size, int inputCount, int outputCount, std::uint32_t baseChecksum, ProcessorStateSnapshot::RoutingState& state);
+    /** @brief Memory-maps @p file and replays it, see replay. */
+    static int replayFromFile(const juce::File& file, int inputCount, int outputCount, std::uint32_t baseChecksum, ProcessorStateSnapshot::RoutingState& state);
+
+    //==============================================================================
+    /** @brief Returns the journal file kept next to the default snapshot file. */
+    static juce::File getDefaultFile();
+};
+
+} // namespace Mema
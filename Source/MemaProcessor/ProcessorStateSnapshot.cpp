@@ -0,0 +1,189 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ProcessorStateSnapshot.h"
+
+#include "../MemaAppConfiguration.h"
+
+namespace Mema
+{
+
+static_assert(24 == sizeof(ProcessorStateSnapshot::Header), "snapshot header layout must not depend on the compiler");
+
+//==============================================================================
+juce::MemoryBlock ProcessorStateSnapshot::serialize(int inputCount, int outputCount, const RoutingState& state)
+{
+    jassert(inputCount >= 0 && inputCount <= std::numeric_limits<std::uint16_t>::max());
+    jassert(outputCount >= 0 && outputCount <= std::numeric_limits<std::uint16_t>::max());
+
+    auto payloadSize = getPayloadSize(inputCount, outputCount);
+    auto snapshot = juce::MemoryBlock(sizeof(Header) + payloadSize, true);
+    auto* payload = static_cast<std::uint8_t*>(snapshot.getData()) + sizeof(Header);
+
+    auto crosspointCount = size_t(inputCount) * size_t(outputCount);
+    auto* gains = reinterpret_cast<float*>(payload);
+    auto* enabled = payload + crosspointCount * sizeof(float);
+    auto* inputMutes = enabled + crosspointCount;
+    auto* outputMutes = inputMutes + inputCount;
+
+    for (auto const& crosspointValuesKV : state.crosspointValues)
+    {
+        if (crosspointValuesKV.first < 1 || crosspointValuesKV.first > inputCount)
+            continue;
+        auto* gainsRow = gains + size_t(crosspointValuesKV.first - 1) * size_t(outputCount);
+        for (auto const& crosspointValueKV : crosspointValuesKV.second)
+            if (crosspointValueKV.first >= 1 && crosspointValueKV.first <= outputCount)
+                gainsRow[crosspointValueKV.first - 1] = crosspointValueKV.second;
+    }
+    for (auto const& crosspointStatesKV : state.crosspointStates)
+    {
+        if (crosspointStatesKV.first < 1 || crosspointStatesKV.first > inputCount)
+            continue;
+        auto* enabledRow = enabled + size_t(crosspointStatesKV.first - 1) * size_t(outputCount);
+        for (auto const& crosspointStateKV : crosspointStatesKV.second)
+            if (crosspointStateKV.first >= 1 && crosspointStateKV.first <= outputCount)
+                enabledRow[crosspointStateKV.first - 1] = crosspointStateKV.second ? 1 : 0;
+    }
+    for (auto const& inputMuteStateKV : state.inputMuteStates)
+        if (inputMuteStateKV.first >= 1 && inputMuteStateKV.first <= inputCount)
+            inputMutes[inputMuteStateKV.first - 1] = inputMuteStateKV.second ? 1 : 0;
+    for (auto const& outputMuteStateKV : state.outputMuteStates)
+        if (outputMuteStateKV.first >= 1 && outputMuteStateKV.first <= outputCount)
+            outputMutes[outputMuteStateKV.first - 1] = outputMuteStateKV.second ? 1 : 0;
+
+    auto header = Header();
+    header.inputCount = std::uint16_t(inputCount);
+    header.outputCount = std::uint16_t(outputCount);
+    header.payloadSize = std::uint32_t(payloadSize);
+    header.payloadChecksum = calculateChecksum(payload, payloadSize);
+    std::memcpy(snapshot.getData(), &header, sizeof(Header));
+
+    return snapshot;
+}
+
+bool ProcessorStateSnapshot::deserialize(const void* data, size_t size, int inputCount, int outputCount, RoutingState& state, std::uint32_t* payloadChecksum)
+{
+#if JUCE_BIG_ENDIAN
+    juce::ignoreUnused(data, size, inputCount, outputCount, state, payloadChecksum);
+    jassertfalse; // snapshots are little-endian only, fall back to the xml config
+    return false;
+#else
+    if (nullptr == data || size < sizeof(Header))
+        return false;
+
+    auto header = Header();
+    std::memcpy(&header, data, sizeof(Header));
+    if (s_magic != header.magic || s_version != header.version || sizeof(Header) != header.headerSize)
+        return false;
+    if (inputCount != header.inputCount || outputCount != header.outputCount)
+        return false;
+
+    auto payloadSize = getPayloadSize(inputCount, outputCount);
+    if (payloadSize != header.payloadSize || size < sizeof(Header) + payloadSize)
+        return false;
+
+    auto* payload = static_cast<const std::uint8_t*>(data) + sizeof(Header);
+    if (calculateChecksum(payload, payloadSize) != header.payloadChecksum)
+        return false;
+
+    auto crosspointCount = size_t(inputCount) * size_t(outputCount);
+    auto* enabled = payload + crosspointCount * sizeof(float);
+    auto* inputMutes = enabled + crosspointCount;
+    auto* outputMutes = inputMutes + inputCount;
+
+    state = RoutingState();
+    for (auto in = 1; in <= inputCount; in++)
+    {
+        auto& crosspointStates = state.crosspointStates[std::uint16_t(in)];
+        auto& crosspointValues = state.crosspointValues[std::uint16_t(in)];
+        for (auto out = 1; out <= outputCount; out++)
+        {
+            auto crosspointIdx = size_t(in - 1) * size_t(outputCount) + size_t(out - 1);
+            float gain;
+            std::memcpy(&gain, payload + crosspointIdx * sizeof(float), sizeof(float)); // mapped data is not necessarily float aligned
+            crosspointValues[std::uint16_t(out)] = gain;
+            crosspointStates[std::uint16_t(out)] = 0 != enabled[crosspointIdx];
+        }
+        state.inputMuteStates[std::uint16_t(in)] = 0 != inputMutes[in - 1];
+    }
+    for (auto out = 1; out <= outputCount; out++)
+        state.outputMuteStates[std::uint16_t(out)] = 0 != outputMutes[out - 1];
+
+    if (nullptr != payloadChecksum)
+        *payloadChecksum = header.payloadChecksum;
+
+    return true;
+#endif
+}
+
+std::uint32_t ProcessorStateSnapshot::getPayloadChecksum(const juce::MemoryBlock& snapshot)
+{
+    if (snapshot.getSize() < sizeof(Header))
+        return 0;
+
+    auto header = Header();
+    std::memcpy(&header, snapshot.getData(), sizeof(Header));
+    return header.payloadChecksum;
+}
+
+//==============================================================================
+bool ProcessorStateSnapshot::readFromFile(const juce::File& file, int inputCount, int outputCount, RoutingState& state, std::uint32_t* payloadChecksum)
+{
+    if (!file.existsAsFile())
+        return false;
+
+    juce::MemoryMappedFile mappedFile(file, juce::MemoryMappedFile::readOnly);
+    return deserialize(mappedFile.getData(), mappedFile.getSize(), inputCount, outputCount, state, payloadChecksum);
+}
+
+juce::File ProcessorStateSnapshot::getDefaultFile()
+{
+    auto configFile = juce::File(JUCEAppBasics::AppConfigurationBase::getDefaultConfigFilePath());
+    return configFile.getSiblingFile(configFile.getFileNameWithoutExtension() + ".state");
+}
+
+//==============================================================================
+size_t ProcessorStateSnapshot::getPayloadSize(int inputCount, int outputCount)
+{
+    auto crosspointCount = size_t(std::max(0, inputCount)) * size_t(std::max(0, outputCount));
+    return crosspointCount * (sizeof(float) + 1) + size_t(std::max(0, inputCount)) + size_t(std::max(0, outputCount));
+}
+
+std::uint32_t ProcessorStateSnapshot::calculateChecksum(const void* data, size_t size)
+{
+    // CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320)
+    static const auto table = []() {
+        std::array<std::uint32_t, 256> t{};
+        for (std::uint32_t i = 0; i < 256; i++)
+        {
+            auto c = i;
+            for (auto k = 0; k < 8; k++)
+                c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+            t[i] = c;
+        }
+        return t;
+    }();
+
+    auto crc = 0xFFFFFFFFu;
+    auto* bytes = static_cast<const std::uint8_t*>(data);
+    for (size_t i = 0; i < size; i++)
+        crc = table[(crc ^ bytes[i]) & 0xFFu] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+} // namespace Mema
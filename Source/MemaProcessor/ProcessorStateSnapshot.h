@@ -0,0 +1,104 @@
+/* Copyright (c) 2026, Christian Ahrens
+ *
+ * This file is part of Mema <https://github.com/ChristianAhrens/Mema>
+ *
+ * This tool is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This tool is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this tool; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace Mema
+{
+
+/**
+ * @class ProcessorStateSnapshot
+ * @brief Compact binary snapshot of the MemaProcessor routing state (mutes and crosspoint matrix).
+ *
+ * @details Used for the frequent autosave of routing changes, the XML processor config stays the
+ * human readable export and the source of everything else (device, plug-in).  A snapshot is a fixed
+ * header followed by flat little-endian arrays, so it can be validated and read in place from a
+ * memory-mapped file without any parsing:
+ *
+ * | Offset             | Content                                                    |
+ * |--------------------|------------------------------------------------------------|
+ * | 0                  | Header (magic, version, channel counts, payload size, CRC) |
+ * | headerSize         | float crosspoint gain × in × out, row-major [in][out]      |
+ * | + 4 × in × out     | uint8 crosspoint enabled × in × out, row-major [in][out]   |
+ * | + in × out         | uint8 input muted × in                                     |
+ * | + in               | uint8 output muted × out                                   |
+ *
+ * The CRC-32 covers the payload, a snapshot whose magic, version, size or checksum does not match
+ * is rejected as a whole.
+ */
+class ProcessorStateSnapshot
+{
+public:
+    static constexpr std::uint32_t s_magic = 0x504e534d; ///< "MSNP" when read as little-endian bytes.
+    static constexpr std::uint16_t s_version = 1;
+
+    /** @brief Fixed size snapshot header, all fields little-endian. */
+    struct Header
+    {
+        std::uint32_t magic = s_magic;
+        std::uint16_t version = s_version;
+        std::uint16_t headerSize = sizeof(Header);
+        std::uint16_t inputCount = 0;
+        std::uint16_t outputCount = 0;
+        std::uint32_t payloadSize = 0;
+        std::uint32_t payloadChecksum = 0;
+        std::uint32_t reserved = 0;
+    };
+
+    /** @brief Routing state as held by MemaProcessor, 1-based channel numbers. */
+    struct RoutingState
+    {
+        std::map<std::uint16_t, bool>                            inputMuteStates;
+        std::map<std::uint16_t, bool>                            outputMuteStates;
+        std::map<std::uint16_t, std::map<std::uint16_t, bool>>  crosspointStates;
+        std::map<std::uint16_t, std::map<std::uint16_t, float>> crosspointValues;
+    };
+
+public:
+    //==============================================================================
+    /** @brief Serialises the channels 1..inputCount / 1..outputCount of @p state, missing entries are written as zero. */
+    static juce::MemoryBlock serialize(int inputCount, int outputCount, const RoutingState& state);
+    /**
+     * @brief Validates the snapshot in @p data and reads it into @p state.
+     * @param payloadChecksum   Optionally receives the payload checksum of the snapshot, see getPayloadChecksum.
+     * @return False if the snapshot is invalid or was taken for a different channel count than @p inputCount / @p outputCount.
+     */
+    static bool deserialize(const void* data, size_t size, int inputCount, int outputCount, RoutingState& state, std::uint32_t* payloadChecksum = nullptr);
+    /** @brief Returns the payload checksum of a serialized @p snapshot, which identifies it e.g. as base of a ProcessorStateJournal. */
+    static std::uint32_t getPayloadChecksum(const juce::MemoryBlock& snapshot);
+
+    //==============================================================================
+    /** @brief Memory-maps @p file and deserializes it, see deserialize. */
+    static bool readFromFile(const juce::File& file, int inputCount, int outputCount, RoutingState& state, std::uint32_t* payloadChecksum = nullptr);
+
+    //==============================================================================
+    /** @brief Returns the snapshot file kept next to the app configuration file. */
+    static juce::File getDefaultFile();
+
+    //==============================================================================
+    /** @brief CRC-32 (IEEE 802.3) of @p size bytes at @p data. */
+    static std::uint32_t calculateChecksum(const void* data, size_t size);
+
+private:
+    //==============================================================================
+    static size_t getPayloadSize(int inputCount, int outputCount);
+};
+
+} // namespace Mema
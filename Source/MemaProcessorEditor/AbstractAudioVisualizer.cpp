@@ -24,17 +24,70 @@ namespace Mema
 {
 
 
+//==============================================================================
+AudioVisualizerRefreshScheduler::AudioVisualizerRefreshScheduler()
+{
+}
+
+AudioVisualizerRefreshScheduler::~AudioVisualizerRefreshScheduler()
+{
+    stopTimer();
+}
+
+void AudioVisualizerRefreshScheduler::addVisualizer(AbstractAudioVisualizer* visualizer)
+{
+    if (m_visualizers.end() == std::find(m_visualizers.begin(), m_visualizers.end(), visualizer))
+        m_visualizers.push_back(visualizer);
+}
+
+void AudioVisualizerRefreshScheduler::removeVisualizer(AbstractAudioVisualizer* visualizer)
+{
+    m_visualizers.erase(std::remove(m_visualizers.begin(), m_visualizers.end(), visualizer), m_visualizers.end());
+
+    if (m_visualizers.empty())
+        stopTimer();
+}
+
+void AudioVisualizerRefreshScheduler::scheduleRefresh()
+{
+    if (!isTimerRunning())
+        startTimerHz(s_masterRefreshFrequency);
+}
+
+void AudioVisualizerRefreshScheduler::timerCallback()
+{
+    auto now = juce::Time::getMillisecondCounter();
+
+    // index based, since processChanges may create or destroy visualizers
+    for (size_t i = 0; i < m_visualizers.size(); ++i)
+    {
+        auto visualizer = m_visualizers[i];
+        if (!visualizer->hasPendingChanges() || (now - visualizer->m_lastRefreshMs) < visualizer->m_refreshIntervalMs)
+            continue;
+
+        visualizer->m_lastRefreshMs = now;
+        visualizer->m_processedChangesGeneration = visualizer->m_changesGeneration;
+        visualizer->processChanges();
+    }
+
+    // nothing left to do - sleep until the next notifyChanges
+    if (m_visualizers.end() == std::find_if(m_visualizers.begin(), m_visualizers.end(), [](AbstractAudioVisualizer* v) { return v->hasPendingChanges(); }))
+        stopTimer();
+}
+
+
 //==============================================================================
 AbstractAudioVisualizer::AbstractAudioVisualizer()
     : juce::Component()
 {
-    m_changesPending = false;
+    m_refreshScheduler->addVisualizer(this);
 
     setRefreshFrequency(15);
 }
 
 AbstractAudioVisualizer::~AbstractAudioVisualizer()
 {
+    m_refreshScheduler->removeVisualizer(this);
 }
 
 void AbstractAudioVisualizer::paint (Graphics& g)
@@ -54,12 +107,7 @@ void AbstractAudioVisualizer::mouseDown(const juce::MouseEvent& event)
 
 void AbstractAudioVisualizer::setRefreshFrequency(int frequency)
 {
-    startTimerHz(frequency);
-}
-
-void AbstractAudioVisualizer::timerCallback()
-{
-    processChanges();
+    m_refreshIntervalMs = frequency > 0 ? juce::uint32(1000 / frequency) : 0;
 }
 
 void AbstractAudioVisualizer::setUsesValuesInDB(bool useValuesInDB)
@@ -128,16 +176,18 @@ bool AbstractAudioVisualizer::getUsesValuesInDB()
 
 void AbstractAudioVisualizer::notifyChanges()
 {
-    m_changesPending = true;
+    m_changesGeneration++;
+    m_refreshScheduler->scheduleRefresh();
+}
+
+bool AbstractAudioVisualizer::hasPendingChanges() const
+{
+    return m_changesGeneration != m_processedChangesGeneration;
 }
 
 void AbstractAudioVisualizer::processChanges()
 {
-    if (m_changesPending)
-    {
-        m_changesPending = false;
-        repaint();
-    }
+    repaint();
 }
 
 }
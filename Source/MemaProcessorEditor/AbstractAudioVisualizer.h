@@ -25,24 +25,64 @@
 namespace Mema
 {
 
+class AbstractAudioVisualizer;
+
+/**
+ * @class AudioVisualizerRefreshScheduler
+ * @brief Single master timer shared by all visualizers of the application, ticking them together.
+ *
+ * @details Visualizers register on construction (via `juce::SharedResourcePointer`).  The master
+ * timer only runs while at least one visualizer has unprocessed data changes; on each tick every
+ * visualizer whose data generation advanced and whose own refresh interval elapsed gets its
+ * `processChanges()` call.  Visualizers without new data are skipped entirely, and with no new
+ * data anywhere the timer stops, so idle monitoring costs no periodic work at all.
+ */
+class AudioVisualizerRefreshScheduler : private juce::Timer
+{
+public:
+    AudioVisualizerRefreshScheduler();
+    ~AudioVisualizerRefreshScheduler() override;
+
+    //==============================================================================
+    void addVisualizer(AbstractAudioVisualizer* visualizer);
+    void removeVisualizer(AbstractAudioVisualizer* visualizer);
+
+    //==============================================================================
+    /** @brief Ensures the master timer is running; called whenever a visualizer received new data. */
+    void scheduleRefresh();
+
+private:
+    //==============================================================================
+    void timerCallback() override;
+
+    //==============================================================================
+    std::vector<AbstractAudioVisualizer*>   m_visualizers;
+
+    static constexpr int s_masterRefreshFrequency = 60; ///< Master tick rate in Hz, upper bound for all visualizer refresh rates.
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AudioVisualizerRefreshScheduler)
+};
+
 /** @class AbstractAudioVisualizer
  *  @brief Base class for all audio-data visualisation components in the Mema processor editor.
  *
- * Implements juce::Timer and ProcessorDataAnalyzer::Listener to receive level/spectrum
- * notifications and trigger repaints at a configurable refresh rate.
+ * Implements ProcessorDataAnalyzer::Listener to receive level/spectrum notifications. Repaints are
+ * driven by the shared AudioVisualizerRefreshScheduler and only happen when new data arrived since
+ * the last refresh, at most at the configured refresh rate.
  */
 class AbstractAudioVisualizer : public juce::Component,
-                                public ProcessorDataAnalyzer::Listener,
-                                public juce::Timer
+                                public ProcessorDataAnalyzer::Listener
 {
 public:
     AbstractAudioVisualizer();
     virtual ~AbstractAudioVisualizer();
     
     //==============================================================================
-    /** @brief Marks that new data is available and triggers a repaint on the next timer tick. */
+    /** @brief Marks that new data is available by advancing the data generation; processed on the next due scheduler tick. */
     void notifyChanges();
-    /** @brief Called on the message thread to update cached data before repainting. */
+    /** @brief Returns true if the data generation advanced since the last processChanges() call. */
+    bool hasPendingChanges() const;
+    /** @brief Called on the message thread when new data is pending, to update cached data and repaint. */
     virtual void processChanges();
 
     //==============================================================================
@@ -54,10 +94,8 @@ public:
     void mouseDown(const MouseEvent& event) override;
 
     //==============================================================================
-    /** @brief Sets the display refresh rate in Hz. */
+    /** @brief Sets the maximum display refresh rate in Hz. */
     void setRefreshFrequency(int frequency);
-    /** @brief Timer callback that calls processChanges() and triggers a repaint if data changed. */
-    void timerCallback() override;
 
 protected:
     //==============================================================================
@@ -65,8 +103,15 @@ protected:
     bool getUsesValuesInDB();
 
 private:
-    bool    m_changesPending{ false };
-    bool    m_usesValuesInDB{ 0 };
+    friend class AudioVisualizerRefreshScheduler;
+
+    juce::SharedResourcePointer<AudioVisualizerRefreshScheduler> m_refreshScheduler;
+
+    std::uint64_t   m_changesGeneration{ 0 };           ///< Advanced by every notifyChanges().
+    std::uint64_t   m_processedChangesGeneration{ 0 };  ///< Generation at the last processChanges().
+    juce::uint32    m_refreshIntervalMs{ 66 };          ///< Minimum time between two processChanges() calls.
+    juce::uint32    m_lastRefreshMs{ 0 };               ///< Millisecond counter at the last processChanges().
+    bool            m_usesValuesInDB{ 0 };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AbstractAudioVisualizer)
 };
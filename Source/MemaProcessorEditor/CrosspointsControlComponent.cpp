@@ -63,6 +63,33 @@ void CrosspointsControlComponent::setCrosspointFactorValue(std::uint16_t input,
     repaint();
 }
 
+void CrosspointsControlComponent::setCrosspointValues(const std::map<std::uint16_t, std::map<std::uint16_t, bool>>& enabledStates, const std::map<std::uint16_t, std::map<std::uint16_t, float>>& factors, int /*userId*/)
+{
+    for (auto const& enabledStatesKV : enabledStates)
+    {
+        auto componentsIter = m_crosspointComponent.find(enabledStatesKV.first);
+        for (auto const& enabledStateKV : enabledStatesKV.second)
+        {
+            m_crosspointEnabledValues[enabledStatesKV.first][enabledStateKV.first] = enabledStateKV.second;
+            if (m_crosspointComponent.end() != componentsIter && 1 == componentsIter->second.count(enabledStateKV.first) && componentsIter->second.at(enabledStateKV.first))
+                componentsIter->second.at(enabledStateKV.first)->setChecked(enabledStateKV.second);
+        }
+    }
+    for (auto const& factorsKV : factors)
+    {
+        auto componentsIter = m_crosspointComponent.find(factorsKV.first);
+        for (auto const& factorKV : factorsKV.second)
+        {
+            m_crosspointFactorValues[factorsKV.first][factorKV.first] = factorKV.second;
+            if (m_crosspointComponent.end() != componentsIter && 1 == componentsIter->second.count(factorKV.first) && componentsIter->second.at(factorKV.first))
+                componentsIter->second.at(factorKV.first)->setFactor(factorKV.second);
+        }
+    }
+
+    // one repaint for the whole batch instead of one per node
+    repaint();
+}
+
 void CrosspointsControlComponent::setIOCount(std::uint16_t inputCount, std::uint16_t outputCount)
 {
     auto newIOCount = std::make_pair(int(inputCount), int(outputCount));
@@ -181,6 +181,7 @@ public:
     //==============================================================================
     void setCrosspointEnabledValue(std::uint16_t input, std::uint16_t output, bool enabledState, int userId = -1) override;
     void setCrosspointFactorValue(std::uint16_t input, std::uint16_t output, float factor, int userId = -1) override;
+    void setCrosspointValues(const std::map<std::uint16_t, std::map<std::uint16_t, bool>>& enabledStates, const std::map<std::uint16_t, std::map<std::uint16_t, float>>& factors, int userId = -1) override;
 
     //==============================================================================
     std::function<void()> onBoundsRequirementChange;
@@ -56,6 +56,8 @@ MeterbridgeComponent::MeterbridgeComponent()
     auto r4 = l4.GetFactorRMSdB();
     auto h4 = l4.GetFactorHOLDdB();
 #endif
+
+    lookAndFeelChanged();
 }
 
 MeterbridgeComponent::MeterbridgeComponent(Direction direction)
@@ -72,137 +74,198 @@ MeterbridgeComponent::~MeterbridgeComponent()
 void MeterbridgeComponent::paint(Graphics& g)
 {
 	// (Our component is opaque, so we must completely fill the background with a solid colour)
-	g.fillAll(getLookAndFeel().findColour(juce::ResizableWindow::backgroundColourId));
+	g.fillAll(m_backgroundColour);
+
+    // only the bars of channels within the dirty region need to be drawn
+    auto clipBounds = g.getClipBounds().toFloat();
+    for (auto i = 0; i < int(m_meterTracks.size()) && i < int(m_meterLengths.size()); ++i)
+    {
+        if (!m_meterTracks[i].intersects(clipBounds))
+            continue;
+
+        auto const& lengths = m_meterLengths[i];
+
+        // peak bar
+        g.setColour(m_peakColour);
+        g.fillRect(getBarArea(i, 0.0f, lengths.peak));
+        // rms bar
+        g.setColour(m_rmsColour);
+        g.fillRect(getBarArea(i, 0.0f, lengths.rms));
+        // hold strip
+        g.setColour(m_holdColour);
+        auto holdArea = getBarArea(i, 0.0f, lengths.hold);
+        if (m_direction == Direction::Horizontal)
+            g.drawLine(juce::Line<float>(holdArea.getX(), holdArea.getY(), holdArea.getRight(), holdArea.getY()));
+        else
+            g.drawLine(juce::Line<float>(holdArea.getRight(), holdArea.getY(), holdArea.getRight(), holdArea.getBottom()));
+    }
+
+    // labels, baseline and range text
+    auto scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (!m_staticLayerImage.isValid() || scale != m_staticLayerImageScale)
+        renderStaticLayer(scale);
+    if (m_staticLayerImage.isValid())
+        g.drawImage(m_staticLayerImage, getLocalBounds().toFloat());
+}
+
+void MeterbridgeComponent::resized()
+{
+    updateMeterLayout();
+
+    AbstractAudioVisualizer::resized();
+}
+
+void MeterbridgeComponent::lookAndFeelChanged()
+{
+    m_backgroundColour = getLookAndFeel().findColour(juce::ResizableWindow::backgroundColourId);
+    m_peakColour = getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringPeakColourId);
+    m_rmsColour = getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringRmsColourId);
+    m_holdColour = getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringHoldColourId);
+    m_textColour = getLookAndFeel().findColour(juce::TextButton::textColourOffId);
+
+    m_staticLayerImage = juce::Image();
+    repaint();
+
+    AbstractAudioVisualizer::lookAndFeelChanged();
+}
+
+void MeterbridgeComponent::updateMeterLayout()
+{
+    m_meterTracks.clear();
+    m_meterMaxLength = 0.0f;
+    m_staticLayerImage = juce::Image();
+
+    auto channelCount = static_cast<unsigned long>(m_channelCount);
+    if (channelCount > 0 && !getLocalBounds().isEmpty())
+    {
+        if (m_direction == Direction::Horizontal)
+        {
+            auto margin = getWidth() / ((2 * channelCount) + 1);
+            auto meterSpacing = margin;
+            auto meterThickness = float(getWidth() - (channelCount) * meterSpacing) / float(channelCount);
+            auto meterLeft = 0.5f * meterSpacing;
+
+            m_meterMaxLength = float(getHeight());
+            for (unsigned long i = 1; i <= channelCount; ++i)
+            {
+                m_meterTracks.push_back(juce::Rectangle<float>(meterLeft, 0.0f, meterThickness, m_meterMaxLength));
+                meterLeft += meterThickness + meterSpacing;
+            }
+        }
+        else
+        {
+            auto margin = getHeight() / ((2 * channelCount) + 1);
+            auto meterSpacing = margin;
+            auto meterThickness = float(getHeight() - (channelCount) * meterSpacing) / float(channelCount);
+            auto meterTop = 0.5f * meterSpacing;
+
+            m_meterMaxLength = float(getWidth());
+            for (unsigned long i = 1; i <= channelCount; ++i)
+            {
+                m_meterTracks.push_back(juce::Rectangle<float>(0.0f, meterTop, m_meterMaxLength, meterThickness));
+                meterTop += meterThickness + meterSpacing;
+            }
+        }
+    }
+
+    updateMeterLengths(m_meterLengths);
+    repaint();
+}
+
+void MeterbridgeComponent::updateMeterLengths(std::vector<MeterLengths>& meterLengths)
+{
+    meterLengths.resize(m_meterTracks.size());
+
+    // level arrays are contiguous per type - dB factors are only recalculated here if the levels changed
+    auto levelChannelCount = static_cast<int>(m_levelData.GetChannelCount());
+    auto peakLevels = getUsesValuesInDB() ? m_levelData.GetLevelFactorsdB(ProcessorLevelData::Peak) : m_levelData.GetLevels(ProcessorLevelData::Peak);
+    auto rmsLevels = getUsesValuesInDB() ? m_levelData.GetLevelFactorsdB(ProcessorLevelData::Rms) : m_levelData.GetLevels(ProcessorLevelData::Rms);
+    auto holdLevels = getUsesValuesInDB() ? m_levelData.GetLevelFactorsdB(ProcessorLevelData::Hold) : m_levelData.GetLevels(ProcessorLevelData::Hold);
+
+    for (auto i = 0; i < int(meterLengths.size()); ++i)
+    {
+        if (i < levelChannelCount)
+        {
+            // snap to whole pixels, sub-pixel changes are not worth a repaint
+            meterLengths[i].peak = std::round(m_meterMaxLength * juce::jlimit(0.0f, 1.0f, peakLevels[i]));
+            meterLengths[i].rms = std::round(m_meterMaxLength * juce::jlimit(0.0f, 1.0f, rmsLevels[i]));
+            meterLengths[i].hold = std::round(m_meterMaxLength * juce::jlimit(0.0f, 1.0f, holdLevels[i]));
+        }
+        else
+            meterLengths[i] = MeterLengths();
+    }
+}
+
+juce::Rectangle<float> MeterbridgeComponent::getBarArea(int channelIdx, float fromLength, float toLength) const
+{
+    auto const& track = m_meterTracks[channelIdx];
+    if (m_direction == Direction::Horizontal)
+        return juce::Rectangle<float>(track.getX(), track.getBottom() - toLength, track.getWidth(), toLength - fromLength);
+    else
+        return juce::Rectangle<float>(track.getX() + fromLength, track.getY(), toLength - fromLength, track.getHeight());
+}
+
+void MeterbridgeComponent::renderStaticLayer(float scale)
+{
+    m_staticLayerImageScale = scale;
+    if (getLocalBounds().isEmpty() || m_meterTracks.empty())
+    {
+        m_staticLayerImage = juce::Image();
+        return;
+    }
+
+    m_staticLayerImage = juce::Image(juce::Image::ARGB, juce::roundToInt(getWidth() * scale), juce::roundToInt(getHeight() * scale), true);
+    juce::Graphics g(m_staticLayerImage);
+    g.addTransform(juce::AffineTransform::scale(scale));
 
-	// calculate what we need for our center circle
 	auto visuAreaWidth = static_cast<float>(getWidth());
 	auto visuAreaHeight = static_cast<float>(getHeight());
+    auto visuArea = getLocalBounds();
+    auto channelCount = static_cast<unsigned long>(m_meterTracks.size());
 
-    auto channelCount = static_cast<unsigned long>(m_channelCount);
+    juce::String rangeText;
+    if (getUsesValuesInDB())
+        rangeText = juce::String(ProcessorDataAnalyzer::getGlobalMindB()) + " ... " + juce::String(ProcessorDataAnalyzer::getGlobalMaxdB()) + " dBFS";
+    else
+        rangeText = "0 ... 1";
 
+    g.setColour(m_textColour);
     if (m_direction == Direction::Horizontal)
     {
         auto margin = getWidth() / ((2 * channelCount) + 1);
-
-        auto visuArea = getLocalBounds();
+        auto meterSpacing = float(margin);
         auto visuAreaOrigY = visuAreaHeight;
 
-        // draw meters
-        auto meterSpacing = margin;
-        auto meterThickness = float(visuArea.getWidth() - (channelCount) * meterSpacing) / float(channelCount);
-        auto meterMaxLength = visuArea.getHeight();
-        auto meterLeft = 0.5f * meterSpacing;
-
+        // channel # labels
         g.setFont(14.0f);
         for (unsigned long i = 1; i <= channelCount; ++i)
         {
-            auto level = m_levelData.GetLevel(i);
-            float peakMeterLength{ 0 };
-            float rmsMeterLength{ 0 };
-            float holdMeterLength{ 0 };
-            if (getUsesValuesInDB())
-            {
-                peakMeterLength = meterMaxLength * level.GetFactorPEAKdB();
-                rmsMeterLength = meterMaxLength * level.GetFactorRMSdB();
-                holdMeterLength = meterMaxLength * level.GetFactorHOLDdB();
-            }
-            else
-            {
-                peakMeterLength = meterMaxLength * level.peak;
-                rmsMeterLength = meterMaxLength * level.rms;
-                holdMeterLength = meterMaxLength * level.hold;
-            }
-
-            // peak bar
-            g.setColour(getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringPeakColourId));
-            g.fillRect(juce::Rectangle<float>(meterLeft, visuAreaOrigY - peakMeterLength, meterThickness, peakMeterLength));
-            // rms bar
-            g.setColour(getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringRmsColourId));
-            g.fillRect(juce::Rectangle<float>(meterLeft, visuAreaOrigY - rmsMeterLength, meterThickness, rmsMeterLength));
-            // hold strip
-            g.setColour(getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringHoldColourId));
-            g.drawLine(juce::Line<float>(meterLeft, visuAreaOrigY - holdMeterLength, meterLeft + meterThickness, visuAreaOrigY - holdMeterLength));
-            // channel # label
-            g.setColour(getLookAndFeel().findColour(juce::TextButton::textColourOffId));
-            g.drawText(juce::String(i), juce::Rectangle<float>(meterLeft - (0.5f * meterSpacing), visuAreaOrigY - float(margin + 2), meterThickness + meterSpacing, float(margin)), juce::Justification::centred);
-
-            meterLeft += meterThickness + meterSpacing;
+            auto const& track = m_meterTracks[i - 1];
+            g.drawText(juce::String(i), juce::Rectangle<float>(track.getX() - (0.5f * meterSpacing), visuAreaOrigY - float(margin + 2), track.getWidth() + meterSpacing, float(margin)), juce::Justification::centred);
         }
 
         // draw a simple baseline
-        g.setColour(getLookAndFeel().findColour(juce::TextButton::textColourOffId));
         g.drawLine(juce::Line<float>(0.0f, visuAreaOrigY, visuAreaWidth, visuAreaOrigY));
         // draw dBFS
         g.setFont(12.0f);
-        g.setColour(getLookAndFeel().findColour(juce::TextButton::textColourOffId));
-        juce::String rangeText;
-        if (getUsesValuesInDB())
-            rangeText = juce::String(ProcessorDataAnalyzer::getGlobalMindB()) + " ... " + juce::String(ProcessorDataAnalyzer::getGlobalMaxdB()) + " dBFS";
-        else
-            rangeText = "0 ... 1";
         g.drawText(rangeText, visuArea, juce::Justification::topRight, true);
     }
     else
     {
-        auto margin = getHeight() / ((2 * channelCount) + 1);
-
-        auto visuArea = getLocalBounds();
         auto visuAreaOrigX = 0.0f;
 
-        // draw meters
-        auto meterSpacing = margin;
-        auto meterThickness = float(visuArea.getHeight() - (channelCount) * meterSpacing) / float(channelCount);
-        auto meterMaxLength = visuArea.getWidth();
-        auto meterTop = 0.5f * meterSpacing;
-
+        // channel # labels
         g.setFont(14.0f);
         for (unsigned long i = 1; i <= channelCount; ++i)
         {
-            auto level = m_levelData.GetLevel(i);
-            float peakMeterLength{ 0 };
-            float rmsMeterLength{ 0 };
-            float holdMeterLength{ 0 };
-            if (getUsesValuesInDB())
-            {
-                peakMeterLength = meterMaxLength * level.GetFactorPEAKdB();
-                rmsMeterLength = meterMaxLength * level.GetFactorRMSdB();
-                holdMeterLength = meterMaxLength * level.GetFactorHOLDdB();
-            }
-            else
-            {
-                peakMeterLength = meterMaxLength * level.peak;
-                rmsMeterLength = meterMaxLength * level.rms;
-                holdMeterLength = meterMaxLength * level.hold;
-            }
-
-            // peak bar
-            g.setColour(getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringPeakColourId));
-            g.fillRect(juce::Rectangle<float>(visuAreaOrigX, meterTop, peakMeterLength, meterThickness));
-            // rms bar
-            g.setColour(getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringRmsColourId));
-            g.fillRect(juce::Rectangle<float>(visuAreaOrigX, meterTop, rmsMeterLength, meterThickness));
-            // hold strip
-            g.setColour(getLookAndFeel().findColour(JUCEAppBasics::CustomLookAndFeel::ColourIds::MeteringHoldColourId));
-            g.drawLine(juce::Line<float>(visuAreaOrigX + holdMeterLength, meterTop, visuAreaOrigX + holdMeterLength, meterTop + meterThickness));
-            // channel # label
-            g.setColour(getLookAndFeel().findColour(juce::TextButton::textColourOffId));
-            g.drawText(juce::String(i), juce::Rectangle<float>(visuAreaOrigX, meterTop, float(0.5f * meterMaxLength), meterThickness), juce::Justification::centred);
-
-            meterTop += meterThickness + meterSpacing;
+            auto const& track = m_meterTracks[i - 1];
+            g.drawText(juce::String(i), juce::Rectangle<float>(visuAreaOrigX, track.getY(), float(0.5f * m_meterMaxLength), track.getHeight()), juce::Justification::centred);
         }
 
         // draw a simple baseline
-        g.setColour(getLookAndFeel().findColour(juce::TextButton::textColourOffId));
         g.drawLine(juce::Line<float>(0.0f, 0.0f, 0.0f, visuAreaHeight));
         // draw dBFS
         g.setFont(12.0f);
-        g.setColour(getLookAndFeel().findColour(juce::TextButton::textColourOffId));
-        juce::String rangeText;
-        if (getUsesValuesInDB())
-            rangeText = juce::String(ProcessorDataAnalyzer::getGlobalMindB()) + " ... " + juce::String(ProcessorDataAnalyzer::getGlobalMaxdB()) + " dBFS";
-        else
-            rangeText = "0 ... 1";
-
         g.setOrigin(visuArea.getBottomLeft());
         g.addTransform(juce::AffineTransform().rotated(90));
         g.drawText(rangeText, visuArea, juce::Justification::topRight, true);
@@ -228,15 +291,47 @@ void MeterbridgeComponent::processingDataChanged(AbstractProcessorData* data)
     }
 }
 
+void MeterbridgeComponent::processChanges()
+{
+    // no full repaint via AbstractAudioVisualizer::processChanges here - only the changed bar regions are invalidated
+    updateMeterLengths(m_pendingMeterLengths);
+    if (m_pendingMeterLengths.size() != m_meterLengths.size())
+    {
+        m_meterLengths = m_pendingMeterLengths;
+        repaint();
+        return;
+    }
+
+    // repaint only the part of each track between the shortest and longest of old and new bar ends
+    for (auto i = 0; i < int(m_meterLengths.size()); ++i)
+    {
+        auto const& oldLengths = m_meterLengths[i];
+        auto const& newLengths = m_pendingMeterLengths[i];
+        if (oldLengths.peak == newLengths.peak && oldLengths.rms == newLengths.rms && oldLengths.hold == newLengths.hold)
+            continue;
+
+        auto changedFrom = std::min({ oldLengths.peak, oldLengths.rms, oldLengths.hold, newLengths.peak, newLengths.rms, newLengths.hold });
+        auto changedTo = std::max({ oldLengths.peak, oldLengths.rms, oldLengths.hold, newLengths.peak, newLengths.rms, newLengths.hold });
+        m_meterLengths[i] = newLengths;
+
+        // grow by a pixel on both ends to cover the hold strip line width
+        repaint(getBarArea(i, std::max(0.0f, changedFrom - 1.0f), std::min(m_meterMaxLength, changedTo + 1.0f)).getSmallestIntegerContainer());
+    }
+}
+
 void MeterbridgeComponent::setDirection(Direction direction)
 {
     m_direction = direction;
-    repaint();
+    updateMeterLayout();
 }
 
 void MeterbridgeComponent::setChannelCount(int channelCount)
 {
+    if (m_channelCount == channelCount)
+        return;
+
     m_channelCount = channelCount;
+    updateMeterLayout();
 }
 
 int MeterbridgeComponent::getChannelCount()
@@ -26,7 +26,14 @@
 namespace Mema
 {
 
-/** @class MeterbridgeComponent @brief Level-meter bar component supporting horizontal and vertical orientations. */
+/**
+ * @class MeterbridgeComponent
+ * @brief Level-meter bar component supporting horizontal and vertical orientations.
+ *
+ * @details Rendering is incremental: channel labels, baseline and range text are cached in a
+ * static layer image, colours are resolved once per look-and-feel change, and on each refresh tick
+ * only the part of a meter track where peak, rms or hold actually moved is repainted.
+ */
 class MeterbridgeComponent : public AbstractAudioVisualizer
 {
 public:
@@ -44,9 +51,12 @@ public:
 
     //==============================================================================
     void paint (Graphics&) override;
+    void resized() override;
+    void lookAndFeelChanged() override;
 
     //==============================================================================
     void processingDataChanged(AbstractProcessorData* data) override;
+    void processChanges() override;
 
     //==============================================================================
     void setDirection(Direction direction);
@@ -54,9 +64,38 @@ public:
     int getChannelCount();
 
 private:
+    /** @brief Bar lengths in pixels along the meter track, as last scheduled for painting. */
+    struct MeterLengths
+    {
+        float peak = 0.0f;
+        float rms = 0.0f;
+        float hold = 0.0f;
+    };
+
+    //==============================================================================
+    void updateMeterLayout();
+    void updateMeterLengths(std::vector<MeterLengths>& meterLengths);
+    juce::Rectangle<float> getBarArea(int channelIdx, float fromLength, float toLength) const;
+    void renderStaticLayer(float scale);
+
+    //==============================================================================
     ProcessorLevelData  m_levelData;
     Direction m_direction{ Vertical };
     int m_channelCount{ 0 };
+
+    std::vector<juce::Rectangle<float>> m_meterTracks;      ///< Full-length track area per channel.
+    float m_meterMaxLength{ 0.0f };                         ///< Track length in pixels corresponding to full scale.
+    std::vector<MeterLengths> m_meterLengths;               ///< Currently painted bar lengths per channel.
+    std::vector<MeterLengths> m_pendingMeterLengths;        ///< Scratch list reused in processChanges.
+
+    juce::Image m_staticLayerImage;                         ///< Cached labels, baseline and range text.
+    float m_staticLayerImageScale{ 0.0f };                  ///< Physical pixel scale the static layer was rendered at.
+
+    juce::Colour m_backgroundColour;
+    juce::Colour m_peakColour;
+    juce::Colour m_rmsColour;
+    juce::Colour m_holdColour;
+    juce::Colour m_textColour;
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MeterbridgeComponent)
 };
@@ -22,6 +22,7 @@
 
 #include "../MemaProcessor/MemaPluginParameterInfo.h"
 
+#include <AppConfigurationBase.h>
 #include <FixedFontTextEditor.h>
 
 
@@ -190,14 +191,32 @@ public:
 };
 
 //==============================================================================
-class PluginListAndSelectComponent : public juce::Component
+/**
+ * @class PluginListAndSelectComponent
+ * @brief Plug-in selection popup listing the known plug-ins, with scanning for new ones.
+ *
+ * @details The list of scanned plug-in descriptions is cached next to the app configuration file,
+ * so it is available right away on the next start instead of having to be rescanned.  Scans run on
+ * several threads, a plug-in that crashes the app while being scanned is skipped on the next scan.
+ * The cache is saved once the list stopped changing for a moment, not per scanned plug-in, and
+ * replaced atomically, so a crash mid-scan leaves the previous cache intact.
+ */
+class PluginListAndSelectComponent : public juce::Component, public juce::ChangeListener, private juce::Timer
 {
 public:
     PluginListAndSelectComponent()
     {
         addDefaultFormatsToManager(m_formatManager);
-        juce::File deadMansPedalFile;
+
+        auto configFile = juce::File(JUCEAppBasics::AppConfigurationBase::getDefaultConfigFilePath());
+        m_pluginListCacheFile = configFile.getSiblingFile(configFile.getFileNameWithoutExtension() + ".plugins");
+        if (auto pluginListXml = juce::parseXML(m_pluginListCacheFile))
+            m_pluginList.recreateFromXml(*pluginListXml);
+        m_pluginList.addChangeListener(this);
+
+        auto deadMansPedalFile = configFile.getSiblingFile(configFile.getFileNameWithoutExtension() + ".pluginscan");
         m_pluginListComponent = std::make_unique<juce::PluginListComponent>(m_formatManager, m_pluginList, deadMansPedalFile, nullptr);
+        m_pluginListComponent->setNumberOfThreadsForScanning(juce::jmax(1, juce::SystemStats::getNumCpus() - 1));
         m_pluginListComponent->getTableListBox().setMultipleSelectionEnabled(false);
         auto customTableModel = std::make_unique<CustomPluginListComponentTableModel>(*m_pluginListComponent, m_pluginList);
         customTableModel->onSelectionChanged = [=](int lastRowSelected) {
@@ -228,7 +247,12 @@ public:
 
         setSize(885, 600);
     };
-    ~PluginListAndSelectComponent() = default;
+    ~PluginListAndSelectComponent()
+    {
+        m_pluginList.removeChangeListener(this);
+        if (isTimerRunning())
+            timerCallback();
+    };
 
     //==============================================================================
     void paint(Graphics& g) override
@@ -246,6 +270,28 @@ public:
         m_selectButton->setBounds(bounds.removeFromRight(80).reduced(2));
     };
 
+    //==============================================================================
+    void changeListenerCallback(juce::ChangeBroadcaster* source) override
+    {
+        // keep the cache in sync with scan results and removals, a running scan changes the list per plug-in found
+        if (source == &m_pluginList)
+            startTimer(s_pluginListCacheSaveDelay);
+    };
+
+    //==============================================================================
+    void timerCallback() override
+    {
+        stopTimer();
+
+        auto pluginListXml = m_pluginList.createXml();
+        if (!pluginListXml)
+            return;
+
+        juce::TemporaryFile tempFile(m_pluginListCacheFile);
+        if (!pluginListXml->writeTo(tempFile.getFile()) || !tempFile.overwriteTargetFileWithTemporary())
+            DBG(juce::String(__FUNCTION__) << " failed to write " << m_pluginListCacheFile.getFullPathName());
+    };
+
     //==============================================================================
     std::function<void(const juce::PluginDescription&)> onPluginSelected;
 
@@ -253,6 +299,8 @@ private:
     //==============================================================================
     juce::AudioPluginFormatManager              m_formatManager;
     juce::KnownPluginList                       m_pluginList;
+    juce::File                                  m_pluginListCacheFile;
+    static constexpr int                        s_pluginListCacheSaveDelay = 1000; ///< Time in ms the list must be unchanged before the cache is saved.
 
     std::unique_ptr<juce::PluginListComponent>  m_pluginListComponent;
     std::unique_ptr<juce::TextButton>           m_selectButton;
@@ -24,7 +24,7 @@
 #include <AppConfigurationBase.h>
 
 //==============================================================================
-class LoadBar : public juce::Component
+class LoadBar : public juce::Component, public juce::SettableTooltipClient
 {
 public:
     LoadBar(juce::String label, bool showPercent = true, bool showMax = true) : juce::Component::Component() { m_label = label; m_showPercent = showPercent; m_showMax = showMax; }
@@ -306,10 +306,22 @@ void MemaUIComponent::handleEditorSizeChangeRequest(const juce::Rectangle<int>&
     setSize(width, height);
 }
 
-void MemaUIComponent::updateCpuUsageBar(int loadPercent)
+void MemaUIComponent::updateAudioCallbackProfile(const AudioCallbackProfiler::Snapshot& profile)
 {
+    auto interval = profile.getDifference(m_lastAudioCallbackProfile);
+    m_lastAudioCallbackProfile = profile;
+
     if (m_sysLoadBar)
-        m_sysLoadBar->setLoadPercent(loadPercent);
+    {
+        m_sysLoadBar->setLoadPercent(juce::roundToInt(interval.getMeanLoad() * 100.0));
+        m_sysLoadBar->setAlert(interval.deadlineMissCount > 0 || interval.xrunCount > 0);
+
+        auto tooltip = juce::String("Audio callback ") + juce::String(interval.getMeanCallbackUs(), 0) + " of " + juce::String(profile.deadlineUs, 0) + " us, peak " + juce::String(profile.maxCallbackUs, 0) + " us";
+        for (auto stage = 0; stage < AudioCallbackProfiler::StageCount; stage++)
+            tooltip << "\n" << AudioCallbackProfiler::getStageName(AudioCallbackProfiler::Stage(stage)) << ": " << juce::String(interval.getMeanStageUs(AudioCallbackProfiler::Stage(stage)), 1) << " us";
+        tooltip << "\n" << juce::String(juce::int64(profile.deadlineMissCount)) << " deadline misses, " << juce::String(juce::int64(profile.xrunCount)) << " xruns";
+        m_sysLoadBar->setTooltip(tooltip);
+    }
 }
 
 void MemaUIComponent::updateNetworkUsage(const std::map<int, std::pair<double, bool>>& netLoads)
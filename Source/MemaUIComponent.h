@@ -21,6 +21,7 @@
 #include <JuceHeader.h>
 
 #include "MemaAppConfiguration.h"
+#include "MemaProcessor/AudioCallbackProfiler.h"
 
 #include <CustomLookAndFeel.h>
 #include <ServiceTopologyManager.h>
@@ -43,8 +44,8 @@ namespace Mema
  * - Hosts the `MemaProcessorEditor` (set via `setEditorComponent()`) in its central area.
  * - Provides a toolbar row with buttons: standalone-window toggle, settings gear, audio setup,
  *   about, and power/quit.
- * - Displays a CPU load bar (`m_sysLoadBar`) and a network health bar (`m_netHealthBar`) that
- *   are updated from the `Mema` singleton's timer callback via `updateCpuUsageBar()` and
+ * - Displays a processing load bar (`m_sysLoadBar`) and a network health bar (`m_netHealthBar`) that
+ *   are updated from the `Mema` singleton's timer callback via `updateAudioCallbackProfile()` and
  *   `updateNetworkUsage()`.
  * - Exposes a settings popup menu (gear icon) for look-and-feel, metering colour, load/save config.
  * - Persists its own state (standalone mode, palette, metering colour) via `XmlConfigurableElement`
@@ -122,12 +123,14 @@ public:
     void handleEditorSizeChangeRequest(const juce::Rectangle<int>& requestedSize);
 
     /**
-     * @brief Updates the CPU-load progress bar to reflect the current audio processing load.
-     * @details Called from the `Mema` singleton's `juce::Timer` callback (~1 Hz) after querying
-     *          `AudioDeviceManager::getCpuUsage()`.
-     * @param loadPercent CPU load as a percentage in [0, 100].
+     * @brief Updates the processing load bar from the audio callback timings.
+     * @details Called from the `Mema` singleton's `juce::Timer` callback (~2 Hz) with the totals of
+     *          `MemaProcessor::getAudioCallbackProfile()`.  The bar shows the mean callback duration
+     *          relative to the buffer deadline since the previous update and turns red if a deadline
+     *          was missed or an xrun occurred in that time, the tooltip lists the per-stage timings.
+     * @param profile Audio callback timings since the last reset.
      */
-    void updateCpuUsageBar(int loadPercent);
+    void updateAudioCallbackProfile(const AudioCallbackProfiler::Snapshot& profile);
     /**
      * @brief Updates the network-health bar with per-connection traffic metrics.
      * @details Called from the `Mema` singleton's timer callback after querying
@@ -214,7 +217,8 @@ private:
     std::unique_ptr<juce::DrawableButton>       m_aboutButton; ///< Button that shows the about component popup.
     std::unique_ptr<juce::DrawableButton>       m_powerButton; ///< Button that quits/closes the application.
     std::unique_ptr<EmptySpace>                 m_emptySpace; ///< Spacer component used in the toolbar layout.
-    std::unique_ptr<LoadBar>                    m_sysLoadBar; ///< Horizontal progress bar showing CPU audio processing load (0–100 %).
+    std::unique_ptr<LoadBar>                    m_sysLoadBar; ///< Horizontal progress bar showing the audio callback load relative to the buffer deadline (0–100 %).
+    AudioCallbackProfiler::Snapshot             m_lastAudioCallbackProfile; ///< Timings of the previous update, reference for the interval shown in m_sysLoadBar.
     std::unique_ptr<LoadBar>                    m_netHealthBar; ///< Horizontal bar showing aggregate network traffic to/from connected clients.
 
     juce::Component* m_editorComponent = nullptr; ///< Borrowed pointer to the MemaProcessorEditor; not owned by this component.